@@ -0,0 +1,109 @@
+//==============================================================================
+// Name        : Cases.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelos, coeficientes e concentracoes das medidas de desempenho
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// Casos comuns a IsothermBench e IsothermPerf: um por modelo da biblioteca.
+//==============================================================================
+
+#ifndef __ISOTHERM_BENCH_CASES_H__
+#define __ISOTHERM_BENCH_CASES_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <IO/ModelRegistry.h>                               // ist::ModelRegistry
+
+namespace bench {
+
+using ist::ID;
+
+struct Case {
+    UInt                id;
+    std::string         model;
+    std::vector<Real>   coef;
+    Real                temp;
+    Real                easy;
+    Real                stiff;
+    bool                implicit;       //! Qe resolvido por NewtonRaphson
+};
+
+//  Coeficientes e concentracoes baseados nos testes de cada modelo; "stiff"
+//  proximo da saturacao ou do limite do dominio
+
+inline const std::vector < Case >   CASES   {
+    {ID::Henry,                "Henry",                 {15.0},                                              298.15, 2.0, 200.0, false}
+,   {ID::DubininRadushkevich,  "DubininRadushkevich",   {0.364491, 1.850248241e-5},                          62.9774, 0.799587, 50.0, false}
+,   {ID::Elovich,              "Elovich",               {3.62076, 1.984906254e-4},                           298.15, 0.158198, 50.0, true}
+,   {ID::Freundlich,           "Freundlich",            {0.229774, 0.304665},                                298.15, 0.362076, 100.0, false}
+,   {ID::Halsey,               "Halsey",                {1.58198, 0.629774},                                 298.15, 10.3962, 1000.0, false}
+,   {ID::HarkinJura,           "HarkinJura",            {0.737732, 3.99010},                                 298.15, 4.10326, 5000.0, false}
+,   {ID::Jovanovic,            "Jovanovic",             {73.1322, 8.28677},                                  298.15, 0.524708, 5.0, false}
+,   {ID::Langmuir,             "Langmuir",              {63.1638, 7.69755},                                  298.15, 0.138159, 50.0, false}
+,   {ID::Temkin,               "Temkin",                {0.876338, 0.730948},                                88.0658, 4.188692, 2.4, false}
+,   {ID::Hill,                 "Hill",                  {73.3332, 9.17652, 7.09033},                         298.15, 0.362719, 50.0, false}
+,   {ID::HillDeBoer,           "HillDeBoer",            {69.2710, 9.30063, 5.67794},                         331.148, 0.601932, 50.0, true}
+,   {ID::RedlichPeterson,      "RedlichPeterson",       {3.88568, 2.76281, 0.00454748},                      298.15, 1.35757, 500.0, false}
+,   {ID::Sips,                 "Sips",                  {3.26828, 0.910566, 0.8},                            298.15, 1.79986, 500.0, false}
+,   {ID::Kiselev,              "Kiselev",               {33.5812, 1.26172, 0.640606},                        298.15, 0.249857, 0.9, true}
+,   {ID::FowlerGuggenheim,     "FowlerGuggenheim",      {68.1867, 5.42910, 3.27480},                         386.833, 0.0553181, 0.3, true}
+,   {ID::HollKrich,            "HollKrich",             {7.86721, 7.73234, 3.35271},                         298.15, 1.15488, 50.0, false}
+,   {ID::Jossens,              "Jossens",               {5.59427, 3.02992, 2.00797},                         298.15, 2.0, 50.0, false}
+,   {ID::Khan,                 "Khan",                  {21.3007, 4.61728, 5.64049},                         298.15, 3.0, 50.0, false}
+,   {ID::Toth,                 "Toth",                  {47.0956, 0.307156, 0.155428},                       298.15, 1.12596, 500.0, false}
+,   {ID::ViethSladek,          "ViethSladek",           {7.51932, 0.0309101, 0.0235572},                     298.15, 1.47549, 500.0, false}
+,   {ID::FritzSchlunder,       "FritzSchlunder",        {29.2378, 8.89086, 1.48761},                         298.15, 0.02, 50.0, false}
+,   {ID::LangmuirFreundlich,   "LangmuirFreundlich",    {15.8130, 5.53199, 5.45859},                         298.15, 0.692379, 50.0, false}
+,   {ID::BrouersSotolongo,     "BrouersSotolongo",      {1.87902, 0.698076, 8.60195},                        298.15, 1.20177, 50.0, false}
+,   {ID::KobleCorrigan,        "KobleCorrigan",         {5.92353, 2.56458, 0.506544},                        298.15, 0.314521, 50.0, false}
+,   {ID::BrunauerEmmettTeller, "BrunauerEmmettTeller",  {7.87989, 46.4727, 8.78584},                         298.15, 0.0653701, 5.5, false}
+,   {ID::RadkePrausnitsI,      "RadkePrausnitsI",       {61.4681, 8.55061, 0.0306220},                       298.15, 1.97558, 500.0, false}
+,   {ID::RadkePrausnitsII,     "RadkePrausnitsII",      {18.6634, 1.91479, 2.73215},                         298.15, 0.2, 50.0, false}
+,   {ID::RadkePrausnitsIII,    "RadkePrausnitsIII",     {9.54362, 8.23620, 2.40169},                         298.15, 1.50068, 50.0, false}
+,   {ID::MacMillanTeller,      "MacMillanTeller",       {51.2889, 2.96726, 2.90583},                         298.15, 0.5, 50.0, false}
+,   {ID::Unilan,               "Unilan",                {96.4634, 3.32592, 0.301917},                        298.15, 1.29208, 50.0, false}
+,   {ID::ValenzuelaMyers,      "ValenzuelaMyers",       {54.8240, 0.0492822, 0.0926737},                     298.15, 1.00714, 500.0, false}
+,   {ID::Baudu,                "Baudu",                 {1.95325, 0.513664, 0.0435246, 0.00605498},          298.15, 1.84657, 500.0, false}
+,   {ID::FritzSchlunderIV,     "FritzSchlunderIV",      {71.3166, 0.357335, 0.779255, 0.669959},             298.15, 1.36520, 500.0, false}
+,   {ID::MarczewskiJaroniec,   "MarczewskiJaroniec",    {4.99159, 0.240965, 0.0686414, 0.0818727},           298.15, 1.68377, 500.0, false}
+,   {ID::WeberVanVliet,        "WeberVanVliet",         {0.0870930, 3.19814, 0.0647897, 0.769393},           298.15, 1.56792, 50.0, true}
+,   {ID::FrenkelHalseyHill,    "FrenkelHalseyHill",     {778.0, 45.0, 1.5, 0.3, 0.2},                        298.15, 1.0, 50.0, false}
+,   {ID::FritzSchlunderV,      "FritzSchlunderV",       {6.05758, 0.217337, 0.0885359, 0.0169304, 0.0746286}, 298.15, 3.0, 500.0, false}
+};
+
+inline std::unique_ptr<ist::Isotherm> Create (const Case& _case)
+{
+    return ist::ModelRegistry::Default().Create(_case.id, _case.coef);
+}
+
+}
+
+#endif /* __ISOTHERM_BENCH_CASES_H__ */
@@ -0,0 +1,343 @@
+//==============================================================================
+// Name        : IsothermBench.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Medidas de desempenho dos modelos de isotermas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// Medidas, para cada modelo:
+//  - Qe/<modelo>/<regime>      Qe escalar;
+//  - DQDC/<modelo>/<regime>    derivada dQe/dCe;
+//  - Ce/<modelo>/<regime>      isoterma inversa do proprio modelo;
+//  - Clone/<modelo>            copia polimorfica;
+//  - Setter/<modelo>           SetParameters;
+//  - Bracketed/<modelo>/<regime>  Newton protegido por bissecao aplicado a
+//                              Qe(Ce) = qe, como na isoterma inversa
+//                              generica, com o numero de iteracoes;
+//  - NewtonRaphson/<modelo>/<regime>  NewtonRaphson aplicado ao mesmo
+//                              problema, somente para os modelos em que Qe
+//                              e implicito, com o numero de iteracoes;
+//  - Sweep/<modelo>/<threads>  Sweep com 4 valores por coeficiente e NPTO
+//                              concentracoes, com 1, 2, 4, ... threads,
+//                              para medir a escala do paralelismo;
+//  - Policy/Qe|DQDC/<modelo>/seq  Qe e DQDC em bloco de NPOLICY
+//                              concentracoes com seq;
+//  - Policy/Qe|DQDC/<modelo>/par/<threads>  o mesmo com par, num ThreadPool
+//                              de 1, 2, 4, ... threads. par_unseq segue o
+//                              mesmo caminho de par.
+//
+//  O regime "easy" usa Ce no meio da faixa usual do modelo e "stiff" um Ce
+//  proximo da saturacao ou do limite do dominio, onde dQe/dCe e pequena ou
+//  a funcao e muito curva. Cada chamada percorre NPTO concentracoes em
+//  [Ce/2, 3Ce/2], para que o resultado nao dependa de um unico ponto.
+//
+//  Uso: IsothermBench --benchmark_filter=Toth
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <execution>
+#include <type_traits>
+#include <string>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Misc/NewtonRaphson.h>                             // NewtonRaphson
+#include <Misc/RootFinding.h>                               // ist::BracketedNewton
+#include <Misc/Sweep.h>                                     // ist::Sweep
+
+//==============================================================================
+// include da google benchmark
+//==============================================================================
+
+#include <benchmark/benchmark.h>
+
+//==============================================================================
+// Casos
+//==============================================================================
+
+#include "Cases.h"                                          // bench::CASES
+
+namespace {
+
+using bench::Case;
+using bench::CASES;
+using bench::Create;
+
+const size_t    NPTO = 64;
+const size_t    NPOLICY = 1 << 16;
+
+//  Concentracoes em [_ce/2, 3_ce/2]
+
+std::vector<Real> Grid (const Real& _ce)
+{
+
+std::vector<Real>   ce (NPTO);
+
+    for (size_t k = 0; k < NPTO; ++k) ce[k] = _ce * (0.5 + static_cast<Real>(k) / (NPTO - 1));
+
+    return ce;
+
+}
+
+//==============================================================================
+// Medidas
+//==============================================================================
+
+void BenchQe (benchmark::State& _state, const Case& _case, const Real& _ce)
+{
+
+const auto      iso (Create(_case));
+const auto      ce (Grid(_ce));
+
+    for (auto _ : _state)
+        for (const Real c : ce) benchmark::DoNotOptimize(iso->Qe(c, _case.temp));
+
+    _state.SetItemsProcessed(_state.iterations() * NPTO);
+
+}
+
+void BenchDQDC (benchmark::State& _state, const Case& _case, const Real& _ce)
+{
+
+const auto      iso (Create(_case));
+const auto      ce (Grid(_ce));
+
+    for (auto _ : _state)
+        for (const Real c : ce) benchmark::DoNotOptimize(iso->DQDC(c, _case.temp));
+
+    _state.SetItemsProcessed(_state.iterations() * NPTO);
+
+}
+
+void BenchCe (benchmark::State& _state, const Case& _case, const Real& _ce)
+{
+
+const auto          iso (Create(_case));
+std::vector<Real>   qe (Grid(_ce));
+
+    for (Real& q : qe) q = iso->Qe(q, _case.temp);
+
+    for (auto _ : _state)
+        for (const Real q : qe) benchmark::DoNotOptimize(iso->Ce(q, _case.temp));
+
+    _state.SetItemsProcessed(_state.iterations() * NPTO);
+
+}
+
+void BenchClone (benchmark::State& _state, const Case& _case)
+{
+
+const auto      iso (Create(_case));
+
+    for (auto _ : _state) benchmark::DoNotOptimize(iso->Clone());
+
+}
+
+void BenchSetter (benchmark::State& _state, const Case& _case)
+{
+
+const auto          iso (Create(_case));
+std::vector<Real>   coef[2] {_case.coef, _case.coef};
+size_t              k (0);
+
+    for (Real& c : coef[1]) c *= 1.0 + 1.0e-9;
+
+    for (auto _ : _state) {
+        if (!iso->TrySetParameters(coef[k])) {
+            _state.SkipWithError("coeficientes invalidos");
+            break;
+        }
+        k ^= 1;
+    }
+
+}
+
+void BenchBracketed (benchmark::State& _state, const Case& _case, const Real& _ce)
+{
+
+const auto          iso (Create(_case));
+std::vector<Real>   qe (Grid(_ce));
+size_t              niter (0);
+size_t              nsolve (0);
+
+    for (Real& q : qe) q = iso->Qe(q, _case.temp);
+
+    for (auto _ : _state) {
+        for (const Real q : qe) {
+
+        Real    ce (0.0);
+
+            benchmark::DoNotOptimize    (   ist::BracketedNewton    (   [&](const Real& _x, Real& _fx, Real& _dfx) {
+                                                                            ++niter;
+                                                                            _fx = iso->Qe(_x, _case.temp) - q;
+                                                                            _dfx = iso->DQDC(_x, _case.temp);
+                                                                        }
+                                                                    ,   0.5 * _ce
+                                                                    ,   1.5 * _ce
+                                                                    ,   ce
+                                                                    ,   1.0e-12 * _ce
+                                                                    )
+                                        );
+            benchmark::DoNotOptimize(ce);
+        }
+        nsolve += NPTO;
+    }
+
+    _state.SetItemsProcessed(nsolve);
+    _state.counters["iter/call"] = static_cast<Real>(niter) / std::max<size_t>(nsolve, 1);
+
+}
+
+void BenchNewton (benchmark::State& _state, const Case& _case, const Real& _ce)
+{
+
+const auto          iso (Create(_case));
+std::vector<Real>   qe (Grid(_ce));
+size_t              nfunc (0);
+size_t              nsolve (0);
+
+    for (Real& q : qe) q = iso->Qe(q, _case.temp);
+
+//  Partida a esquerda da raiz: Qe concava, iteracoes crescentes
+
+    for (auto _ : _state) {
+        for (const Real q : qe) {
+            benchmark::DoNotOptimize    (   NewtonRaphson   (   [&](Real _x) {
+                                                                    ++nfunc;
+                                                                    return iso->Qe(_x, _case.temp) - q;
+                                                                }
+                                                            ,   0.5 * _ce
+                                                            )
+                                        );
+        }
+        nsolve += NPTO;
+    }
+
+//  Duas avaliacoes por iteracao (funcao e diferenca finita)
+
+    _state.SetItemsProcessed(nsolve);
+    _state.counters["iter/call"] = 0.5 * static_cast<Real>(nfunc) / std::max<size_t>(nsolve, 1);
+
+}
+
+//  Coeficientes a 90, 95, 100 e 105% dos valores do caso
+
+void BenchSweep (benchmark::State& _state, const Case& _case)
+{
+
+const auto                      iso (Create(_case));
+std::vector<std::vector<Real>>  coef;
+
+    for (const Real v : _case.coef) coef.push_back({0.90 * v, 0.95 * v, v, 1.05 * v});
+
+ist::ThreadPool                 pool (static_cast<UInt>(_state.range(0)));
+const ist::Sweep                sweep (*iso, coef, Grid(_case.easy), {_case.temp});
+std::vector<Real>               qe (sweep.NumberPoints());
+
+    for (auto _ : _state) {
+        sweep.Run(qe, pool);
+        benchmark::DoNotOptimize(qe.data());
+    }
+
+    _state.SetItemsProcessed(_state.iterations() * qe.size());
+
+}
+
+//  Qe ou DQDC em bloco com a politica de execucao _policy. Com par, os
+//  blocos sao executados por um ThreadPool proprio de range(0) threads, como
+//  em BenchSweep, e nao pelo ThreadPool::Default() da politica
+
+template < bool Derivative, typename Policy >
+void BenchPolicy (benchmark::State& _state, const Case& _case, [[maybe_unused]] const Policy& _policy)
+{
+
+constexpr bool          parallel (std::is_same_v<Policy, std::execution::parallel_policy>);
+const auto              iso (Create(_case));
+ist::ThreadPool         pool (parallel ? static_cast<UInt>(_state.range(0)) : 1);
+std::vector<Real>       ce (NPOLICY);
+std::vector<Real>       out (NPOLICY);
+
+    for (size_t k = 0; k < NPOLICY; ++k) ce[k] = _case.easy * (0.5 + static_cast<Real>(k) / NPOLICY);
+
+    for (auto _ : _state) {
+        if constexpr (parallel && Derivative) iso->ParallelDQDC(ce, out, _case.temp, &pool);
+        else if constexpr (parallel) iso->ParallelQe(ce, out, _case.temp, &pool);
+        else if constexpr (Derivative) iso->DQDC(_policy, ce, out, _case.temp);
+        else iso->Qe(_policy, ce, out, _case.temp);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    _state.SetItemsProcessed(_state.iterations() * NPOLICY);
+
+}
+
+}
+
+//==============================================================================
+// Registro das medidas
+//==============================================================================
+
+int main (int argc, char** argv)
+{
+
+    for (const auto& c : CASES) {
+
+        for (const auto& [regime, ce] : {std::pair {"easy", c.easy}, std::pair {"stiff", c.stiff}}) {
+
+        const std::string   suffix (c.model + "/" + regime);
+
+            benchmark::RegisterBenchmark(("Qe/" + suffix).c_str(), BenchQe, c, ce);
+            benchmark::RegisterBenchmark(("DQDC/" + suffix).c_str(), BenchDQDC, c, ce);
+            benchmark::RegisterBenchmark(("Ce/" + suffix).c_str(), BenchCe, c, ce);
+            benchmark::RegisterBenchmark(("Bracketed/" + suffix).c_str(), BenchBracketed, c, ce);
+
+            if (c.implicit) benchmark::RegisterBenchmark(("NewtonRaphson/" + suffix).c_str(), BenchNewton, c, ce);
+        }
+
+        benchmark::RegisterBenchmark(("Clone/" + c.model).c_str(), BenchClone, c);
+        benchmark::RegisterBenchmark(("Setter/" + c.model).c_str(), BenchSetter, c);
+        benchmark::RegisterBenchmark(("Sweep/" + c.model).c_str(), BenchSweep, c)
+            ->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+
+        benchmark::RegisterBenchmark(("Policy/Qe/" + c.model + "/seq").c_str(), BenchPolicy<false, std::execution::sequenced_policy>, c, std::execution::seq)->UseRealTime();
+        benchmark::RegisterBenchmark(("Policy/Qe/" + c.model + "/par").c_str(), BenchPolicy<false, std::execution::parallel_policy>, c, std::execution::par)
+            ->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+        benchmark::RegisterBenchmark(("Policy/DQDC/" + c.model + "/seq").c_str(), BenchPolicy<true, std::execution::sequenced_policy>, c, std::execution::seq)->UseRealTime();
+        benchmark::RegisterBenchmark(("Policy/DQDC/" + c.model + "/par").c_str(), BenchPolicy<true, std::execution::parallel_policy>, c, std::execution::par)
+            ->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+    }
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+
+}
@@ -0,0 +1,547 @@
+//==============================================================================
+// Name        : IsothermPerf.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Verificacao de regressao de desempenho contra uma base
+//               gravada em JSON
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// Carga fixa de trabalho:
+//  - Qe/<modelo>               Qe em lote, NBATCH concentracoes;
+//  - Ce/<modelo>               isoterma inversa (Newton protegido ou forma
+//                              fechada), NPTO quantidades adsorvidas;
+//  - Fit/<modelo cinetico>     triagem de 45 ajustes: NDATA conjuntos de
+//                              dados para cada um dos 5 modelos cineticos;
+//  - Breakthrough/Langmuir     uma simulacao de coluna.
+//
+//  Cada amostra mede a medida e, logo antes, um laco aritmetico fixo de
+//  calibracao; a razao entre os dois tempos nao depende da maquina nem de
+//  variacoes lentas de frequencia ou de carga. A interferencia de outros
+//  processos so aumenta os tempos, por isso cada medida guarda o minimo de
+//  NSAMPLE amostras do tempo (ns por operacao) e da calibracao, a razao
+//  entre os dois minimos e o desvio absoluto mediano (MAD) das razoes por
+//  amostra. Uma medida e considerada mais lenta quando a razao corrente
+//  dividida pela da base passa de 1 + limite, com
+//      limite = min(max(tolerancia, NSIGMA * ruido), TOLEMAX),
+//  onde ruido combina o MAD relativo da base e da execucao corrente; uma
+//  regressao de TOLEMAX nunca e aceita como ruido. Uma medida mais lenta e
+//  repetida NRETRY vezes antes de ser reprovada.
+//
+//  Uso:
+//      IsothermPerf --baseline baseline.json             verifica
+//      IsothermPerf --baseline baseline.json --update    regrava a base
+//  Opcoes: --filter <texto> mede somente os nomes que contem o texto;
+//          --tolerance <x> substitui TOLE.
+//  Retorna 1 se alguma medida ficou mais lenta que a base.
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Langmuir.h>                // ist::Langmuir
+#include <Kinetics/Avrami.h>                                // ist::Avrami
+#include <Kinetics/ElovichKinetic.h>                        // ist::ElovichKinetic
+#include <Kinetics/PseudoFirstOrder.h>                      // ist::PseudoFirstOrder
+#include <Kinetics/PseudoSecondOrder.h>                     // ist::PseudoSecondOrder
+#include <Kinetics/WeberMorris.h>                           // ist::WeberMorris
+#include <Process/Breakthrough.h>                           // ist::Breakthrough
+
+//==============================================================================
+// Casos
+//==============================================================================
+
+#include "Cases.h"                                          // bench::CASES
+
+namespace {
+
+using bench::CASES;
+using bench::Create;
+
+const size_t    NBATCH  = 1024;         // pontos de Qe em lote
+const size_t    NPTO    = 64;           // pontos da isoterma inversa
+const size_t    NDATA   = 9;            // conjuntos de dados por modelo cinetico
+const size_t    NTIME   = 40;           // instantes de cada conjunto
+const size_t    NSAMPLE = 31;           // amostras por medida
+const Real      TSAMPLE = 1.0e6;        // duracao minima de uma amostra (ns)
+const Real      TOLE    = 0.10;         // tolerancia minima
+const Real      TOLEMAX = 0.20;         // tolerancia maxima
+const Real      NSIGMA  = 3.0;          // numero de desvios do ruido
+const UInt      NRETRY  = 2;            // repeticoes de uma medida mais lenta
+const size_t    NCAL    = 1024;         // operacoes da calibracao
+
+//  Minimo do tempo (ns por operacao), razao entre os minimos do tempo e da
+//  calibracao, e MAD das razoes por amostra
+
+struct Result {
+    std::string     name;
+    Real            time;
+    Real            ratio;
+    Real            mad;
+};
+
+//  Medida: numero de operacoes de cada chamada e a funcao, que retorna um
+//  valor acumulado em sink
+
+struct Workload {
+    std::string                 name;
+    size_t                      nop;
+    std::function<Real()>       run;
+};
+
+volatile Real   sink;
+
+//==============================================================================
+// Medidas
+//==============================================================================
+
+Real Median (std::vector<Real> _value)
+{
+const size_t    n (_value.size() / 2);
+
+    std::nth_element(_value.begin(), _value.begin() + n, _value.end());
+
+    return _value[n];
+}
+
+//  Tempo de _reps chamadas, em ns por operacao
+
+Real Time (const Workload& _work, const size_t& _reps)
+{
+Real        acc (0.0);
+const auto  tic (std::chrono::steady_clock::now());
+
+    for (size_t r = 0; r < _reps; ++r) acc += _work.run();
+
+const auto  toc (std::chrono::steady_clock::now());
+
+    sink = acc;
+
+    return std::chrono::duration<Real, std::nano>(toc - tic).count() / static_cast<Real>(_reps * _work.nop);
+}
+
+//  Numero de chamadas para que uma amostra dure TSAMPLE
+
+size_t Repetitions (const Workload& _work)
+{
+size_t  reps (1);
+
+    while (Time(_work, reps) * static_cast<Real>(reps * _work.nop) < TSAMPLE && reps < (size_t(1) << 24)) reps *= 2;
+
+    return reps;
+}
+
+const Workload  CALIBRATION {   "Calibracao"
+                            ,   NCAL
+                            ,   []() {
+                                    Real    x (1.0);
+                                    for (size_t k = 0; k < NCAL; ++k) x = std::log(1.0 + std::exp(-x)) + std::sqrt(x + 1.0);
+                                    return x;
+                                }
+                            };
+
+Result Measure (const Workload& _work)
+{
+
+static const size_t     repsCal (Repetitions(CALIBRATION));
+const size_t            reps (Repetitions(_work));
+std::vector<Real>       time (NSAMPLE);
+std::vector<Real>       cal (NSAMPLE);
+std::vector<Real>       ratio (NSAMPLE);
+
+    for (size_t k = 0; k < NSAMPLE; ++k) {
+        cal[k]   = Time(CALIBRATION, repsCal);
+        time[k]  = Time(_work, reps);
+        ratio[k] = time[k] / cal[k];
+    }
+
+const Real              tmin (*std::min_element(time.begin(), time.end()));
+const Real              cmin (*std::min_element(cal.begin(), cal.end()));
+const Real              median (Median(ratio));
+
+    for (Real& r : ratio) r = std::fabs(r - median);
+
+    return {_work.name, tmin, tmin / cmin, Median(ratio)};
+
+}
+
+const Workload& Find (const std::vector<Workload>& _work, const std::string& _name)
+{
+    return *std::find_if(_work.begin(), _work.end(), [&](const Workload& _w) {return _w.name == _name;});
+}
+
+//==============================================================================
+// Carga de trabalho
+//==============================================================================
+
+std::vector<Real> Grid (const Real& _ce, const size_t& _n)
+{
+std::vector<Real>   ce (_n);
+
+    for (size_t k = 0; k < _n; ++k) ce[k] = _ce * (0.5 + static_cast<Real>(k) / (_n - 1));
+
+    return ce;
+}
+
+typedef std::unique_ptr < ist::Kinetics > (*KineticFactory) (const ist::VecReal&);
+
+struct KineticCase {
+    std::string         model;
+    ist::VecReal        coef;
+    KineticFactory      create;
+};
+
+//  Coeficientes dos testes de cada modelo cinetico
+
+const std::vector < KineticCase >   KINETICS    {
+    {"PseudoFirstOrder",    {2.0, 0.05},        [](const ist::VecReal& _p) -> std::unique_ptr<ist::Kinetics> {return std::make_unique<ist::PseudoFirstOrder>(_p[0], _p[1]);}}
+,   {"PseudoSecondOrder",   {2.0, 0.02},        [](const ist::VecReal& _p) -> std::unique_ptr<ist::Kinetics> {return std::make_unique<ist::PseudoSecondOrder>(_p[0], _p[1]);}}
+,   {"Avrami",              {2.0, 0.03, 1.5},   [](const ist::VecReal& _p) -> std::unique_ptr<ist::Kinetics> {return std::make_unique<ist::Avrami>(_p[0], _p[1], _p[2]);}}
+,   {"ElovichKinetic",      {0.5, 2.0},         [](const ist::VecReal& _p) -> std::unique_ptr<ist::Kinetics> {return std::make_unique<ist::ElovichKinetic>(_p[0], _p[1]);}}
+,   {"WeberMorris",         {0.2, 0.3},         [](const ist::VecReal& _p) -> std::unique_ptr<ist::Kinetics> {return std::make_unique<ist::WeberMorris>(_p[0], _p[1]);}}
+};
+
+std::vector < Workload > Workloads ()
+{
+
+std::vector < Workload >    work;
+
+//  Qe em lote e isoterma inversa de cada modelo
+
+    for (const auto& c : CASES) {
+
+    std::shared_ptr<ist::Isotherm>  iso (Create(c));
+    auto                            ce (std::make_shared<std::vector<Real>>(Grid(c.easy, NBATCH)));
+    auto                            qe (std::make_shared<std::vector<Real>>(NBATCH));
+    auto                            qinv (std::make_shared<std::vector<Real>>(Grid(c.easy, NPTO)));
+
+        for (Real& q : *qinv) q = iso->Qe(q, c.temp);
+
+        work.push_back  (   {   "Qe/" + c.model
+                            ,   NBATCH
+                            ,   [iso, ce, qe, temp = c.temp]() {
+                                    iso->Qe(*ce, *qe, temp);
+                                    return qe->back();
+                                }
+                            }
+                        );
+
+        work.push_back  (   {   "Ce/" + c.model
+                            ,   NPTO
+                            ,   [iso, qinv, temp = c.temp]() {
+                                    Real    acc (0.0);
+                                    for (const Real q : *qinv) acc += iso->Ce(q, temp);
+                                    return acc;
+                                }
+                            }
+                        );
+    }
+
+//  Triagem de ajustes: NDATA conjuntos para cada modelo cinetico, com os
+//  coeficientes multiplicados por 0.6 ... 1.4 e partida com erro de 30%
+
+    for (const auto& k : KINETICS) {
+
+    auto    time (std::make_shared<ist::VecReal>(NTIME));
+    auto    data (std::make_shared<std::vector<ist::VecReal>>(NDATA, ist::VecReal(NTIME)));
+    auto    guess (std::make_shared<std::vector<ist::VecReal>>(NDATA, k.coef));
+
+        for (size_t n = 0; n < NTIME; ++n) (*time)[n] = 2.0 * n;
+
+        for (size_t d = 0; d < NDATA; ++d) {
+
+        ist::VecReal    coef (k.coef);
+
+            for (size_t i = 0; i < coef.size(); ++i) {
+                coef[i] *= 0.6 + 0.1 * d;
+                (*guess)[d][i] = coef[i] * (i % 2 == 0 ? 1.3 : 0.7);
+            }
+
+            k.create(coef)->Qt(*time, (*data)[d]);
+        }
+
+        work.push_back  (   {   "Fit/" + k.model
+                            ,   NDATA
+                            ,   [time, data, guess, create = k.create]() {
+                                    Real    acc (0.0);
+                                    for (size_t d = 0; d < NDATA; ++d) acc += create((*guess)[d])->Fit(*time, (*data)[d]);
+                                    return acc;
+                                }
+                            }
+                        );
+    }
+
+//  Coluna de leito fixo com isoterma de Langmuir
+
+    work.push_back  (   {   "Breakthrough/Langmuir"
+                        ,   1
+                        ,   []() {
+                                const ist::Langmuir     iso (3.26828, 0.910566);
+                                ist::Breakthrough       column (iso, 0.5, 1.0e-2, 1.0e-5, 1.5, 0.5, 200);
+                                column.Run(1.0, 2.0, 200);
+                                return column.Outlet().back();
+                            }
+                        }
+                    );
+
+    return work;
+
+}
+
+//==============================================================================
+// Base em JSON, uma medida por linha
+//==============================================================================
+
+std::string Number (const Real& _value)
+{
+char        buffer[32];
+const auto  res (std::to_chars(buffer, buffer + sizeof(buffer), _value));
+
+    return std::string(buffer, res.ptr);
+}
+
+void Save (const std::string& _file, const std::vector<Result>& _result)
+{
+std::ofstream   out (_file);
+
+    out << "[";
+
+    for (size_t k = 0; k < _result.size(); ++k)
+        out << (k > 0 ? ",\n" : "\n")
+            << "{\"name\":\"" << _result[k].name
+            << "\",\"time\":" << Number(_result[k].time)
+            << ",\"ratio\":" << Number(_result[k].ratio)
+            << ",\"mad\":" << Number(_result[k].mad)
+            << "}";
+
+    out << "\n]\n";
+
+    if (!out) {
+        std::cerr << "IsothermPerf: erro na gravacao de " << _file << "\n";
+        exit(EXIT_FAILURE);
+    }
+}
+
+//  Valor numerico apos _key na linha, ou NaN
+
+Real Field (const std::string& _line, const std::string& _key)
+{
+const size_t    pos (_line.find("\"" + _key + "\":"));
+Real            value (std::nan(""));
+
+    if (pos != std::string::npos) {
+    const char*     ini (_line.data() + pos + _key.size() + 3);
+        std::from_chars(ini, _line.data() + _line.size(), value);
+    }
+
+    return value;
+}
+
+std::map < std::string, Result > Load (const std::string& _file)
+{
+std::ifstream                       in (_file);
+std::map < std::string, Result >    base;
+std::string                         line;
+
+    if (!in) {
+        std::cerr << "IsothermPerf: base " << _file << " nao encontrada; use --update para cria-la\n";
+        exit(EXIT_FAILURE);
+    }
+
+    while (std::getline(in, line)) {
+
+    const std::string   key ("\"name\":\"");
+    const size_t        ini (line.find(key));
+
+        if (ini == std::string::npos) continue;
+
+    const size_t        fim (line.find('"', ini + key.size()));
+    Result              res {line.substr(ini + key.size(), fim - ini - key.size()), Field(line, "time"), Field(line, "ratio"), Field(line, "mad")};
+
+        if (fim == std::string::npos || !(res.ratio > 0.0) || !(res.mad >= 0.0)) {
+            std::cerr << "IsothermPerf: linha invalida em " << _file << ": " << line << "\n";
+            exit(EXIT_FAILURE);
+        }
+
+        base[res.name] = res;
+    }
+
+    return base;
+}
+
+//==============================================================================
+// Comparacao
+//==============================================================================
+
+struct Check {
+    Real    ratio;
+    Real    limit;
+};
+
+Check Compare   (   const Result&   _cur
+                ,   const Result&   _base
+                ,   const Real&     _tole
+                )
+{
+const Real  rcur (_cur.mad / _cur.ratio);
+const Real  rbase (_base.mad / _base.ratio);
+
+//  1.4826 MAD estima o desvio padrao de uma distribuicao normal
+
+const Real  noise (1.4826 * std::sqrt(rcur * rcur + rbase * rbase));
+
+    return {_cur.ratio / _base.ratio, std::min(std::max(_tole, NSIGMA * noise), std::max(_tole, TOLEMAX))};
+}
+
+}
+
+//==============================================================================
+// Programa
+//==============================================================================
+
+int main (int argc, char** argv)
+{
+
+std::string     baseline;
+std::string     filter;
+bool            update (false);
+Real            tole (TOLE);
+
+    for (int k = 1; k < argc; ++k) {
+
+        if (!std::strcmp(argv[k], "--baseline") && k + 1 < argc) baseline = argv[++k];
+        else if (!std::strcmp(argv[k], "--filter") && k + 1 < argc) filter = argv[++k];
+        else if (!std::strcmp(argv[k], "--tolerance") && k + 1 < argc) tole = std::atof(argv[++k]);
+        else if (!std::strcmp(argv[k], "--update")) update = true;
+        else {
+            std::cerr << "Uso: IsothermPerf --baseline <arquivo> [--update] [--filter <texto>] [--tolerance <x>]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (baseline.empty()) {
+        std::cerr << "IsothermPerf: informe a base com --baseline\n";
+        return EXIT_FAILURE;
+    }
+
+//  Medidas
+
+const auto              work (Workloads());
+std::vector<Result>     result;
+
+    for (const auto& w : work)
+        if (w.name.find(filter) != std::string::npos) result.push_back(Measure(w));
+
+    if (update) {
+
+    std::map < std::string, Result >    base;
+
+//  Com --filter, as demais medidas da base sao mantidas
+
+        if (!filter.empty()) base = Load(baseline);
+
+        for (const auto& r : result) base[r.name] = r;
+
+    std::vector<Result>     all;
+
+        for (const auto& w : work)
+            if (base.count(w.name)) all.push_back(base[w.name]);
+
+        Save(baseline, all);
+
+        std::cout << "IsothermPerf: " << all.size() << " medidas gravadas em " << baseline << "\n";
+
+        return EXIT_SUCCESS;
+    }
+
+//  Comparacao com a base
+
+const auto      base (Load(baseline));
+size_t          nslow (0);
+
+    std::cout   << std::left  << std::setw(32) << "Medida"
+                << std::right << std::setw(12) << "Base (ns)"
+                              << std::setw(12) << "Atual (ns)"
+                              << std::setw(9)  << "Razao"
+                              << std::setw(9)  << "Limite"
+                              << "  Situacao\n";
+
+    for (auto& cur : result) {
+
+    const auto      it (base.find(cur.name));
+    std::string     status ("nova");
+    Check           check {1.0, 0.0};
+
+        if (it != base.end()) {
+
+            check = Compare(cur, it->second, tole);
+
+//  Medida mais lenta: repetida, guardada a melhor razao
+
+            for (UInt r = 0; r < NRETRY && check.ratio > 1.0 + check.limit; ++r) {
+
+            const Result    again (Measure(Find(work, cur.name)));
+            const Check     retry (Compare(again, it->second, tole));
+
+                if (retry.ratio < check.ratio) {
+                    cur = again;
+                    check = retry;
+                }
+            }
+
+            if (check.ratio > 1.0 + check.limit) {
+                status = "MAIS LENTA";
+                ++nslow;
+            }
+            else if (check.ratio < 1.0 / (1.0 + check.limit)) status = "mais rapida";
+            else status = "ok";
+        }
+
+        std::cout   << std::left  << std::setw(32) << cur.name
+                    << std::right << std::setw(12) << std::fixed << std::setprecision(1) << (it != base.end() ? it->second.time : 0.0)
+                                  << std::setw(12) << cur.time
+                                  << std::setw(9)  << std::setprecision(3) << check.ratio
+                                  << std::setw(9)  << check.limit
+                                  << "  " << status << "\n";
+    }
+
+    std::cout << "\nIsothermPerf: " << result.size() << " medidas, " << nslow << " mais lentas que a base\n";
+
+    return nslow > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
@@ -86,6 +86,15 @@ enum IsoExceptionIndex {
     ,   BadThetaGEOne
     ,   BadThetaLEZero
     ,   BadKCeK1LEOne
+    ,   BadNumberComponents
+    ,   BadCompositionSize
+    ,   BadEtaLEZero
+    ,   BadRange
+    ,   BadFile
+    ,   BadParameter
+    ,   BadTimeLTZero
+    ,   BadQeLTZero
+    ,   BadQeRange
 
         
 };
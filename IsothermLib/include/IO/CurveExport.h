@@ -0,0 +1,464 @@
+//==============================================================================
+// Name        : CurveExport.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Gravacao de curvas de isotermas em texto ou binario
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup CurveExport CurveExport
+ *  @ingroup IO
+ *  Gravacao de curvas de isotermas.
+ *  @{
+ */
+
+/// <summary>
+/// Gravacao de curvas (x, y) de uma isoterma sobre uma malha de Ce linear ou
+/// logaritmica, substituta de Isotherm::PlotGraph para curvas grandes.
+/// </summary>
+///  Qe e avaliada em blocos pela funcao em bloco do modelo; as funcoes de
+///  escala dos eixos sao parametros de template, de modo que o compilador
+///  pode expandi-las no laco. Cada bloco e convertido para o formato de
+///  saida num buffer e gravado com uma unica escrita.
+///
+///  Formatos:
+///  - Text: duas colunas separadas por tabulacao, com a menor representacao
+///    decimal que reproduz o valor (std::to_chars);
+///  - Binary: pares (x, y) em float64, sem cabecalho;
+///  - Columnar: cabecalho (Header) seguido da coluna x e da coluna y, em
+///    float64.
+///
+///  Familias de curvas (varios modelos, temperaturas ou conjuntos de
+///  coeficientes) sao avaliadas em paralelo, uma tarefa por curva, e
+///  gravadas num unico arquivo largo, com a coluna Ce seguida de uma coluna
+///  por curva, ou num arquivo por curva. No arquivo largo cada bloco de
+///  linhas e gravado por uma tarefa assincrona enquanto o bloco seguinte e
+///  avaliado, com dois buffers alternados.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __CURVE_EXPORT_H__
+#define __CURVE_EXPORT_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <algorithm>        // std::min
+#include <cstdint>          // std::uint64_t
+#include <fstream>          // std::ofstream
+#include <future>           // std::async
+#include <memory>           // std::unique_ptr
+#include <span>             // std::span
+#include <string>           // std::string
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+#include <Misc/ThreadPool.h>
+
+IST_NAMESPACE_OPEN
+
+class CurveExport {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "CurveExport"
+                        ,   ID::CurveExport
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Distribuicao dos pontos de Ce.
+/// </summary>
+    enum class Grid {Linear, Log};
+
+/// <summary>
+/// Formato do arquivo gravado.
+/// </summary>
+    enum class Format {Text, Binary, Columnar};
+
+/// <summary>
+/// Cabecalho do formato Columnar.
+/// </summary>
+    struct Header {
+        char            magic[8];
+        std::uint64_t   npto;
+        std::uint64_t   ncol;
+    };
+
+/// <summary>
+/// Curva de uma familia: modelo, temperatura e nome, usado no cabecalho do
+/// arquivo largo em texto e no nome do arquivo de cada curva. O modelo e
+/// copiado por Clone antes da avaliacao.
+/// </summary>
+    struct Curve {
+        const Isotherm*     iso;
+        Real                temperature = 0;
+        std::string         name;
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    CurveExport() = default;
+
+    CurveExport(const CurveExport&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~CurveExport() = default;
+
+/// <summary>
+/// Construtora com a malha de Ce. Os extremos pertencem a malha.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir        iso(qmax, k1);
+///     CurveExport     curve(1000000, 1.0e-4, 1.0e2, CurveExport::Grid::Log);
+///     curve.Write(iso, "langmuir.dat");
+/// @endcode
+/// </example>
+///  @param _npto Numero de pontos.
+///  @param _xini Valor inicial de Ce.
+///  @param _xfim Valor final de Ce.
+///  @param _grid Malha linear ou logaritmica.
+///  @exception _npto < 2, _xfim <= _xini ou _xini <= 0 na malha logaritmica.
+    CurveExport (   const size_t&
+                ,   const Real&
+                ,   const Real&
+                ,   const Grid& = Grid::Linear);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    CurveExport& operator = (const CurveExport&) = default;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Grava a curva (_eixoX(qe, ce), _eixoY(qe, ce)) da isoterma.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     curve.Write (   iso
+///                 ,   "ln.dat"
+///                 ,   [](const Real&, const Real& _c) {return std::log(_c);}
+///                 ,   [](const Real& _q, const Real&) {return std::log(_q);}
+///                 ,   CurveExport::Format::Binary
+///                 );
+/// @endcode
+/// </example>
+///  @param _iso Isoterma.
+///  @param _file Nome do arquivo.
+///  @param _eixoX Escala do eixo x, funcao de (qe, ce).
+///  @param _eixoY Escala do eixo y, funcao de (qe, ce).
+///  @param _format Formato do arquivo.
+///  @param _temperature Temperatura, opcional.
+///  @exception Malha nao definida ou erro de escrita no arquivo.
+    template < typename EixoX, typename EixoY >
+    void Write  (   const Isotherm&     _iso
+                ,   const std::string&  _file
+                ,   EixoX&&             _eixoX
+                ,   EixoY&&             _eixoY
+                ,   const Format&       _format = Format::Text
+                ,   const Real&         _temperature = 0) const
+    {
+
+    std::ofstream   out (Open(_file, _format));
+    VecReal         qe (std::min(BLOCK, ce.size()));
+    VecReal         x (qe.size());
+    VecReal         y (qe.size());
+    std::string     buffer;
+
+        for (size_t ini = 0; ini < ce.size(); ini += BLOCK) {
+
+        const size_t                n (std::min(BLOCK, ce.size() - ini));
+        const std::span<const Real> c (ce.data() + ini, n);
+
+            _iso.Qe(c, std::span<Real>(qe.data(), n), _temperature);
+
+            for (size_t k = 0; k < n; ++k) {
+                x[k] = _eixoX(qe[k], c[k]);
+                y[k] = _eixoY(qe[k], c[k]);
+            }
+
+            Append(out, _file, _format, ini, std::span<const Real>(x.data(), n), std::span<const Real>(y.data(), n), buffer);
+        }
+
+        Close(out, _file);
+
+    }
+
+/// <summary>
+/// Grava a curva (Ce, Qe) da isoterma.
+/// </summary>
+    void Write  (   const Isotherm&     _iso
+                ,   const std::string&  _file
+                ,   const Format&       _format = Format::Text
+                ,   const Real&         _temperature = 0) const
+    {
+        Write   (   _iso
+                ,   _file
+                ,   [](const Real&, const Real& _c) {return _c;}
+                ,   [](const Real& _q, const Real&) {return _q;}
+                ,   _format
+                ,   _temperature
+                );
+    }
+
+/// <summary>
+/// Grava uma familia de curvas num unico arquivo largo: a coluna Ce e uma
+/// coluna _eixoY(Qe, Ce) por curva, na ordem de _curves.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     std::vector<CurveExport::Curve>     curves;
+///     for (const Real t : temp) curves.push_back({&iso, t, std::to_string(t)});
+///     CurveExport(1000, 0.01, 10.0).Write(curves, "familia.dat");
+/// @endcode
+/// </example>
+///  Formatos: Text, com uma linha de cabecalho iniciada por '#' com os
+///  nomes; Binary, linhas de 1 + _curves.size() valores; Columnar,
+///  cabecalho com ncol = 1 + _curves.size() seguido das colunas.
+///  @param _curves Curvas.
+///  @param _file Arquivo.
+///  @param _eixoY Escala do eixo y.
+///  @param _format Formato.
+///  @param _pool Threads utilizadas na avaliacao.
+    template < typename EixoY >
+    void Write  (   std::span<const Curve>  _curves
+                ,   const std::string&      _file
+                ,   EixoY&&                 _eixoY
+                ,   const Format&           _format = Format::Text
+                ,   ThreadPool&             _pool = ThreadPool::Default()) const
+    {
+
+    const size_t        ncurve (_curves.size());
+    const auto          models (CloneModels(_curves));
+    std::ofstream       out (Open(_file, _format, 1 + ncurve));
+    VecReal             block[2];
+    std::string         buffer;
+    std::future<void>   pending;
+
+        if (_format == Format::Text) WriteHeader(out, _file, _curves);
+
+        for (auto& b : block) b.resize(ncurve * std::min(BLOCK, ce.size()));
+
+        for (size_t ini = 0, ib = 0; ini < ce.size(); ini += BLOCK, ib ^= 1) {
+
+        const size_t                n (std::min(BLOCK, ce.size() - ini));
+        const std::span<const Real> c (ce.data() + ini, n);
+        VecReal&                    y (block[ib]);
+
+//  Curva _k nas posicoes [_k n, (_k + 1) n) do bloco
+
+            _pool.Run   (   ncurve
+                        ,   [&](const size_t& _k, const UInt&) {
+
+                            const std::span<Real>   qe (y.data() + _k * n, n);
+
+                                models[_k]->Qe(c, qe, _curves[_k].temperature);
+
+                                for (size_t k = 0; k < n; ++k) qe[k] = _eixoY(qe[k], c[k]);
+                            }
+                        );
+
+//  A gravacao do bloco anterior termina antes da gravacao deste, que usa o
+//  outro buffer
+
+            if (pending.valid()) pending.get();
+
+            pending = std::async    (   std::launch::async
+                                    ,   [this, &out, &_file, _format, ini, c, &y, ncurve, &buffer]() {
+                                            Append(out, _file, _format, ini, c, std::span<const Real>(y.data(), ncurve * c.size()), ncurve, buffer);
+                                        }
+                                    );
+        }
+
+        if (pending.valid()) pending.get();
+
+        Close(out, _file);
+
+    }
+
+    void Write  (   std::span<const Curve>  _curves
+                ,   const std::string&      _file
+                ,   const Format&           _format = Format::Text
+                ,   ThreadPool&             _pool = ThreadPool::Default()) const
+    {
+        Write   (   _curves
+                ,   _file
+                ,   [](const Real& _q, const Real&) {return _q;}
+                ,   _format
+                ,   _pool
+                );
+    }
+
+/// <summary>
+/// Grava cada curva da familia no seu proprio arquivo, _prefix + nome, como
+/// Write de uma unica curva. Cada tarefa avalia e grava uma curva, de modo
+/// que a gravacao de uma curva coincide com a avaliacao das outras.
+/// </summary>
+///  @param _curves Curvas.
+///  @param _prefix Inicio do nome dos arquivos (diretorio e prefixo).
+///  @param _eixoX Escala do eixo x.
+///  @param _eixoY Escala do eixo y.
+///  @param _format Formato.
+///  @param _pool Threads utilizadas.
+    template < typename EixoX, typename EixoY >
+    void WriteFiles (   std::span<const Curve>  _curves
+                    ,   const std::string&      _prefix
+                    ,   EixoX&&                 _eixoX
+                    ,   EixoY&&                 _eixoY
+                    ,   const Format&           _format = Format::Text
+                    ,   ThreadPool&             _pool = ThreadPool::Default()) const
+    {
+
+    const auto  models (CloneModels(_curves));
+
+        _pool.Run   (   _curves.size()
+                    ,   [&](const size_t& _k, const UInt&) {
+                            Write(*models[_k], _prefix + _curves[_k].name, _eixoX, _eixoY, _format, _curves[_k].temperature);
+                        }
+                    );
+
+    }
+
+    void WriteFiles (   std::span<const Curve>  _curves
+                    ,   const std::string&      _prefix
+                    ,   const Format&           _format = Format::Text
+                    ,   ThreadPool&             _pool = ThreadPool::Default()) const
+    {
+        WriteFiles  (   _curves
+                    ,   _prefix
+                    ,   [](const Real&, const Real& _c) {return _c;}
+                    ,   [](const Real& _q, const Real&) {return _q;}
+                    ,   _format
+                    ,   _pool
+                    );
+    }
+
+//==============================================================================
+// Acesso aos dados
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Valores de Ce da malha.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Ce () const {return ce;};
+
+    [[nodiscard]] inline size_t NumberPoints () const {return ce.size();};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Numero de pontos avaliados e gravados de cada vez.
+/// </summary>
+    inline static const size_t BLOCK = 8192;
+
+/// <summary>
+/// Abre o arquivo e, no formato Columnar, grava o cabecalho.
+/// </summary>
+    [[nodiscard]] std::ofstream Open    (   const std::string&
+                                        ,   const Format&
+                                        ,   const size_t& = 2) const;
+
+/// <summary>
+/// Grava os pontos _ini, ..., _ini + _x.size() - 1 da curva.
+/// </summary>
+    void Append (   std::ofstream&
+                ,   const std::string&
+                ,   const Format&
+                ,   const size_t&
+                ,   std::span<const Real>
+                ,   std::span<const Real>
+                ,   std::string&) const;
+
+    void Append (   std::ofstream&
+                ,   const std::string&
+                ,   const Format&
+                ,   const size_t&
+                ,   std::span<const Real>
+                ,   std::span<const Real>
+                ,   const size_t&
+                ,   std::string&) const;
+
+    void WriteHeader    (   std::ofstream&
+                        ,   const std::string&
+                        ,   std::span<const Curve>) const;
+
+    [[nodiscard]] static std::vector < std::unique_ptr<Isotherm> > CloneModels (std::span<const Curve>);
+
+    void Close  (   std::ofstream&
+                ,   const std::string&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+VecReal                     ce;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __CURVE_EXPORT_H__ */
+
+/** @} */
@@ -0,0 +1,265 @@
+//==============================================================================
+// Name        : Dataset.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Leitura de dados experimentais de equilibrio (CSV/TSV)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup Dataset Dataset
+ *  @ingroup IO
+ *  Dados experimentais de equilibrio.
+ *  @{
+ */
+
+/// <summary>
+/// Conjunto de pontos experimentais (Ce, qe, T, peso) lidos de arquivos com
+/// colunas delimitadas (CSV, TSV), guardados em vetores separados por
+/// grandeza, prontos para a avaliacao em bloco de Qe e para ajustes.
+/// </summary>
+///  O arquivo e mapeado em memoria e dividido em blocos de linhas, lidos em
+///  paralelo com std::from_chars. Layout indica o delimitador, as linhas de
+///  cabecalho e, para cada grandeza, a coluna do arquivo (a partir de 0) e a
+///  conversao de unidade, valor = scale * lido + offset. Ce e qe sao
+///  obrigatorias; sem coluna, T vale offset, o peso vale 1 e a serie 0.
+///  Linhas vazias e linhas iniciadas pelo caractere de comentario sao
+///  ignoradas. Com delimitador ' ', espacos e tabulacoes consecutivos
+///  separam uma unica coluna.
+///
+///  Os pontos sao ordenados, de forma estavel, por serie e temperatura, e
+///  Groups() lista os trechos contiguos com a mesma serie e temperatura.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __DATASET_H__
+#define __DATASET_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <span>             // std::span
+#include <string>           // std::string
+#include <string_view>      // std::string_view
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class Dataset {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Dataset"
+                        ,   ID::Dataset
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Coluna do arquivo e conversao de unidade de uma grandeza. index < 0
+/// indica que a grandeza nao esta no arquivo.
+/// </summary>
+    struct Column {
+        int             index   = -1;
+        Real            scale   = 1.0;
+        Real            offset  = 0.0;
+    };
+
+/// <summary>
+/// Formato do arquivo.
+/// </summary>
+    struct Layout {
+        char            delimiter   = ',';
+        char            comment     = '#';
+        UInt            skip        = 0;        //! Linhas de cabecalho
+        Column          ce          {0};
+        Column          qe          {1};
+        Column          temperature;
+        Column          weight;
+        Column          series;
+    };
+
+/// <summary>
+/// Trecho [begin, end) dos pontos com a mesma serie e temperatura.
+/// </summary>
+    struct Group {
+        Real            series;
+        Real            temperature;
+        size_t          begin;
+        size_t          end;
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    Dataset() = default;
+
+    Dataset(const Dataset&) = default;
+    Dataset(Dataset&&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~Dataset() = default;
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    Dataset& operator = (const Dataset&) = default;
+    Dataset& operator = (Dataset&&) = default;
+
+//==============================================================================
+// Leitura
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Le um arquivo, mapeado em memoria.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Dataset::Layout     layout;
+///     layout.delimiter          = '\t';
+///     layout.skip               = 1;
+///     layout.temperature.index  = 2;
+///     layout.temperature.offset = 273.15;
+///     Dataset             data (Dataset::Load("isotermas.tsv", layout));
+///     for (const auto& group : data.Groups())
+///         iso.Qe(data.Ce(group), qe, group.temperature);
+/// @endcode
+/// </example>
+///  @param _file Nome do arquivo.
+///  @param _layout Formato do arquivo.
+///  @param _nthreads Numero de threads. 0 utiliza todos os nucleos.
+///  @exception Arquivo inexistente, Ce ou qe sem coluna, ou linha com
+///  coluna ausente ou valor nao numerico.
+    [[nodiscard]] static Dataset Load   (   const std::string&
+                                        ,   const Layout&
+                                        ,   const UInt& = 0);
+
+/// <summary>
+/// Le o conteudo de um arquivo ja em memoria.
+/// </summary>
+    [[nodiscard]] static Dataset Parse  (   std::string_view
+                                        ,   const Layout&
+                                        ,   const UInt& = 0);
+
+//==============================================================================
+// Acesso aos dados
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline size_t NumberPoints () const {return ce.size();};
+
+    [[nodiscard]] inline std::span<const Real> Ce () const {return ce;};
+    [[nodiscard]] inline std::span<const Real> Qe () const {return qe;};
+    [[nodiscard]] inline std::span<const Real> Temperature () const {return temperature;};
+    [[nodiscard]] inline std::span<const Real> Weight () const {return weight;};
+    [[nodiscard]] inline std::span<const Real> Series () const {return series;};
+
+/// <summary>
+/// Trechos com a mesma serie e temperatura, em ordem crescente.
+/// </summary>
+    [[nodiscard]] inline const std::vector < Group >& Groups () const {return groups;};
+
+    [[nodiscard]] inline std::span<const Real> Ce (const Group& _group) const
+    {
+        return Ce().subspan(_group.begin, _group.end - _group.begin);
+    };
+
+    [[nodiscard]] inline std::span<const Real> Qe (const Group& _group) const
+    {
+        return Qe().subspan(_group.begin, _group.end - _group.begin);
+    };
+
+    [[nodiscard]] inline std::span<const Real> Weight (const Group& _group) const
+    {
+        return Weight().subspan(_group.begin, _group.end - _group.begin);
+    };
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Le as linhas de _text, que comeca no inicio de uma linha. Devolve false e
+/// a linha em _bad ao encontrar uma linha invalida.
+/// </summary>
+    [[nodiscard]] bool ParseBlock   (   std::string_view
+                                    ,   const Layout&
+                                    ,   std::string&);
+
+    void Append (const Dataset&);
+
+/// <summary>
+/// Ordena os pontos por serie e temperatura e monta os grupos.
+/// </summary>
+    void Sort ();
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+VecReal                     ce;
+VecReal                     qe;
+VecReal                     temperature;
+VecReal                     weight;
+VecReal                     series;
+std::vector < Group >       groups;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __DATASET_H__ */
+
+/** @} */
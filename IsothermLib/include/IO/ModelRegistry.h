@@ -0,0 +1,234 @@
+//==============================================================================
+// Name        : ModelRegistry.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Criacao de isotermas pelo ID ou pelo nome da classe
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ModelRegistry ModelRegistry
+ *  @ingroup IO
+ *  Criacao de isotermas pelo ID ou pelo nome da classe.
+ *  @{
+ */
+
+/// <summary>
+/// Tabela que associa classID() e className() de cada modelo a uma funcao
+/// que cria o modelo, de modo que uma isoterma pode ser criada a partir de
+/// ID::Toth ou de "Toth" e dos coeficientes, sem incluir o seu arquivo.
+/// </summary>
+///  Default() ja contem todos os modelos da biblioteca; modelos do usuario
+///  sao acrescentados por Register. A criacao usa a construtora default do
+///  modelo e SetParameters, de modo que os coeficientes sao verificados
+///  como nas construtoras. Nos modelos com constante dos gases, um valor
+///  alem dos coeficientes e a constante; sem ele, vale o valor padrao.
+///  Register e as consultas podem ser chamadas de varias
+///  threads.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __MODEL_REGISTRY_H__
+#define __MODEL_REGISTRY_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <shared_mutex>     // std::shared_mutex
+#include <span>             // std::span
+#include <string>           // std::string
+#include <string_view>      // std::string_view
+#include <unordered_map>    // std::unordered_map
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class ModelRegistry {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "ModelRegistry"
+                        ,   ID::ModelRegistry
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Funcao que cria o modelo com a construtora default.
+/// </summary>
+    typedef std::unique_ptr<Isotherm> (*Factory) ();
+
+    struct Entry {
+        UInt            id;
+        std::string     name;
+        Factory         create;
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default, com a tabela vazia.
+/// </summary>
+    ModelRegistry() = default;
+
+    ModelRegistry(const ModelRegistry&) = delete;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ModelRegistry() = default;
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ModelRegistry& operator = (const ModelRegistry&) = delete;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Tabela com todos os modelos da biblioteca.
+/// </summary>
+    [[nodiscard]] static ModelRegistry& Default ();
+
+/// <summary>
+/// Acrescenta um modelo. Um ID ja registrado e substituido.
+/// </summary>
+///  @param _id ID do modelo.
+///  @param _name Nome do modelo.
+///  @param _create Funcao que cria o modelo.
+///  @exception _create nula.
+    void Register   (   const UInt&
+                    ,   const std::string&
+                    ,   Factory);
+
+/// <summary>
+/// Acrescenta o modelo T, com o ID e o nome da propria classe.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ModelRegistry::Default().Register<MeuModelo>();
+/// @endcode
+/// </example>
+    template < typename T >
+    void Register ()
+    {
+    const Factory   create ([]() -> std::unique_ptr<Isotherm> {return std::make_unique<T>();});
+    const auto      model (create());
+
+        Register(model->classID(), model->className(), create);
+    }
+
+/// <summary>
+/// Funcao que cria o modelo, ou nullptr se o modelo nao esta registrado.
+/// </summary>
+    [[nodiscard]] Factory Find (const UInt&) const;
+    [[nodiscard]] Factory Find (std::string_view) const;
+
+/// <summary>
+/// Cria o modelo com os coeficientes _par.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Real    par[] {2.76, 0.39, 0.57};
+///     auto    iso (ModelRegistry::Default().Create("Toth", par));
+///     Real    qe = iso->Qe(ce);
+/// @endcode
+/// </example>
+///  @param _id ID ou nome do modelo.
+///  @param _par Coeficientes, na ordem das construtoras, seguidos da
+///  constante dos gases nos modelos que a usam.
+///  @exception Modelo nao registrado, ou coeficientes em numero diferente
+///  do modelo ou invalidos.
+    [[nodiscard]] std::unique_ptr<Isotherm> Create  (   const UInt&
+                                                    ,   std::span<const Real>) const;
+
+    [[nodiscard]] std::unique_ptr<Isotherm> Create  (   std::string_view
+                                                    ,   std::span<const Real>) const;
+
+/// <summary>
+/// Altera os coeficientes de _iso como Create: um valor alem de
+/// NumberConst() e a constante dos gases.
+/// </summary>
+///  @exception Coeficientes em numero diferente do modelo ou invalidos.
+    static void SetParameters   (   Isotherm&
+                                ,   std::span<const Real>);
+
+/// <summary>
+/// Modelos registrados, em ordem de ID.
+/// </summary>
+    [[nodiscard]] std::vector < Entry > Entries () const;
+
+    [[nodiscard]] size_t Size () const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Hash de std::string que aceita std::string_view na busca.
+/// </summary>
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator () (std::string_view _name) const {return std::hash<std::string_view>()(_name);};
+    };
+
+mutable std::shared_mutex                                               mutex;
+std::unordered_map < UInt, Entry >                                      byID;
+std::unordered_map < std::string, UInt, NameHash, std::equal_to<> >     byName;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __MODEL_REGISTRY_H__ */
+
+/** @} */
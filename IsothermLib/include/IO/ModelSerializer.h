@@ -0,0 +1,228 @@
+//==============================================================================
+// Name        : ModelSerializer.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Gravacao e leitura de modelos ajustados em binario e JSON
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ModelSerializer ModelSerializer
+ *  @ingroup IO
+ *  Gravacao e leitura de modelos ajustados em binario e JSON.
+ *  @{
+ */
+
+/// <summary>
+/// Gravacao e leitura de conjuntos de isotermas: cada modelo e guardado
+/// pelo seu ID, nome e coeficientes, e recriado por ModelRegistry.
+/// </summary>
+///  Formato binario, na ordem de bytes da maquina:
+///  - Header: "ISTMOD01" e o numero de modelos (uint64);
+///  - para cada modelo: ID (uint32), numero de coeficientes (uint32) e os
+///    coeficientes (Real[ncoef]), seguidos da constante dos gases quando
+///    ela difere de Isotherm::RGASCONST.
+///
+///  Formato JSON, um modelo por linha:
+///  @code
+///     [
+///     {"model":"Toth","id":309,"coefficients":[2.76,0.39,0.57]},
+///     {"model":"Temkin","id":207,"coefficients":[0.88,0.73],"rgas":62.36}
+///     ]
+///  @endcode
+///  "rgas" so e gravada quando a constante dos gases difere de
+///  Isotherm::RGASCONST. Na leitura, "id" tem precedencia sobre "model",
+///  um dos dois e obrigatorio, chaves desconhecidas sao ignoradas e um
+///  objeto isolado, fora de um vetor, tambem e aceito.
+///  Os numeros sao gravados com std::to_chars, com a menor representacao
+///  que recupera o mesmo valor.
+///
+///  Parse e Load reconhecem o formato pelo inicio do texto. A leitura faz
+///  uma unica passagem pelo texto, sem copias intermediarias: cada modelo
+///  custa a alocacao do proprio objeto e dos seus coeficientes.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __MODEL_SERIALIZER_H__
+#define __MODEL_SERIALIZER_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <iterator>         // std::size
+#include <memory>           // std::unique_ptr
+#include <string>           // std::string
+#include <string_view>      // std::string_view
+#include <type_traits>      // std::is_base_of_v
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+#include <IO/ModelRegistry.h>
+
+IST_NAMESPACE_OPEN
+
+class ModelSerializer {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "ModelSerializer"
+                        ,   ID::ModelSerializer
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+    enum Format {Binary, Json};
+
+    typedef std::vector < std::unique_ptr<Isotherm> >   VecModel;
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ModelSerializer() = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ModelSerializer() = default;
+
+//==============================================================================
+// Gravacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Grava um conjunto de modelos num texto ou buffer binario.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     std::vector < PtrIsotherm > models;
+///     std::string json (ModelSerializer::Write(models, ModelSerializer::Json));
+/// @endcode
+/// </example>
+///  @param _models Conjunto de ponteiros (ou ponteiros inteligentes) para
+///  os modelos.
+///  @param _format Formato.
+///  @return Texto ou buffer gravado.
+    template < typename Range >
+        requires (!std::is_base_of_v<Isotherm, Range>)
+    [[nodiscard]] static std::string Write  (   const Range&    _models
+                                            ,   const Format&   _format
+                                            )
+    {
+    std::string     out;
+
+        Begin(out, _format, std::size(_models));
+
+        for (const auto& model : _models) Append(out, _format, *model);
+
+        End(out, _format);
+
+        return out;
+    }
+
+    [[nodiscard]] static std::string Write  (   const Isotherm&
+                                            ,   const Format&);
+
+/// <summary>
+/// Grava um conjunto de modelos num arquivo.
+/// </summary>
+///  @exception Erro de escrita.
+    template < typename Range >
+        requires (!std::is_base_of_v<Isotherm, Range>)
+    static void Save    (   const std::string&  _file
+                        ,   const Range&        _models
+                        ,   const Format&       _format
+                        )
+    {
+        Save(_file, Write(_models, _format));
+    }
+
+//==============================================================================
+// Leitura
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Recria os modelos de um texto JSON ou buffer binario.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     auto    models (ModelSerializer::Parse(json));
+///     Real    qe = models[0]->Qe(ce);
+/// @endcode
+/// </example>
+///  @param _text Texto ou buffer.
+///  @param _registry Tabela de modelos.
+///  @return Modelos, na ordem gravada.
+///  @exception Texto mal formado, modelo nao registrado ou coeficientes
+///  invalidos.
+    [[nodiscard]] static VecModel Parse (   std::string_view
+                                        ,   const ModelRegistry& = ModelRegistry::Default());
+
+/// <summary>
+/// Le um arquivo, mapeado em memoria.
+/// </summary>
+///  @exception Arquivo inexistente e os erros de Parse.
+    [[nodiscard]] static VecModel Load  (   const std::string&
+                                        ,   const ModelRegistry& = ModelRegistry::Default());
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    static void Begin (std::string&, const Format&, const size_t&);
+    static void Append (std::string&, const Format&, const Isotherm&);
+    static void End (std::string&, const Format&);
+
+    static void Save (const std::string&, const std::string&);
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __MODEL_SERIALIZER_H__ */
+
+/** @} */
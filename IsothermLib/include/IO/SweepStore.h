@@ -0,0 +1,379 @@
+//==============================================================================
+// Name        : SweepStore.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Arquivo binario em colunas para resultados de varreduras
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup SweepStore SweepStore
+ *  @ingroup IO
+ *  Arquivo binario em colunas para resultados de varreduras.
+ *  @{
+ */
+
+/// <summary>
+/// Gravacao (SweepWriter) e leitura (SweepReader) de resultados de
+/// varreduras de Qe em Ce x T x coeficientes, num arquivo binario dividido
+/// em blocos de colunas.
+/// </summary>
+///  Layout do arquivo, todo alinhado em 8 bytes:
+///  - Header, nome do modelo (char[32]), coeficientes (Real[ncoef]);
+///  - para cada eixo da malha, AxisHeader e os valores (Real[npto]);
+///  - nomes das colunas (char[16] cada);
+///  - blocos: ChunkHeader, minimos (Real[ncol]), maximos (Real[ncol]) e as
+///    colunas, uma apos a outra (Real[ncol][nrows]).
+///
+///  O escritor acrescenta blocos ao final do arquivo, inclusive de um
+///  arquivo ja existente. O leitor mapeia o arquivo em memoria, monta o
+///  indice dos blocos sem copiar os dados e permite descartar blocos pelos
+///  minimos e maximos das colunas, de modo que somente os trechos de
+///  interesse sao lidos do disco. Os minimos e maximos ignoram os NaN; uma
+///  coluna somente com NaN no bloco recebe -inf e +inf, e o bloco nunca e
+///  descartado. Um bloco incompleto no final do arquivo, deixado por uma
+///  gravacao interrompida, e ignorado.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __SWEEP_STORE_H__
+#define __SWEEP_STORE_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cstdint>          // std::uint64_t
+#include <fstream>          // std::ofstream
+#include <initializer_list> // std::initializer_list
+#include <memory>           // std::shared_ptr
+#include <span>             // std::span
+#include <string>           // std::string
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+/// <summary>
+/// Eixo da malha da varredura.
+/// </summary>
+struct SweepAxis {
+    std::string         name;
+    VecReal             values;
+};
+
+//==============================================================================
+// Formato do arquivo
+//==============================================================================
+
+namespace SweepFormat {
+
+    inline const char   MAGIC[8] = {'I', 'S', 'T', 'S', 'W', 'P', '0', '1'};
+
+    inline const size_t NAMESIZE = 16;      //! Nome de eixo ou coluna
+    inline const size_t MODELSIZE = 32;     //! Nome do modelo
+
+    struct Header {
+        char            magic[8];
+        std::uint32_t   model;
+        std::uint32_t   ncoef;
+        std::uint32_t   naxis;
+        std::uint32_t   ncol;
+        std::uint64_t   bytes;              //! Inicio do primeiro bloco
+    };
+
+    struct AxisHeader {
+        char            name[NAMESIZE];
+        std::uint64_t   npto;
+    };
+
+    struct ChunkHeader {
+        std::uint64_t   nrows;
+        std::uint64_t   bytes;              //! Tamanho do bloco
+    };
+
+}
+
+//==============================================================================
+// Gravacao
+//==============================================================================
+
+class SweepWriter {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "SweepWriter"
+                        ,   ID::SweepWriter
+                        );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    SweepWriter() = default;
+
+    SweepWriter(SweepWriter&&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~SweepWriter() = default;
+
+/// <summary>
+/// Cria o arquivo e grava o cabecalho.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     SweepWriter     writer  (   "toth.swp"
+///                             ,   toth
+///                             ,   {{"Ce", ce}, {"T", temp}}
+///                             ,   {"Ce", "T", "Qe"}
+///                             );
+///     writer.Append({ceBlock, tBlock, qeBlock});
+/// @endcode
+/// </example>
+///  @param _file Nome do arquivo.
+///  @param _iso Modelo, do qual sao gravados o ID, o nome e os coeficientes.
+///  @param _axes Eixos da malha.
+///  @param _columns Nomes das colunas.
+///  @exception Nenhuma coluna ou erro de escrita.
+    SweepWriter (   const std::string&
+                ,   const Isotherm&
+                ,   const std::vector < SweepAxis >&
+                ,   const std::vector < std::string >&);
+
+/// <summary>
+/// Abre um arquivo existente para acrescentar blocos. Um bloco incompleto
+/// no final do arquivo e removido.
+/// </summary>
+///  @exception Arquivo inexistente ou com cabecalho invalido.
+    explicit SweepWriter (const std::string&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    SweepWriter& operator = (SweepWriter&&) = default;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Acrescenta um bloco, com uma linha por ponto e uma coluna por span.
+/// </summary>
+///  @param _columns Colunas do bloco, todas com o mesmo tamanho.
+///  @exception Numero de colunas diferente do cabecalho, colunas de
+///  tamanhos diferentes ou erro de escrita.
+    void Append (std::span<const std::span<const Real>>);
+
+    void Append (std::initializer_list<std::span<const Real>> _columns)
+    {
+        Append(std::span<const std::span<const Real>>(_columns.begin(), _columns.size()));
+    }
+
+/// <summary>
+/// Grava no disco os blocos ainda em memoria.
+/// </summary>
+    void Flush ();
+
+    [[nodiscard]] inline size_t NumberColumns () const {return ncol;};
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::string             file;
+std::ofstream           out;
+size_t                  ncol = 0;
+VecReal                 stats;
+
+};
+
+//==============================================================================
+// Leitura
+//==============================================================================
+
+class SweepReader {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "SweepReader"
+                        ,   ID::SweepReader
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Bloco do arquivo, com ponteiros para a memoria mapeada.
+/// </summary>
+    struct Chunk {
+
+        size_t          nrows;
+        const Real*     min;
+        const Real*     max;
+        const Real*     data;
+
+        [[nodiscard]] inline std::span<const Real> Column (const size_t& _k) const
+        {
+            return std::span<const Real>(data + _k * nrows, nrows);
+        };
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    SweepReader() = default;
+
+/// <summary>
+/// Construtora de copia. A memoria mapeada e compartilhada.
+/// </summary>
+    SweepReader(const SweepReader&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~SweepReader() = default;
+
+/// <summary>
+/// Mapeia o arquivo e monta o indice dos blocos.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     SweepReader     reader ("toth.swp");
+///     for (const size_t k : reader.Select(2, 10.0, 20.0))
+///         Analise(reader.GetChunk(k).Column(2));
+/// @endcode
+/// </example>
+///  @exception Arquivo inexistente ou com cabecalho invalido.
+    explicit SweepReader (const std::string&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    SweepReader& operator = (const SweepReader&) = default;
+
+//==============================================================================
+// Cabecalho
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline UInt ModelID () const {return header->model;};
+    [[nodiscard]] inline const std::string& ModelName () const {return model;};
+    [[nodiscard]] inline std::span<const Real> Coefficients () const {return coefficients;};
+    [[nodiscard]] inline const std::vector < SweepAxis >& Axes () const {return axes;};
+    [[nodiscard]] inline const std::vector < std::string >& Columns () const {return columns;};
+
+//==============================================================================
+// Blocos
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline size_t NumberChunks () const {return chunks.size();};
+    [[nodiscard]] inline const Chunk& GetChunk (const size_t& _k) const {return chunks[_k];};
+
+/// <summary>
+/// Numero total de linhas.
+/// </summary>
+    [[nodiscard]] size_t NumberRows () const;
+
+/// <summary>
+/// Blocos em que a coluna _col pode ter valores em [_lo, _hi], pelos
+/// minimos e maximos do bloco.
+/// </summary>
+///  @exception _col fora das colunas.
+    [[nodiscard]] std::vector < size_t > Select (   const size_t&
+                                                ,   const Real&
+                                                ,   const Real&) const;
+
+/// <summary>
+/// Chama _func(bloco) para os blocos em que _pred(bloco) e verdadeiro. O
+/// predicado deve usar somente min e max, para que os dados dos blocos
+/// descartados nao sejam lidos.
+/// </summary>
+    template < typename Pred, typename Func >
+    void ForEach (Pred&& _pred, Func&& _func) const
+    {
+        for (const auto& chunk : chunks) if (_pred(chunk)) _func(chunk);
+    }
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::shared_ptr<const void>         storage;
+const SweepFormat::Header*          header = nullptr;
+std::string                         model;
+std::span<const Real>               coefficients;
+std::vector < SweepAxis >           axes;
+std::vector < std::string >         columns;
+std::vector < Chunk >               chunks;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __SWEEP_STORE_H__ */
+
+/** @} */
@@ -51,15 +51,22 @@
 // include da lib c++ 
 //==============================================================================
 
+#include <array>            // std::array
+#include <execution>        // std::execution::par
 #include <functional>       // std::function
+#include <limits>           // std::numeric_limits
 #include <memory>           // std::shared_ptr
+#include <span>             // std::span
+#include <type_traits>      // std::is_execution_policy_v
 #include <vector>           // std::vector
 
 //==============================================================================
 // include da Isotherm++
 //==============================================================================
 
+#include <Error/IsoException.h>
 #include <Misc/ID.h>
+#include <Misc/Trace.h>
 
 IST_NAMESPACE_OPEN
 
@@ -72,6 +79,8 @@ typedef std::vector < PairString >                             VecPairString;
 typedef std::vector < Real >                                   VecReal;
 typedef std::function<Real(const Real&, const Real&)>          FunctionEscala;
 
+class ThreadPool;
+
 
 //==============================================================================
 // classe isotherm
@@ -94,8 +103,11 @@ public:
 // constantes do modelo
 //==============================================================================
 
-protected:
+public:
 
+/// <summary>
+/// Constante universal dos gases, valor padrao dos modelos que a usam.
+/// </summary>
 inline static const Real RGASCONST = 8.31446261815324L;
 
 //==============================================================================
@@ -125,27 +137,63 @@ protected:
     Isotherm& operator = (const Isotherm&) = default;
 
 //==============================================================================
-// Funções inline
+// Derivada da isoterma
 //==============================================================================
 
 public:
 
-[[nodiscard]] inline Real DQDC (const Real& _ce, const Real& _temperature = 0) const
-{
-
-const Real PERC (1e-06);
-
-    if (_ce > 0.0)
-    {
-        return  0.5 * ( Qe(_ce * (1 + PERC), _temperature) -
-                        Qe(_ce * (1 - PERC), _temperature))
-                / (_ce * PERC);
-    }
+/// <summary>
+/// Funcao que calcula dQe/dCe. Os modelos com forma fechada a especializam
+/// com a derivada analitica. Nos modelos implicitos com ExplicitCe, usa-se
+/// o teorema da funcao implicita, dQe/dCe = 1 / (dCe/dqe), com uma unica
+/// solucao de Qe; nos demais, diferenca central com passo relativo 1e-6.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir    iso(qmax, k1);
+///     Real        dqdc = iso.DQDC(ce);
+/// @endcode
+/// </example>
+///  @param _ce Concentracao de equilibrio.
+///  @param _temperature Temperatura, opcional.
+///  @return Derivada dQe/dCe.
+[[nodiscard]] virtual Real DQDC (   const Real&
+                                ,   const Real& = 0) const;
 
-    return  (Qe(PERC, _temperature) - Qe(0, _temperature)) / PERC;
+/// <summary>
+/// Funcao que calcula dQe/dCe para um conjunto de concentracoes. Os modelos
+/// derivados de IsothermTemplate usam o laco de IsothermTemplate, sem
+/// chamada virtual por ponto.
+/// </summary>
+///  @param _ce Concentracoes.
+///  @param _dqdc Derivadas, com o mesmo tamanho de _ce.
+///  @param _temperature Temperatura, opcional.
+virtual void DQDC   (   std::span<const Real>
+                    ,   std::span<Real>
+                    ,   const Real& = 0) const;
 
+/// <summary>
+/// DQDC em bloco com uma politica de execucao, como Qe com politica.
+/// </summary>
+template < typename Policy >
+    requires std::is_execution_policy_v < std::remove_cvref_t<Policy> >
+void DQDC   (   Policy&&
+            ,   std::span<const Real>   _ce
+            ,   std::span<Real>         _dqdc
+            ,   const Real&             _temperature = 0) const
+{
+    if constexpr (IsParallel<Policy>) ParallelDQDC(_ce, _dqdc, _temperature);
+    else DQDC(_ce, _dqdc, _temperature);
+}
 
-};
+/// <summary>
+/// DQDC em bloco dividida entre as threads de _pool, como ParallelQe.
+/// </summary>
+void ParallelDQDC   (   std::span<const Real>
+                    ,   std::span<Real>
+                    ,   const Real& = 0
+                    ,   ThreadPool* = nullptr) const;
 
 //==============================================================================
 // Funções
@@ -153,6 +201,11 @@ const Real PERC (1e-06);
 
 public:
 
+/// <summary>
+/// Grava a curva (_eixoX(qe, ce), _eixoY(qe, ce)) em texto, numa malha
+/// uniforme de Ce. Usa CurveExport, que tambem oferece malha logaritmica e
+/// formatos binarios.
+/// </summary>
     void PlotGraph  (   const std::string&  // Nome do arquivo
                     ,   FunctionEscala&     // Funçao de conversao de escala direçao x
                     ,   FunctionEscala&     // funçao de conversao de escala direçao y
@@ -182,6 +235,119 @@ public:
                 return Qe(_x, 0);
 
         };
+
+/// <summary>
+/// Funcao que calcula Qe para um conjunto de concentracoes. Os modelos
+/// derivados de IsothermTemplate usam o laco de IsothermTemplate, sem
+/// chamada virtual por ponto.
+/// </summary>
+///  @param _ce Concentracoes.
+///  @param _qe Quantidades adsorvidas, com o mesmo tamanho de _ce.
+///  @param _temperature Temperatura, opcional.
+        virtual void Qe (   std::span<const Real>
+                        ,   std::span<Real>
+                        ,   const Real& = 0) const;
+
+/// <summary>
+/// Qe em bloco com uma politica de execucao do C++17. seq e unseq usam a
+/// funcao em bloco do modelo na thread chamadora. par e par_unseq dividem
+/// as concentracoes em blocos de PARALLELBLOCK pontos, executados por
+/// ThreadPool::Default(), cada um pela funcao em bloco do modelo; como a
+/// vetorizacao ocorre dentro de cada bloco, par_unseq tem entre os blocos
+/// as mesmas garantias de par. Todos os modelos sao reentrantes: as
+/// funcoes const nao alteram o objeto.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     FowlerGuggenheim    fg(qmax, k1, k2);
+///     fg.Qe(std::execution::par, ce, qe, temperature);
+/// @endcode
+/// </example>
+///  @param _ce Concentracoes.
+///  @param _qe Quantidades adsorvidas, com o mesmo tamanho de _ce.
+///  @param _temperature Temperatura, opcional.
+        template < typename Policy >
+            requires std::is_execution_policy_v < std::remove_cvref_t<Policy> >
+        void Qe (   Policy&&
+                ,   std::span<const Real>   _ce
+                ,   std::span<Real>         _qe
+                ,   const Real&             _temperature = 0) const
+        {
+            if constexpr (IsParallel<Policy>) ParallelQe(_ce, _qe, _temperature);
+            else Qe(_ce, _qe, _temperature);
+        }
+
+/// <summary>
+/// Qe em bloco dividida em blocos de PARALLELBLOCK pontos, executados pelas
+/// threads de _pool ou, com nullptr, de ThreadPool::Default(). E o caminho
+/// de par e par_unseq, com o conjunto de threads escolhido pelo chamador.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ThreadPool          pool(8);
+///     FowlerGuggenheim    fg(qmax, k1, k2);
+///     fg.ParallelQe(ce, qe, temperature, &pool);
+/// @endcode
+/// </example>
+///  @param _ce Concentracoes.
+///  @param _qe Quantidades adsorvidas, com o mesmo tamanho de _ce.
+///  @param _temperature Temperatura, opcional.
+///  @param _pool Conjunto de threads, opcional.
+        void ParallelQe (   std::span<const Real>
+                        ,   std::span<Real>
+                        ,   const Real& = 0
+                        ,   ThreadPool* = nullptr) const;
+
+/// <summary>
+/// Forma explicita da isoterma inversa, quando existe. Os modelos em que Qe
+/// e implicito (resolvido por Newton-Raphson) mas Ce(qe) e explicito a
+/// fornecem, o que permite resolver balancos de massa sem lacos aninhados.
+/// </summary>
+///  @param _qe Quantidade adsorvida.
+///  @param _temperature Temperatura.
+///  @param _ce Concentracao de equilibrio, infinita acima da saturacao.
+///  @param _dcdq Derivada dCe/dqe.
+///  @return false se o modelo nao possui inversa explicita.
+        [[nodiscard]] virtual bool ExplicitCe   (   [[maybe_unused]] const Real&    _qe
+                                                ,   [[maybe_unused]] const Real&    _temperature
+                                                ,   [[maybe_unused]] Real&          _ce
+                                                ,   [[maybe_unused]] Real&          _dcdq
+                                                ) const
+        {
+                return false;
+        };
+
+/// <summary>
+/// Isoterma inversa: concentracao de equilibrio para a quantidade adsorvida
+/// _qe. Os modelos com forma fechada a especializam; nos demais usa-se
+/// ExplicitCe ou, na falta dela, Newton protegido por bissecao em ln(Ce),
+/// com intervalo obtido de CeRange. Supoe-se Qe crescente em Ce.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Toth    iso(qmax, k1, k2);
+///     Real    ce = iso.Ce(qe);
+/// @endcode
+/// </example>
+///  @param _qe Quantidade adsorvida.
+///  @param _temperature Temperatura, opcional.
+///  @return Concentracao de equilibrio.
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+        [[nodiscard]] virtual Real Ce   (   const Real&
+                                        ,   const Real& = 0) const;
+
+/// <summary>
+/// Isoterma inversa para um conjunto de quantidades adsorvidas.
+/// </summary>
+///  @param _qe Quantidades adsorvidas.
+///  @param _ce Concentracoes, com o mesmo tamanho de _qe.
+///  @param _temperature Temperatura, opcional.
+        void Ce (   std::span<const Real>
+                ,   std::span<Real>
+                ,   const Real& = 0) const;
   
         
     [[nodiscard]]    
@@ -256,6 +422,67 @@ protected:
 
 protected:
 
+/// <summary>
+/// Verifica se os vetores de uma avaliacao em bloco tem o mesmo tamanho.
+/// </summary>
+void CheckBlock (const size_t&, const size_t&) const;
+
+/// <summary>
+/// Pontos por tarefa nas avaliacoes em bloco com par e par_unseq.
+/// </summary>
+inline static const size_t PARALLELBLOCK = 2048;
+
+template < typename Policy >
+inline static constexpr bool IsParallel =   std::is_same_v < std::remove_cvref_t<Policy>, std::execution::parallel_policy >
+                                        ||  std::is_same_v < std::remove_cvref_t<Policy>, std::execution::parallel_unsequenced_policy >;
+
+/// <summary>
+/// Verifica os coeficientes e _qe antes da isoterma inversa; _inRange indica
+/// se _qe e atingida pelo modelo.
+/// </summary>
+void CheckQe (const Real&, const bool&) const;
+
+/// <summary>
+/// Calcula as constantes derivadas dos coeficientes (inversos, produtos,
+/// expoentes, exp e log de coeficientes), guardadas pelo modelo para que Qe,
+/// DQDC e Ce facam por ponto apenas o trabalho que depende de Ce. As
+/// construtoras e SetParameters a chamam depois de validar os coeficientes,
+/// de modo que ela e refeita somente quando os coeficientes mudam. O padrao
+/// nao guarda nada.
+/// </summary>
+virtual void Prepare () {};
+
+/// <summary>
+/// Verifica os coeficientes _par sem altera-los, com os mesmos criterios da
+/// construtora do modelo. Em caso de erro, _error recebe o indice da
+/// excecao que a construtora lancaria. O padrao recusa qualquer valor, de
+/// modo que somente os modelos que a especializam podem ser alterados por
+/// SetParameters.
+/// </summary>
+///  @param _par Coeficientes, na ordem de Value().
+///  @param _error Indice do erro encontrado.
+///  @return true se os coeficientes sao validos.
+[[nodiscard]] virtual bool CheckParameters  (   [[maybe_unused]] std::span<const Real>  _par
+                                            ,   IsoExceptionIndex&                      _error
+                                            ) const
+{
+    _error = BadParameter;
+    return false;
+};
+
+/// <summary>
+/// Intervalo (_cmin, _cmax) de Ce em que Qe esta definida, usado pela
+/// isoterma inversa generica. O padrao e (0, infinito).
+/// </summary>
+virtual void CeRange    (   [[maybe_unused]] const Real&    _temperature
+                        ,   Real&                           _cmin
+                        ,   Real&                           _cmax
+                        ) const
+{
+    _cmin = 0.0;
+    _cmax = std::numeric_limits<Real>::infinity();
+};
+
 /// <summary>
 /// Vetor com os coeficientes de qualquer isoterma.
 /// </summary>
@@ -277,6 +504,63 @@ public:
 /// </summary>
 [[nodiscard]] inline size_t NumberConst () const {return coeffValue.size();};
 
+/// <summary>
+/// Coeficientes da isoterma, na ordem das construtoras.
+/// </summary>
+[[nodiscard]] inline const VecReal& Coefficients () const {return coeffValue;};
+
+/// <summary>
+/// Constante dos gases usada pelo modelo. Os modelos que nao a usam
+/// devolvem RGASCONST.
+/// </summary>
+[[nodiscard]] virtual Real Rgas () const {return RGASCONST;};
+
+/// <summary>
+/// Altera a constante dos gases. O padrao recusa a alteracao, de modo que
+/// somente os modelos que usam a constante podem ser alterados.
+/// </summary>
+///  @param _rgas Novo valor da constante dos gases.
+///  @exception Modelo sem constante dos gases ou _rgas <= 0.
+virtual void Rgas (const Real&);
+
+//==============================================================================
+// Alteracao dos coeficientes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Altera todos os coeficientes do modelo sem reconstrui-lo: os valores sao
+/// verificados uma unica vez, copiados sobre os atuais e as constantes
+/// derivadas sao refeitas por Prepare, sem alocar memoria. Permite que um
+/// ajuste de parametros reutilize o mesmo objeto a cada iteracao.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Sips    iso(qmax, k1, k2);
+///     Real    par[] {qmax, k1 + dk, k2};
+///     iso.SetParameters(par);
+/// @endcode
+/// </example>
+///  @param _par Coeficientes, na ordem de Value().
+///  @exception _par com tamanho diferente de NumberConst() ou com algum
+///  coeficiente invalido para o modelo.
+void SetParameters (std::span<const Real>);
+
+/// <summary>
+/// Como SetParameters, mas devolve o resultado em vez de lancar excecao. Se
+/// os coeficientes sao invalidos, o modelo nao e alterado e _error recebe o
+/// indice do erro.
+/// </summary>
+///  @param _par Coeficientes, na ordem de Value().
+///  @param _error Indice do erro encontrado.
+///  @return true se os coeficientes foram alterados.
+[[nodiscard]] bool TrySetParameters (   std::span<const Real>
+                                    ,   IsoExceptionIndex&) noexcept;
+
+[[nodiscard]] bool TrySetParameters (std::span<const Real>) noexcept;
+
 //==============================================================================
 // Dados privados da classe
 //==============================================================================
@@ -346,6 +630,50 @@ public:
     inline auto crbegin() const {return  InfoIsotherm().crbegin();};
     inline auto crend() const {return  InfoIsotherm().crend();};
 
+//==============================================================================
+// Avaliacao em bloco
+//==============================================================================
+
+public:
+
+    using Isotherm::Qe;
+    using Isotherm::DQDC;
+
+/// <summary>
+/// Qe em bloco com o laco do proprio modelo: a chamada por ponto e
+/// qualificada por T, sem despacho virtual, e pode ser expandida pelo
+/// compilador. Os modelos em que Qe por ponto nao e publica declaram
+/// IsothermTemplate como friend.
+/// </summary>
+    void Qe (   std::span<const Real>   _ce
+            ,   std::span<Real>         _qe
+            ,   const Real&             _temperature = 0) const override
+    {
+        IST_TRACE("Qe", "isotherm");
+
+        CheckBlock(_ce.size(), _qe.size());
+
+    const T&    model (static_cast<const T&>(*this));
+
+        for (size_t k = 0; k < _ce.size(); ++k) _qe[k] = model.T::Qe(_ce[k], _temperature);
+    }
+
+/// <summary>
+/// DQDC em bloco com o laco do proprio modelo, como Qe.
+/// </summary>
+    void DQDC   (   std::span<const Real>   _ce
+                ,   std::span<Real>         _dqdc
+                ,   const Real&             _temperature = 0) const override
+    {
+        IST_TRACE("DQDC", "isotherm");
+
+        CheckBlock(_ce.size(), _dqdc.size());
+
+    const T&    model (static_cast<const T&>(*this));
+
+        for (size_t k = 0; k < _ce.size(); ++k) _dqdc[k] = model.T::DQDC(_ce[k], _temperature);
+    }
+
 //==============================================================================
 // Funçao privada da classe
 //==============================================================================
@@ -272,11 +272,7 @@ inline Real K4 () const {return  Value(4);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax < 0.
-    void Qmax (const Real& _qmax)  {*this = FrenkelHalseyHill (   _qmax,
-                                                                Value(1),
-                                                                Value(2),
-                                                                Value(3),
-                                                                Value(4));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2), Value(3), Value(4)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante da isoterma de Fritz – Schlunder - V.
@@ -291,11 +287,7 @@ inline Real K4 () const {return  Value(4);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Fritz – Schlunder - V.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = FrenkelHalseyHill (   Value(0),
-                                                            _k1,
-                                                            Value(2),
-                                                            Value(3),
-                                                            Value(4));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2), Value(3), Value(4)});};
 
 /// <summary>
 /// Funcao para alterar o valor associado a constante da isoterma de Fritz – Schlunder - V.
@@ -311,11 +303,7 @@ inline Real K4 () const {return  Value(4);};
 ///  @param _k2 Novo valor associado a constante da isoterma de Fritz – Schlunder - V.
 ///  @exception _k2 <= 0.
     void K2 (const Real& _k2)  {
-        *this = FrenkelHalseyHill(  Value(0),
-                                                            Value(1),
-                                                            _k2     ,
-                                                            Value(3),
-                                                            Value(4));
+        SetParameters(std::array {Value(0), Value(1), _k2, Value(3), Value(4)});
     };
 
 /// <summary>
@@ -332,12 +320,7 @@ inline Real K4 () const {return  Value(4);};
 ///  @param _k3 Novo valor associado ao expoente da isoterma de Fritz – Schlunder - V.
 ///  @exception 0 < _k3 < 1.
     void K3 (const Real& _k3)  {       
-        *this = FrenkelHalseyHill   (   Value(0),
-                                        Value(1),
-                                        Value(2),
-                                        _k3,
-                                        Value(4)
-                                    );
+        SetParameters(std::array {Value(0), Value(1), Value(2), _k3, Value(4)});
     };
 
 /// <summary>
@@ -353,11 +336,7 @@ inline Real K4 () const {return  Value(4);};
 /// </example>
 ///  @param _k4 Novo valor associado ao expoente da isoterma de Fritz – Schlunder - V.
 ///  @exception 0 < _k4 < 1.
-    void K4 (const Real& _k4)  {*this = FrenkelHalseyHill(    Value(0),
-                                                            Value(1),
-                                                            Value(2),
-                                                            Value(3),
-                                                            _k4     );};
+    void K4 (const Real& _k4)  {SetParameters(std::array {Value(0), Value(1), Value(2), Value(3), _k4});};
 
 
 //==============================================================================
@@ -378,15 +357,43 @@ inline Real K4 () const {return  Value(4);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
-    virtual Real Qe (const Real&, const Real& = 0) const;
+    using Isotherm::Qe;
+
+    virtual Real Qe (const Real&, const Real&) const;
 
   
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<FrenkelHalseyHill>(*this);
     }
-    
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    expoA1  = 0;         //! a - 1
+Real                    prodAK  = 0;         //! a K1
+Real                    diffAB  = 0;         //! a - b
 
 };
 
@@ -260,11 +260,7 @@ inline Real K3 () const {return  Value(3);};
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
 
-void Qmax (const Real& _qmax)   {   *this = Baudu   (       _qmax 
-                                                    ,       Value(1) 
-                                                    ,       Value(2)
-                                                    ,       Value(3)
-                                                    );
+void Qmax (const Real& _qmax)   {   SetParameters(std::array {_qmax, Value(1), Value(2), Value(3)});
                                 };
 
 /// <summary>
@@ -281,11 +277,7 @@ void Qmax (const Real& _qmax)   {   *this = Baudu   (       _qmax
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Baudu. 
 ///  @exception _k1 <= 0.
                                 
-void K1 (const Real& _k1)   {   *this = Baudu   (   Value(0) 
-                                                ,   _k1 
-                                                ,   Value(2) 
-                                                ,   Value(3)
-                                                );
+void K1 (const Real& _k1)   {   SetParameters(std::array {Value(0), _k1, Value(2), Value(3)});
                             };
 
 /// <summary>
@@ -302,11 +294,7 @@ void K1 (const Real& _k1)   {   *this = Baudu   (   Value(0)
 ///  @param _k2 Novo valor associado a constante da isoterma de Baudu.
 ///  @exception _k2 <= 0.    
                             
-void K2 (const Real& _k2)   {   *this = Baudu   (   Value(0) 
-                                                ,   Value(1) 
-                                                ,   _k2     
-                                                ,   Value(3)
-                                                );
+void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), Value(1), _k2, Value(3)});
                             };
 
 /// <summary>
@@ -324,11 +312,7 @@ void K2 (const Real& _k2)   {   *this = Baudu   (   Value(0)
 ///  @exception _k3 <= 0.    
 ///  @exception _k3 >= 1.    
                             
-void K3 (const Real& _k3)   {   *this = Baudu   (   Value(0) 
-                                                ,   Value(1) 
-                                                ,   Value(2) 
-                                                ,   _k3
-                                                );
+void K3 (const Real& _k3)   {   SetParameters(std::array {Value(0), Value(1), Value(2), _k3});
                             };
 
     
@@ -351,6 +335,8 @@ void K3 (const Real& _k3)   {   *this = Baudu   (   Value(0)
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _ce <= 0.   
                             
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     inline Real Qe   (   const Real& _ce
     ) const override
@@ -363,19 +349,48 @@ void K3 (const Real& _k3)   {   *this = Baudu   (   Value(0)
 private:
     
 
+friend class IsothermTemplate < Baudu >;   //! Laco de Qe em bloco
+
 [[maybe_unused]]  [[nodiscard]]  
 Real Qe (const Real&, [[maybe_unused]] const Real&) const;
 
 
 
+public:
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
 [[nodiscard]]
 virtual std::unique_ptr<Isotherm> CloneImplementation() const override
 {
     return std::make_unique<Baudu>(*this);
 }
-    
 
-    
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    expoX   = 0;         //! 1 - x
+Real                    expoXY  = 0;         //! 1 - x + y
+Real                    prodQK  = 0;         //! Qmax K1
+
 };
 
 IST_NAMESPACE_CLOSE
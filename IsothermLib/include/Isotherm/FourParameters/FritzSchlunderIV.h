@@ -253,11 +253,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax < 0.
-    void Qmax (const Real& _qmax)   {   *this = FritzSchlunderIV    (       _qmax 
-                                                                    ,       Value(1) 
-                                                                    ,       Value(2)
-                                                                    ,       Value(3)
-                                                                    );
+    void Qmax (const Real& _qmax)   {   SetParameters(std::array {_qmax, Value(1), Value(2), Value(3)});
                                     };
 
 /// <summary>
@@ -273,11 +269,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Fritz  Schlunder IV. 
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)   {   *this = FritzSchlunderIV    (   Value(0) 
-                                                                ,   _k1 
-                                                                ,   Value(2) 
-                                                                ,   Value(3)
-                                                                );
+    void K1 (const Real& _k1)   {   SetParameters(std::array {Value(0), _k1, Value(2), Value(3)});
                                 };
 
 /// <summary>
@@ -293,11 +285,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _k2 Novo valor associado a constante da isoterma de Fritz  Schlunder IV.
 ///  @exception _k2 <= 0.    
-    void K2 (const Real& _k2)   {   *this = FritzSchlunderIV    (   Value(0) 
-                                                                ,   Value(1) 
-                                                                ,   _k2     
-                                                                ,   Value(3)
-                                                                );
+    void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), Value(1), _k2, Value(3)});
                                 };
 
 /// <summary>
@@ -313,11 +301,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _k3 Novo valor associado ao expoente da isoterma de Fritz  Schlunder IV.
 ///  @exception 0 < _k3 < 1.    
-    void K3 (const Real& _k3)  {    *this = FritzSchlunderIV    (   Value(0) 
-                                                                ,   Value(1) 
-                                                                ,   Value(2) 
-                                                                ,   _k3
-                                                                );
+    void K3 (const Real& _k3)  {    SetParameters(std::array {Value(0), Value(1), Value(2), _k3});
                                 };
 
     
@@ -339,6 +323,8 @@ inline Real K3 () const {return  Value(3);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.    
+    using Isotherm::Qe;
+
     [[nodiscard]]  Real Qe (const Real&, const Real&) const;
 
     [[nodiscard]] 
@@ -350,14 +336,38 @@ inline Real K3 () const {return  Value(3);};
 
 
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<FritzSchlunderIV>(*this);
     }
-    
 
-    
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    expoA1  = 0;         //! a - 1
+Real                    diffAB  = 0;         //! a - b
+
 };
 
 IST_NAMESPACE_CLOSE
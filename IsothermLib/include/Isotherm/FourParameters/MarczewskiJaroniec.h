@@ -256,11 +256,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax < 0.
-    void Qmax (const Real& _qmax)   {   *this = MarczewskiJaroniec  (       _qmax 
-                                                                    ,       Value(1) 
-                                                                    ,       Value(2)
-                                                                    ,       Value(3)
-                                                                    );
+    void Qmax (const Real& _qmax)   {   SetParameters(std::array {_qmax, Value(1), Value(2), Value(3)});
                                     };
 
 /// <summary>
@@ -276,11 +272,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de MarczewskiJaroniec. 
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)   {   *this = MarczewskiJaroniec    (   Value(0) 
-                                                                ,   _k1 
-                                                                ,   Value(2) 
-                                                                ,   Value(3)
-                                                                );
+    void K1 (const Real& _k1)   {   SetParameters(std::array {Value(0), _k1, Value(2), Value(3)});
                                 };
 
 /// <summary>
@@ -296,11 +288,7 @@ inline Real K3 () const {return  Value(3);};
 /// </example>
 ///  @param _k2 Novo valor associado a constante da isoterma de MarczewskiJaroniec.
 ///  @exception _k2 <= 0.    
-    void K2 (const Real& _k2)   {   *this = MarczewskiJaroniec    (   Value(0) 
-                                                                ,   Value(1) 
-                                                                ,   _k2     
-                                                                ,   Value(3)
-                                                                );
+    void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), Value(1), _k2, Value(3)});
                                 };
 
 /// <summary>
@@ -317,11 +305,7 @@ inline Real K3 () const {return  Value(3);};
 ///  @param _k3 Novo valor associado ao expoente da isoterma de MarczewskiJaroniec.
 ///  @exception _k3 <= 0    
 ///  @exception _k3 >= 1    
-    void K3 (const Real& _k3)  {    *this = MarczewskiJaroniec  (   Value(0) 
-                                                                ,   Value(1) 
-                                                                ,   Value(2) 
-                                                                ,   _k3
-                                                                );
+    void K3 (const Real& _k3)  {    SetParameters(std::array {Value(0), Value(1), Value(2), _k3});
                                 };
 
     
@@ -346,6 +330,8 @@ inline Real K3 () const {return  Value(3);};
     
 public:
     
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     inline Real Qe   (   const Real& _c
     ) const override
@@ -355,17 +341,44 @@ public:
                               
                                 
 private:                                  
+    friend class IsothermTemplate < MarczewskiJaroniec >;   //! Laco de Qe em bloco
+
     [[nodiscard]]  
     Real Qe (const Real&, const Real&) const;
 
+public:
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<MarczewskiJaroniec>(*this);
     }
-    
 
-    
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    expoMN  = 0;         //! m / n
+
 };
 
 IST_NAMESPACE_CLOSE
@@ -253,11 +253,7 @@ inline Real K4 () const {return  Value(3);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de WeberVanVliet. 
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)   {   *this = WeberVanVliet   (   _k1 
-                                                            ,   Value(1) 
-                                                            ,   Value(2) 
-                                                            ,   Value(3)
-                                                            );
+    void K1 (const Real& _k1)   {   SetParameters(std::array {_k1, Value(1), Value(2), Value(3)});
                             };
 
                              
@@ -275,11 +271,7 @@ inline Real K4 () const {return  Value(3);};
 /// </example>
 ///  @param _k2 Novo valor do coeficiente associado a constante da isoterma de WeberVanVliet. 
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)   {   *this = WeberVanVliet  (   Value(0) 
-                                                            ,   _k2 
-                                                            ,   Value(2) 
-                                                            ,   Value(3)
-                                                            );
+    void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), _k2, Value(2), Value(3)});
                                 };
 
 /// <summary>
@@ -295,11 +287,7 @@ inline Real K4 () const {return  Value(3);};
 /// </example>
 ///  @param _k3 Novo valor associado a constante da isoterma de WeberVanVliet.
 ///  @exception _k3 <= 0.    
-    void K3 (const Real& _k3)   {   *this = WeberVanVliet   (   Value(0) 
-                                                            ,   Value(1) 
-                                                            ,   _k3     
-                                                            ,   Value(3)
-                                                            );
+    void K3 (const Real& _k3)   {   SetParameters(std::array {Value(0), Value(1), _k3, Value(3)});
                                 };
 
 /// <summary>
@@ -314,11 +302,7 @@ inline Real K4 () const {return  Value(3);};
 /// @endcode
 /// </example>
 ///  @param _k4 Novo valor associado ao expoente da isoterma de WeberVanVliet.
-    void K4 (const Real& _k4)  {    *this = WeberVanVliet   (   Value(0) 
-                                                            ,   Value(1) 
-                                                            ,   Value(2) 
-                                                            ,   _k4
-                                                            );
+    void K4 (const Real& _k4)  {    SetParameters(std::array {Value(0), Value(1), Value(2), _k4});
                                 };
 
     
@@ -341,6 +325,8 @@ inline Real K4 () const {return  Value(3);};
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c <= 0.    
 
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     inline Real Qe   (   const Real& _c
     ) const override
@@ -348,12 +334,23 @@ inline Real K4 () const {return  Value(3);};
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Isoterma inversa explicita Ce(qe) e derivada dCe/dqe.
+/// </summary>
+    [[nodiscard]]
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&) const override;
+
 //==============================================================================
 // Funcoes privadas da classe
 //==============================================================================
     
 private:
         
+    friend class IsothermTemplate < WeberVanVliet >;   //! Laco de Qe em bloco
+
     [[maybe_unused]]  [[nodiscard]]  
     Real Qe (const Real&, [[maybe_unused]]  const Real&) const;
 
@@ -364,16 +361,24 @@ private:
     }
 
     [[nodiscard]]
-    Real  FQe (const Real&) const;
+    Real  FQe (const Real&, const Real&) const;
     
 //==============================================================================
-// Dados da classe
+// Constantes derivadas dos coeficientes
 //==============================================================================
 
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
 private:
 
-    Real                auxiCe = 0;
-        
+Real                    invK1   = 0;         //! 1 / K1
+Real                    prodK23 = 0;         //! K2 K3
+
 };
 
 IST_NAMESPACE_CLOSE
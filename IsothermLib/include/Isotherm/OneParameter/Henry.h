@@ -192,7 +192,7 @@ public:
 ///  @exception _k1 <= 0.
     inline void K1 (const Real& _k1)
     {
-        *this = Henry(_k1);
+        SetParameters(std::array {_k1});
     };
 
 //==============================================================================
@@ -218,6 +218,8 @@ public:
     
 public:
     
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     inline Real Qe   (   const Real& _c
     ) const override
@@ -228,16 +230,49 @@ public:
     
 protected:
 
+    friend class IsothermTemplate < Henry >;   //! Laco de Qe em bloco
+
     [[nodiscard]]
     virtual Real Qe     (   const Real&  _c
                         ,   const Real&) const ;
 
+public:
+
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<Henry>(*this);
     }
     
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+protected:
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
 };
 
 /**
@@ -224,10 +224,7 @@ inline Real K2 () const {return  Value(2);};
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
 
-void Qmax (const Real& _qmax)   {   *this = BrouersSotolongo    (  _qmax
-                                                                ,   Value(1)
-                                                                ,   Value(2)
-                                                                );
+void Qmax (const Real& _qmax)   {   SetParameters(std::array {_qmax, Value(1), Value(2)});
                                 };
 
 /// <summary>
@@ -244,10 +241,7 @@ void Qmax (const Real& _qmax)   {   *this = BrouersSotolongo    (  _qmax
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Brouers - Sotolongo.
 ///  @exception _k1 <= 0.
     
-void K1 (const Real& _k1)   {   *this = BrouersSotolongo    (   Value(0)
-                                                            ,   _k1
-                                                            ,   Value(2)
-                                                            );
+void K1 (const Real& _k1)   {   SetParameters(std::array {Value(0), _k1, Value(2)});
                             };
 
 /// <summary>
@@ -264,10 +258,7 @@ void K1 (const Real& _k1)   {   *this = BrouersSotolongo    (   Value(0)
 ///  @param _k2 Novo valor associado a constante da isoterma de Brouers - Sotolongo.
 ///  @exception _k2 <= 0.
     
-void K2 (const Real& _k2)   {   *this = BrouersSotolongo    (   Value(0)
-                                                            ,   Value(1)
-                                                            ,   _k2
-                                                            );
+void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), Value(1), _k2});
                             };
 
  
@@ -289,6 +280,8 @@ void K2 (const Real& _k2)   {   *this = BrouersSotolongo    (   Value(0)
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+using Isotherm::Qe;
+
 [[nodiscard]]  
 Real Qe (const Real&, const Real&) const;
 
@@ -299,13 +292,36 @@ inline Real Qe   (   const Real& _c
     return Qe(_c, 0);
 }
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
 [[nodiscard]]
 virtual std::unique_ptr<Isotherm> CloneImplementation() const override
 {
     return std::make_unique<BrouersSotolongo>(*this);
 }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
 
+Real                    prodQK  = 0;         //! Qmax K1 K2
 
 };
 
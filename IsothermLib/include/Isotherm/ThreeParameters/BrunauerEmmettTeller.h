@@ -228,7 +228,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = BrunauerEmmettTeller (_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante da isoterma de Brunauer - Emmett - Teller.
@@ -243,7 +243,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Brunauer - Emmett - Teller.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = BrunauerEmmettTeller (Value(0), _k1, Value(2));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funcao para alterar o valor associado a constante da isoterma de Brunauer - Emmett - Teller.
@@ -258,7 +258,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k2 Novo valor associado a constante da isoterma de Brunauer - Emmett - Teller.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = BrunauerEmmettTeller(Value(0), Value(1), _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 
 //==============================================================================
@@ -279,6 +279,8 @@ inline Real K2 () const {return  Value(2);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     virtual Real Qe (const Real&, const Real&) const;
 
     [[nodiscard]] 
@@ -289,12 +291,52 @@ inline Real K2 () const {return  Value(2);};
     }
 
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<BrunauerEmmettTeller>(*this);
     }
 
+protected:
+
+/// <summary>
+/// Qe so esta definida para Ce < K2.
+/// </summary>
+    void CeRange    (   const Real&
+                    ,   Real&           _cmin
+                    ,   Real&           _cmax
+                    ) const override
+    {
+        _cmin = 0.0;
+        _cmax = K2();
+    };
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    slope   = 0;         //! (K1 - 1) / K2
+Real                    prodQK  = 0;         //! Qmax K1
+
 };
 
 IST_NAMESPACE_CLOSE
@@ -219,7 +219,7 @@ public:
 /// </example>
 ///  @param " " Nao ha parametros.
 ///  @return Valor da constante universal dos gases.
-    inline Real Rgas () const {return  RGAS;};
+    inline Real Rgas () const override {return  RGAS;};
 
 //==============================================================================
 // Alterando as constantes da classe
@@ -238,7 +238,7 @@ public:
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorçao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax) {*this = FowlerGuggenheim(_qmax, Value(1), Value(2), this->Rgas());};
+    void Qmax (const Real& _qmax) {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funçao que altera o coeficiente associado a constante de equilibrio de Fowler-Guggenheim.
@@ -253,7 +253,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de equilibrio de Fowler-Guggenheim.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = FowlerGuggenheim(Value(0), _k1, Value(2), this->Rgas());};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funçao para alterar o valor da constante de iteraçao entre as moleculas adsorvidas.
@@ -268,7 +268,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor da constante de iteraçao entre as moleculas adsorvidas.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = FowlerGuggenheim(Value(0), Value(1), _k2, this->Rgas());};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 /// <summary>
 /// Funçao para alterar o valor da constante universal dos gases.
@@ -283,7 +283,7 @@ public:
 /// </example>
 ///  @param _rgas Novo valor da constante universal dos gases.
 ///  @exception _rgas <= 0.
-    void Rgas (const Real& _rgas) {*this = FowlerGuggenheim(Value(0), Value(1), Value(2), _rgas);};
+    void Rgas (const Real& _rgas) override {*this = FowlerGuggenheim(Value(0), Value(1), Value(2), _rgas);};
 
 
 
@@ -305,6 +305,8 @@ public:
 ///  @param _c Concentraçao do soluto.
 ///  @return Valor da quantidade de sorçao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     virtual Real Qe (const Real& _c, const Real& _temp) const;
 
     [[nodiscard]] 
@@ -315,6 +317,15 @@ public:
     }
 
 
+/// <summary>
+/// Isoterma inversa explicita Ce(qe) e derivada dCe/dqe.
+/// </summary>
+    [[nodiscard]]
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -327,13 +338,28 @@ public:
 // Dados da classe
 //==============================================================================
 
-Real  FQe (const Real&) const;
+Real  FQe (const Real&, const Real&, const Real&) const;
 
 private:
 
-Real                 auxiCe = 0;
 Real                 RGAS = Isotherm::RGASCONST;                // Constante universal dos gases
-Real                 tempK = 0;
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    prodKR  = 0;         //! K2 / R
+Real                    invK1   = 0;         //! 1 / K1
+Real                    invK1Q  = 0;         //! 1 / (K1 Qmax)
 
 };
 
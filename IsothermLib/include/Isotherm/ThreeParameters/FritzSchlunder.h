@@ -226,7 +226,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = FritzSchlunder (_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante da isoterma de Fritz–Schlunder.
@@ -241,7 +241,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante da isoterma de Fritz–Schlunder.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = FritzSchlunder (Value(0), _k1, Value(2));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funcao para alterar o valor associado a constante da isoterma de Fritz–Schlunder.
@@ -256,7 +256,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k2 Novo valor associado a constante da isoterma de Fritz–Schlunder.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = FritzSchlunder(Value(0), Value(1), _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 
 //==============================================================================
@@ -277,6 +277,8 @@ inline Real K2 () const {return  Value(2);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     virtual Real Qe (const Real&, const Real&) const;
 
     [[nodiscard]] 
@@ -286,12 +288,38 @@ inline Real K2 () const {return  Value(2);};
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<FritzSchlunder>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    prodQK  = 0;         //! Qmax K1
+Real                    compK2  = 0;         //! 1 - K2
+
 };
 
 IST_NAMESPACE_CLOSE
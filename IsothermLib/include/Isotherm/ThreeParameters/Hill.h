@@ -224,7 +224,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = Hill(_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante de Hill.
@@ -239,7 +239,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de Hill.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = Hill(Value(0), _k1,  Value(2));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funcao para alterar o valor do expoente da isoterma de Hill.
@@ -254,7 +254,7 @@ inline Real K2 () const {return  Value(2);};
 /// </example>
 ///  @param _k2 Novo valor do expoente da isoterma de Hill.
 ///  @exception _k2 <= 0.    
-    void K2 (const Real& _k2)  {*this = Hill(Value(0), Value(1),  _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
     
     
 //==============================================================================
@@ -275,6 +275,8 @@ inline Real K2 () const {return  Value(2);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.    
+    using Isotherm::Qe;
+
     virtual Real Qe (const Real&, const Real&) const;
 
     
@@ -286,14 +288,38 @@ inline Real K2 () const {return  Value(2);};
     }
 
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<Hill>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    prodQK  = 0;         //! Qmax K1 K2
+Real                    expoK2  = 0;         //! K2 - 1
 
-    
 };
 
 IST_NAMESPACE_CLOSE
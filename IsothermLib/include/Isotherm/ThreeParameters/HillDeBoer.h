@@ -222,7 +222,7 @@ public:
 ///  @param " " Nao ha parametros.
 ///  @return Valor da constante universal dos gases.
     [[nodiscard]]
-    inline Real Rgas () const {return  RGAS;};
+    inline Real Rgas () const override {return  RGAS;};
 
 
 //==============================================================================
@@ -242,11 +242,7 @@ public:
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = HillDeboer  ( _qmax
-                                                        , Value(1)
-                                                        , Value(2)
-                                                        , this->Rgas()
-                                                        );
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});
                                     };
 
 /// <summary>
@@ -262,11 +258,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de equilibrio de Hill – Deboer.
 ///  @exception _k1 <= 0.
-     void K1 (const Real& _k1)  {   *this = HillDeboer  (   Value(0)
-                                                        ,   _k1
-                                                        ,   Value(2)
-                                                        ,   this->Rgas()
-                                                        );
+     void K1 (const Real& _k1)  {   SetParameters(std::array {Value(0), _k1, Value(2)});
                                 };
 
 /// <summary>
@@ -282,11 +274,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor associado a constante de iteracao entre as moleculas adsorvidas.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)   {   *this = HillDeboer  (   Value(0)
-                                                        ,   Value(1)
-                                                        ,   _k2
-                                                        ,   this->Rgas()
-                                                        );
+    void K2 (const Real& _k2)   {   SetParameters(std::array {Value(0), Value(1), _k2});
                                 };
 
 /// <summary>
@@ -302,7 +290,7 @@ public:
 /// </example>
 ///  @param _rgas Novo valor da constante universal dos gases.
 ///  @exception _rgas <= 0.
-    void Rgas (const Real& _rgas) {*this = HillDeboer(Value(0), Value(1), Value(2), _rgas);};
+    void Rgas (const Real& _rgas) override {*this = HillDeboer(Value(0), Value(1), Value(2), _rgas);};
 
 
 
@@ -324,8 +312,19 @@ public:
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
+    [[nodiscard]]
+    virtual Real Qe (const Real& _c, const Real&) const;
+
+/// <summary>
+/// Isoterma inversa explicita Ce(qe) e derivada dCe/dqe.
+/// </summary>
     [[nodiscard]]
-    virtual Real Qe (const Real& _c, const Real& = 0) const;
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&) const override;
 
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
@@ -342,12 +341,27 @@ public:
  
     private:
 
-    Real                auxiCe = 0;
     Real                RGAS   = Isotherm::RGASCONST;         // Constante universal dos gases
-    Real                tempK  = 0;
     
     [[nodiscard]]
-    Real  FQe (const Real&) const;
+    Real  FQe (const Real&, const Real&, const Real&) const;
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    invK1Q  = 0;         //! 1 / (K1 Qmax)
+
 };
 
 IST_NAMESPACE_CLOSE
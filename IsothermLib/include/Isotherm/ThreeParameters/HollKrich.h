@@ -229,7 +229,7 @@ public:
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)   {*this = HollKrich(_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)   {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante de HollKrich.
@@ -244,7 +244,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de HollKrich.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = HollKrich(Value(0), _k1,  Value(2));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funcao para alterar o valor do expoente da isoterma de HollKrich.
@@ -259,7 +259,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor do expoente da isoterma de HollKrich.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = HollKrich(Value(0), Value(1),  _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 
 //==============================================================================
@@ -280,6 +280,8 @@ public:
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     virtual Real Qe (const Real&, const Real&) const;
 
         
@@ -290,12 +292,38 @@ public:
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<HollKrich>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    prodQK  = 0;         //! Qmax K1 K2
+Real                    expoK2  = 0;         //! K2 - 1
+
 };
 
 IST_NAMESPACE_CLOSE
@@ -237,7 +237,7 @@ public:
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorçao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = Kiselev (_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funçao que altera o coeficiente associado a constante de equilibrio de Kiselev.
@@ -252,7 +252,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de equilibrio de Kiselev.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = Kiselev (Value(0), _k1, Value(2));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funçao para alterar o valor associado a constante de iteraçao entre as moleculas adsorvidas.
@@ -267,7 +267,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor associado a constante de iteraçao entre as moleculas adsorvidas.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = Kiselev(Value(0), Value(1), _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 
 //==============================================================================
@@ -288,6 +288,8 @@ public:
 ///  @param _c Concentraçao do soluto.
 ///  @return Valor da quantidade de sorçao no equilibrio.
 ///  @exception _c < 0.
+using Isotherm::Qe;
+
 [[nodiscard]] 
 Real Qe (const Real&, const Real&) const override;
         
@@ -298,6 +300,15 @@ Real Qe (const Real&, const Real&) const override;
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Isoterma inversa explicita Ce(qe) e derivada dCe/dqe.
+/// </summary>
+    [[nodiscard]]
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -308,11 +319,23 @@ Real Qe (const Real&, const Real&) const override;
 // Dados da classe
 //==============================================================================
 
-    [[nodiscard]] Real  FQe (const Real&) const;
+    [[nodiscard]] Real  FQe (const Real&, const Real&) const;
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
 
-    private:
+private:
 
-    Real                 auxiCe = 0;
+Real                    invK1   = 0;         //! 1 / K1
+Real                    invK1Q  = 0;         //! 1 / (K1 Qmax)
 
 };
 
@@ -221,7 +221,7 @@ inline Real K3 () const {return  Value(2);};
 /// </example>
 ///  @param _qmax Novo valor da constante de Redlich-Peterson.
 ///  @exception _k1 <= 0.
-     void K1 (const Real& _k1)  {*this = RedlichPeterson(_k1, Value(1), Value(2));};
+     void K1 (const Real& _k1)  {SetParameters(std::array {_k1, Value(1), Value(2)});};
      
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante de Redlich - Peterson.
@@ -236,7 +236,7 @@ inline Real K3 () const {return  Value(2);};
 /// </example>
 ///  @param _k2 Novo valor do coeficiente associado a constante de RedlichPeterson.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = RedlichPeterson(Value(0), _k2, Value(2));};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), _k2, Value(2)});};
     
 /// <summary>
 /// Funcao para alterar o valor do coeficiente que reflete a heterogeneidade do adsorvente.
@@ -251,7 +251,7 @@ inline Real K3 () const {return  Value(2);};
 /// </example>
 ///  @param _k3 Novo valor do coeficiente que reflete a heterogeneidade do adsorvente.
 ///  @exception _k3 <= 0.    
-    void K3 (const Real& _k3)  {*this = RedlichPeterson(Value(0), Value(1), _k3);};
+    void K3 (const Real& _k3)  {SetParameters(std::array {Value(0), Value(1), _k3});};
 
 
 //==============================================================================
@@ -273,6 +273,8 @@ inline Real K3 () const {return  Value(2);};
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.   
     
+    using Isotherm::Qe;
+
     [[nodiscard]]  Real Qe (const Real&, const Real&) const;    
     
     [[nodiscard]] 
@@ -282,13 +284,36 @@ inline Real K3 () const {return  Value(2);};
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<RedlichPeterson>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
 
+Real                    compK3  = 0;         //! 1 - K3
 
 };
 
@@ -220,7 +220,7 @@ public:
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = Toth(_qmax, Value(1), Value(2));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1), Value(2)});};
 
 /// <summary>
 /// Funcao que altera o coeficiente associado a constante de Toth.
@@ -235,7 +235,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor do coeficiente associado a constante de Toth.
 ///  @exception _k1 <= 0.
-     void K1 (const Real& _k1)  {*this = Toth(Value(0), _k1, Value(2));};
+     void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1, Value(2)});};
 
 /// <summary>
 /// Funcao para alterar o valor do expoente da isoterma de Toth.
@@ -250,7 +250,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor do expoente da isoterma de Toth.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = Toth(Value(0), Value(1), _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), Value(1), _k2});};
 
 
 //==============================================================================
@@ -272,6 +272,8 @@ public:
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
 
+    using Isotherm::Qe;
+
     [[nodiscard]]  Real Qe (const Real&, const Real&) const;
 
     [[nodiscard]] 
@@ -281,14 +283,40 @@ public:
         return Qe(_c, 0);
     }
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<Toth>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    invK2   = 0;         //! 1 / K2
+Real                    prodQ   = 0;         //! Qmax / K1
+Real                    expoD   = 0;         //! - 1 / K2 - 1
 
-    
 };
 
 IST_NAMESPACE_CLOSE
@@ -239,7 +239,7 @@ inline Real K2 () const
 ///  @exception _qmax <= 0.
 inline void Qmax (const Real& _qmax)  
 {
-    *this = ViethSladek (_qmax, Value(1), Value(2));
+    SetParameters(std::array {_qmax, Value(1), Value(2)});
 };
 
 /// <summary>
@@ -257,7 +257,7 @@ inline void Qmax (const Real& _qmax)
 ///  @exception _k1 <= 0.
 inline void K1 (const Real& _k1)  
 {
-    *this = ViethSladek (Value(0), _k1, Value(2));
+    SetParameters(std::array {Value(0), _k1, Value(2)});
 };
 
 /// <summary>
@@ -275,7 +275,7 @@ inline void K1 (const Real& _k1)
 ///  @exception _k2 <= 0.    
 inline void K2 (const Real& _k2)  
 {
-    *this = ViethSladek(Value(0), Value(1), _k2);
+    SetParameters(std::array {Value(0), Value(1), _k2});
 };
     
     
@@ -298,6 +298,8 @@ inline void K2 (const Real& _k2)
 ///  @return Valor da quantidade de sorcao no equilíbrio.    
 ///  @exception _c < 0.    
 
+    using Isotherm::Qe;
+
     [[nodiscard]]  Real Qe (const Real&, const Real&) const;
 
     [[nodiscard]] 
@@ -308,13 +310,37 @@ inline void K2 (const Real& _k2)
     }
 
 
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<ViethSladek>(*this);
     }
 
-    
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    prodQK  = 0;         //! Qmax K1
+
 };
 
 IST_NAMESPACE_CLOSE
@@ -214,7 +214,7 @@ inline Real K1 () const
 ///  @param " " Nao ha parametros.
 ///  @return Valor da constante universal dos gases.
 [[maybe_unused]] [[nodiscard]] 
-inline Real Rgas () const
+inline Real Rgas () const override
 {
     return  RGAS;
 };
@@ -239,10 +239,7 @@ inline Real Rgas () const
 ///  @exception _qmax <= 0.
 inline void Qmax (const Real& _qmax)
 {
-    *this = DubininRadushkevich     (   _qmax
-                                    ,   Value(1)
-                                    , this->Rgas()
-                                    );
+    SetParameters(std::array {_qmax, Value(1)});
 };
 
 
@@ -261,10 +258,7 @@ inline void Qmax (const Real& _qmax)
 ///  @exception _k1 <= 0. 
 inline  void K1 (const Real& _k1)
 {
-    *this = DubininRadushkevich (   Value(0)
-                                ,   _k1
-                                ,   this->Rgas()
-                                );
+    SetParameters(std::array {Value(0), _k1});
 };
 
 /// <summary>
@@ -281,7 +275,7 @@ inline  void K1 (const Real& _k1)
 ///  @param _rgas Novo valor da constante universal dos gases.
 ///  @exception _rgas <= 0.
 [[maybe_unused]] 
-inline  void Rgas (const Real& _rgas)
+inline  void Rgas (const Real& _rgas) override
 {
     *this = DubininRadushkevich     (   Value(0)
                                     ,   Value(1)
@@ -311,6 +305,8 @@ inline  void Rgas (const Real& _rgas)
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c <= 0.
 ///  @exception _temp <= 0.
+    using Isotherm::Qe;
+
     [[nodiscard]]  
     Real Qe     (   const Real& _c
                 ,   const Real& _temp
@@ -338,6 +334,26 @@ inline  void Rgas (const Real& _rgas)
     }
 
 
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
 /// <summary>
 /// Funcao que faz o clone da classe virtual.
 /// </summary>
@@ -354,6 +370,22 @@ private:
 
 Real                    RGAS = Isotherm::RGASCONST;      /// Valor default da constante universal dos gases.
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    prodKR  = 0;         //! 2 K1 R
+
 };
 
 
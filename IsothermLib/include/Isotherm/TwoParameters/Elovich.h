@@ -219,7 +219,7 @@ inline Real K1 () const
 ///  @exception _qmax <= 0.   
 inline void Qmax (  const Real& _qmax)  
 {
-    *this = Elovich(_qmax, Value(1));
+    SetParameters(std::array {_qmax, Value(1)});
 };
 
 
@@ -238,7 +238,7 @@ inline void Qmax (  const Real& _qmax)
 ///  @exception _k1 <= 0.
 inline void K1 (const Real& _k1)  
 {
-    *this = Elovich(Value(0), _k1);
+    SetParameters(std::array {Value(0), _k1});
 };
 
 //==============================================================================
@@ -260,6 +260,8 @@ inline void K1 (const Real& _k1)
 ///  @param _temp Variavel nao utilizada neste modelo e que pode ser omitida.
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     Real Qe (const Real&_c, const Real& _temp) const override;
 
@@ -272,6 +274,15 @@ inline void K1 (const Real& _k1)
     
     
 
+/// <summary>
+/// Isoterma inversa explicita Ce(qe) e derivada dCe/dqe.
+/// </summary>
+    [[nodiscard]]
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -285,11 +296,23 @@ inline void K1 (const Real& _k1)
 
 private:
     
-   [[nodiscard]] Real  FQe (const Real&) const;
+   [[nodiscard]] Real  FQe (const Real&, const Real&) const;
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
 
 private:
-    
-   Real                 auxiCe = 0;
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    invK1Q  = 0;         //! 1 / (K1 Qmax)
 
 };
 
@@ -213,7 +213,7 @@ public:
 ///  @exception _k1 <= 0.
 inline void K1 (const Real& _k1)  
 {
-    *this = Freundlich(_k1, Value(1));
+    SetParameters(std::array {_k1, Value(1)});
 };
 
 
@@ -232,7 +232,7 @@ inline void K1 (const Real& _k1)
 ///  @exception _k2 <= 0.
 inline void K2 (const Real& _k2)  
 {
-    *this = Freundlich(Value(0), _k2);
+    SetParameters(std::array {Value(0), _k2});
 };
 
 //==============================================================================
@@ -253,11 +253,33 @@ inline void K2 (const Real& _k2)
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     Real Qe (   const Real& _c
-            ,   const Real& _temp = 0) const override;
+            ,   const Real& _temp) const override;
 
     
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -269,6 +291,17 @@ private:
     
 Real        invK2 = 0.0;
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
 };
 /// \example TesteFreundlich.cpp
  
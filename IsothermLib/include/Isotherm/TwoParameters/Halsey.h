@@ -212,7 +212,7 @@ inline Real K2 () const
 ///  @exception _k1 <= 0.
 inline void K1 (const Real& _k1)
 {
-    *this = Halsey(_k1, Value(1));
+    SetParameters(std::array {_k1, Value(1)});
 };
 
 
@@ -231,13 +231,15 @@ inline void K1 (const Real& _k1)
 ///  @exception _k2 <= 0.
 inline void K2 (const Real& _k2)
 {
-    *this = Halsey(Value(0), _k2);
+    SetParameters(std::array {Value(0), _k2});
 };
 
 //==============================================================================
 // Funcoes virtuais
 //==============================================================================
 
+    using Isotherm::Qe;
+
     virtual Real Qe         (   const Real& _c
                             ,   const Real& _temp
                             ) const;
@@ -264,14 +266,47 @@ inline void K2 (const Real& _k2)
                         return Qe(_c, 0);
                     };
 
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
         return std::make_unique<Halsey>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK2   = 0;         //! 1 / K2
 
-    
 };
 
 /// \example TesteHalsey.cpp
@@ -203,7 +203,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor da constante da isoterma de Harkin-Jura.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = HarkinJura(_k1, Value(1));};
+    void K1 (const Real& _k1)  {SetParameters(std::array {_k1, Value(1)});};
 
 
 /// <summary>
@@ -219,7 +219,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor da constante da isoterma de Harkin-Jura.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = HarkinJura(Value(0), _k2);};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), _k2});};
 
 //==============================================================================
 // Funcoes virtuais
@@ -242,6 +242,8 @@ public:
 ///  @return Valor da quantidade de sorcao no equilibrio.    
 ///  @exception _c < 0.
     
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     inline Real Qe   (   const Real& _c
     ) const override
@@ -250,9 +252,33 @@ public:
     }    
     
     private: 
+    friend class IsothermTemplate < HarkinJura >;   //! Laco de Qe em bloco
+
     [[nodiscard]] 
     Real Qe (const Real&_c, const Real& _temp) const override;
     
+public:
+
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -261,6 +287,15 @@ public:
 
  
     
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+protected:
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
 };
 
 /// \example TesteHarkinJura.cpp
@@ -208,7 +208,7 @@ inline Real Qmax () const {return  Value(0);};
 /// </example>
 ///  @param _qmax Novo valor da capacidade maxima de adsorcao.
 ///  @exception _qmax <= 0.
-    void Qmax (const Real& _qmax)  {*this = Jovanovic(_qmax, Value(1));};
+    void Qmax (const Real& _qmax)  {SetParameters(std::array {_qmax, Value(1)});};
 
 
 /// <summary>
@@ -224,7 +224,7 @@ inline Real Qmax () const {return  Value(0);};
 /// </example>
 ///  @param _k1 Novo valor da constante da isoterma de Jovanovic.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = Jovanovic(Value(0), _k1);};
+    void K1 (const Real& _k1)  {SetParameters(std::array {Value(0), _k1});};
 
 //==============================================================================
 // Funcoes virtuais
@@ -244,11 +244,32 @@ inline Real Qmax () const {return  Value(0);};
 ///  @param _c Concentracao do soluto.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c < 0.
+    using Isotherm::Qe;
+
     [[nodiscard]]
     Real Qe (   const Real& _c
-            ,   const Real& _temp = 0
-            ) const;
+            ,   const Real& _temp) const;
+
+
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
 
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
 
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
@@ -256,6 +277,21 @@ inline Real Qmax () const {return  Value(0);};
         return std::make_unique<Jovanovic>(*this);
     }
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    prodQK  = 0;         //! Qmax K1
 
 };
 
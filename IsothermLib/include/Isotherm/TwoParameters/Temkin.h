@@ -200,7 +200,7 @@ public:
 /// </example>
 ///  @param " " Nao ha parametros.
 ///  @return Valor da constante universal dos gases.
-    inline Real Rgas () const {return  RGAS;};
+    inline Real Rgas () const override {return  RGAS;};
 
 
 //==============================================================================
@@ -220,7 +220,7 @@ public:
 /// </example>
 ///  @param _k1 Novo valor da constante da isoterma de Temkin.
 ///  @exception _k1 <= 0.
-    void K1 (const Real& _k1)  {*this = Temkin(_k1, Value(1), this->Rgas());};
+    void K1 (const Real& _k1)  {SetParameters(std::array {_k1, Value(1)});};
 
 
 /// <summary>
@@ -236,7 +236,7 @@ public:
 /// </example>
 ///  @param _k2 Novo valor do coeficiente associado a constante de ligacao de equilibrio isotermica.
 ///  @exception _k2 <= 0.
-    void K2 (const Real& _k2)  {*this = Temkin(Value(0), _k2, this->Rgas());};
+    void K2 (const Real& _k2)  {SetParameters(std::array {Value(0), _k2});};
 
 /// <summary>
 /// Funcao para alterar o valor da constante universal dos gases.
@@ -251,7 +251,7 @@ public:
 /// </example>
 ///  @param _rgas Novo valor da constante universal dos gases.
 ///  @exception _rgas <= 0.
-    void Rgas (const Real& _rgas) {*this = Temkin(Value(0), Value(1), _rgas);};
+    void Rgas (const Real& _rgas) override {*this = Temkin(Value(0), Value(1), _rgas);};
 
 //==============================================================================
 // Funcoes virtuais
@@ -272,11 +272,33 @@ public:
 ///  @param _temp Temperatura em K.
 ///  @return Valor da quantidade de sorcao no equilibrio.
 ///  @exception _c k1 < 1.
+    using Isotherm::Qe;
+
     [[nodiscard]] 
     Real Qe (const Real& _c, const Real& _temp) const;
     
     
     
+/// <summary>
+/// Isoterma inversa Ce(qe) na forma fechada.
+/// </summary>
+///  @exception _qe < 0 ou fora da faixa atingida pela isoterma.
+    using Isotherm::Ce;
+
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe na forma analitica.
+/// </summary>
+///  @exception _c fora do dominio de Qe.
+    using Isotherm::DQDC;
+
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
     [[nodiscard]]
     virtual std::unique_ptr<Isotherm> CloneImplementation() const override
     {
@@ -287,6 +309,21 @@ private:
 
 Real                    RGAS = Isotherm::RGASCONST;      /// Valor default da constante universal dos gases.
 
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+protected:
+
+    void Prepare () override;
+
+    [[nodiscard]]
+    bool CheckParameters (std::span<const Real>, IsoExceptionIndex&) const override;
+
+private:
+
+Real                    invK1   = 0;         //! 1 / K1
+Real                    prodRK  = 0;         //! R / K2
 
 };
 
@@ -0,0 +1,199 @@
+//==============================================================================
+// Name        : Avrami.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo cinetico de Avrami
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup Avrami Avrami
+ *  @ingroup Kinetics
+ *  Modelo cinetico de Avrami.
+ *  @{
+ */
+
+/// <summary>
+/// Modelo cinetico de Avrami.
+/// </summary>
+///  Modelo com tres coeficientes, \f$ qe \f$, \f$ kav \f$, \f$ nav \f$:
+///\begin{align}
+///     \[q(t) = q_e \left(1 - e^{-(k_{AV} t)^{n_{AV}}}\right)\]
+///\end{align}
+///  Um artigo de referencia: Lopes et al., [aqui](https://doi.org/10.1016/S0304-3894(03)00119-X).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __AVRAMI_H__
+#define __AVRAMI_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>            // std::exp, std::log
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Kinetics.h>
+
+IST_NAMESPACE_OPEN
+
+class Avrami : public KineticsTemplate < Avrami >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "Avrami"
+                    ,   ID::Avrami
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    Avrami() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    Avrami(const Avrami&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~Avrami() = default;
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, que tambem sao os valores
+/// iniciais do ajuste.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Avrami  var(qe, kav, nav);
+///     Real    qt = var.Qt(t);
+/// @endcode
+/// </example>
+///  @param _qe Quantidade adsorvida no equilibrio.
+///  @param _kav Constante de velocidade de Avrami.
+///  @param _nav Expoente de Avrami.
+///  @exception _qe <= 0.
+///  @exception _kav <= 0.
+///  @exception _nav <= 0.
+    Avrami   (   const Real& _qe
+             ,   const Real& _kav
+             ,   const Real& _nav
+             );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    Avrami& operator = (const Avrami&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe inline
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida no equilibrio.
+/// </summary>
+    [[nodiscard]]
+    inline Real Qe () const {return  coeffValue[0];};
+
+/// <summary>
+/// Constante de velocidade de Avrami.
+/// </summary>
+    [[nodiscard]]
+    inline Real Kav () const {return  coeffValue[1];};
+
+/// <summary>
+/// Expoente de Avrami.
+/// </summary>
+    [[nodiscard]]
+    inline Real Nav () const {return  coeffValue[2];};
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Avalia q(_t) sem verificacoes e, se _grad nao e nulo, escreve em _grad as
+/// derivadas (dq/dqe, dq/dkav, dq/dnav).
+/// </summary>
+    inline Real Evaluate (const Real& _t, Real* _grad) const
+    {
+
+    const Real  qe (coeffValue[0]);
+    const Real  kt (coeffValue[1] * _t);
+    const Real  x (std::pow(kt, coeffValue[2]));
+    const Real  e (std::exp(- x));
+
+        if (_grad) {
+            _grad[0] = 1.0 - e;
+            _grad[1] = qe * e * x * coeffValue[2] / coeffValue[1];
+            _grad[2] = kt > 0.0 ? qe * e * x * std::log(kt) : 0.0;
+        }
+
+        return qe * (1.0 - e);
+
+    }
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    [[nodiscard]] bool Valid (const VecReal&) const override;
+
+    [[nodiscard]] bool EquilibriumIndex (UInt& _i) const override {_i = 0; return true;};
+
+};
+
+
+/// \example TesteAvrami.cpp
+///Este e um arquivo com exemplos de aplicacao da classe Avrami.
+
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __AVRAMI_H__ */
+
+/** @} */
@@ -0,0 +1,187 @@
+//==============================================================================
+// Name        : ElovichKinetic.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo cinetico de Elovich
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ElovichKinetic ElovichKinetic
+ *  @ingroup Kinetics
+ *  Modelo cinetico de Elovich.
+ *  @{
+ */
+
+/// <summary>
+/// Modelo cinetico de Elovich.
+/// </summary>
+///  Modelo com dois coeficientes, \f$ alpha \f$, \f$ beta \f$:
+///\begin{align}
+///     \[q(t) = \frac{1}{\beta} \ln\left(1 + \alpha \beta t\right)\]
+///\end{align}
+///  Um artigo de referencia: Chien e Clayton, [aqui](https://doi.org/10.2136/sssaj1980.03615995004400020013x).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __ELOVICH_KINETIC_H__
+#define __ELOVICH_KINETIC_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>            // std::exp, std::log
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Kinetics.h>
+
+IST_NAMESPACE_OPEN
+
+class ElovichKinetic : public KineticsTemplate < ElovichKinetic >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "ElovichKinetic"
+                    ,   ID::ElovichKinetic
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ElovichKinetic() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    ElovichKinetic(const ElovichKinetic&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ElovichKinetic() = default;
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, que tambem sao os valores
+/// iniciais do ajuste.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ElovichKinetic  var(alpha, beta);
+///     Real            qt = var.Qt(t);
+/// @endcode
+/// </example>
+///  @param _alpha Taxa inicial de adsorcao.
+///  @param _beta Constante de dessorcao.
+///  @exception _alpha <= 0.
+///  @exception _beta <= 0.
+    ElovichKinetic   (   const Real& _alpha
+                     ,   const Real& _beta
+                     );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ElovichKinetic& operator = (const ElovichKinetic&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe inline
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Taxa inicial de adsorcao.
+/// </summary>
+    [[nodiscard]]
+    inline Real Alpha () const {return  coeffValue[0];};
+
+/// <summary>
+/// Constante de dessorcao.
+/// </summary>
+    [[nodiscard]]
+    inline Real Beta () const {return  coeffValue[1];};
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Avalia q(_t) sem verificacoes e, se _grad nao e nulo, escreve em _grad as
+/// derivadas (dq/dalpha, dq/dbeta).
+/// </summary>
+    inline Real Evaluate (const Real& _t, Real* _grad) const
+    {
+
+    const Real  alpha (coeffValue[0]);
+    const Real  beta (coeffValue[1]);
+    const Real  x (1.0 + alpha * beta * _t);
+    const Real  q (std::log(x) / beta);
+
+        if (_grad) {
+            _grad[0] = _t / x;
+            _grad[1] = (alpha * _t / x - q) / beta;
+        }
+
+        return q;
+
+    }
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    [[nodiscard]] bool Valid (const VecReal&) const override;
+
+};
+
+
+/// \example TesteElovichKinetic.cpp
+///Este e um arquivo com exemplos de aplicacao da classe ElovichKinetic.
+
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __ELOVICH_KINETIC_H__ */
+
+/** @} */
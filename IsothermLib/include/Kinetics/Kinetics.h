@@ -0,0 +1,342 @@
+//==============================================================================
+// Name        : Kinetics.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe base dos modelos cineticos de adsorcao
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup KineticsBase Kinetics
+ *  @ingroup Kinetics
+ *  Classe base de todos os modelos cineticos.
+ *  @{
+ */
+
+/// <summary>
+/// Classe base dos modelos cineticos de adsorcao, q(t).
+/// </summary>
+///  Paralela a Isotherm: os coeficientes ficam em coeffValue, os nomes e
+///  descricoes em InfoKinetics(), e cada modelo e identificado por ID.
+///  A avaliacao em bloco sobre um vetor de tempos e a jacobiana analitica em
+///  relacao aos coeficientes sao geradas por KineticsTemplate a partir da
+///  funcao inline Evaluate() de cada modelo, sem chamadas virtuais por ponto.
+///
+///  Fit() ajusta os coeficientes livres por Levenberg-Marquardt com a
+///  jacobiana analitica. Nos modelos com qe, Equilibrium() obtem qe de uma
+///  isoterma e o mantem fixo no ajuste. Varias corridas cineticas podem ser
+///  ajustadas em paralelo pela versao estatica de Fit().
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __KINETICS_H__
+#define __KINETICS_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <span>             // std::span
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class Kinetics {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Kinetics"
+                        ,   ID::Kinetics
+                        );
+
+//==============================================================================
+// Construtoras / Destrutora
+//==============================================================================
+
+public:
+
+    Kinetics() = default;
+    Kinetics(const Kinetics&) = default;
+    virtual ~Kinetics() = default;
+
+protected:
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, todos livres.
+/// </summary>
+    explicit Kinetics   (   const VecReal&  _coeff
+                        )
+                        :   coeffValue(_coeff)
+                        ,   fixedCoeff(_coeff.size(), false)
+    {
+    }
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+protected:
+
+    Kinetics& operator = (const Kinetics&) = default;
+
+//==============================================================================
+// Funcoes puramente virtuais
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida no instante _t.
+/// </summary>
+///  @exception _t < 0.
+    [[nodiscard]] virtual Real Qt (const Real&) const = 0;
+
+/// <summary>
+/// Quantidade adsorvida para um conjunto de instantes.
+/// </summary>
+///  @param _t Instantes.
+///  @param _q Quantidades adsorvidas, com o mesmo tamanho de _t.
+    virtual void Qt (   std::span<const Real>
+                    ,   std::span<Real>) const = 0;
+
+/// <summary>
+/// Jacobiana analitica dq/dcoef, armazenada por linhas: a linha k contem as
+/// derivadas de q(t_k) em relacao a cada coeficiente.
+/// </summary>
+///  @param _t Instantes.
+///  @param _jac Jacobiana, com _t.size() * NumberConst() elementos.
+    virtual void Jacobian   (   std::span<const Real>
+                            ,   std::span<Real>) const = 0;
+
+    [[nodiscard]] virtual std::unique_ptr<Kinetics> Clone() const = 0;
+
+//==============================================================================
+// Acoplamento com o equilibrio e ajuste
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Obtem qe da isoterma na concentracao de equilibrio e o mantem fixo no
+/// ajuste.
+/// </summary>
+///  @param _iso Isoterma de equilibrio.
+///  @param _ce Concentracao de equilibrio.
+///  @param _temperature Temperatura, opcional.
+///  @exception Modelo sem qe.
+    void Equilibrium    (   const Isotherm&
+                        ,   const Real&
+                        ,   const Real& = 0);
+
+/// <summary>
+/// Fixa ou libera o coeficiente _i no ajuste.
+/// </summary>
+    void Fix (const UInt&, const bool& = true);
+
+    [[nodiscard]] inline bool Fixed (const UInt& _i) const {return fixedCoeff.at(_i);};
+
+/// <summary>
+/// Ajusta os coeficientes livres aos dados por Levenberg-Marquardt, a
+/// partir dos valores atuais.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     PseudoSecondOrder   pso(1.0, 0.1);
+///     Real                sse = pso.Fit(time, qt);
+/// @endcode
+/// </example>
+///  @param _t Instantes.
+///  @param _q Quantidades adsorvidas medidas.
+///  @param _itermax Numero maximo de iteracoes.
+///  @param _tole Tolerancia relativa da soma dos quadrados e do passo.
+///  @return Soma dos quadrados dos residuos.
+///  @exception Vetores de tamanhos diferentes ou menos pontos que coeficientes livres.
+    Real Fit    (   std::span<const Real>
+                ,   std::span<const Real>
+                ,   const UInt& = 200
+                ,   const Real& = 1.0e-10);
+
+/// <summary>
+/// Ajusta varias corridas em paralelo, uma por modelo.
+/// </summary>
+///  @param _models Modelos, com os valores iniciais dos coeficientes.
+///  @param _t Instantes de cada corrida.
+///  @param _q Quantidades adsorvidas de cada corrida.
+///  @param _sse Soma dos quadrados dos residuos de cada corrida.
+///  @param _nthreads Numero de threads. 0 utiliza todos os nucleos.
+    static void Fit (   std::vector < std::unique_ptr < Kinetics > >&
+                    ,   const std::vector < VecReal >&
+                    ,   const std::vector < VecReal >&
+                    ,   VecReal&
+                    ,   const UInt& = 0);
+
+//==============================================================================
+// Acesso aos coeficientes
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline const VecReal& Coefficients () const {return coeffValue;};
+    [[nodiscard]] inline size_t NumberConst () const {return coeffValue.size();};
+
+    [[nodiscard]] std::string CodeString (const UInt&) const;
+    [[nodiscard]] std::string NameString (const UInt&) const;
+
+    inline auto begin() const {return  InfoKinetics().begin();};
+    inline auto end() const {return  InfoKinetics().end();};
+    inline auto cbegin() const {return  InfoKinetics().cbegin();};
+    inline auto cend() const {return  InfoKinetics().cend();};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    virtual const VecPairString& InfoKinetics() const = 0;
+
+/// <summary>
+/// Verifica se os coeficientes _coeff definem o modelo. Usada para rejeitar
+/// passos do ajuste.
+/// </summary>
+    [[nodiscard]] virtual bool Valid (const VecReal&) const = 0;
+
+/// <summary>
+/// Indice de qe entre os coeficientes; false se o modelo nao o possui.
+/// </summary>
+    [[nodiscard]] virtual bool EquilibriumIndex ([[maybe_unused]] UInt& _i) const {return false;};
+
+/// <summary>
+/// Verifica a definicao dos coeficientes e os instantes de uma avaliacao.
+/// </summary>
+    void CheckTime (std::span<const Real>) const;
+
+/// <summary>
+/// Verifica se os vetores de uma avaliacao em bloco tem o tamanho esperado.
+/// </summary>
+    void CheckBlock (const size_t&, const size_t&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+VecReal                                                 coeffValue;
+std::vector < bool >                                    fixedCoeff;
+bool                                                    setup = false;
+
+};
+
+
+/// <summary>
+/// Classe que gera a avaliacao em bloco, a jacobiana e a clonagem de cada
+/// modelo a partir de T::Evaluate(t, grad), e que guarda os nomes dos
+/// coeficientes.
+/// </summary>
+template <typename T>
+class KineticsTemplate : public Kinetics
+{
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+protected:
+
+    KineticsTemplate() = default;
+    KineticsTemplate(const KineticsTemplate&) = default;
+
+    explicit KineticsTemplate (const VecReal& _coeff) : Kinetics(_coeff) {};
+
+    KineticsTemplate& operator = (const KineticsTemplate&) = default;
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+    [[nodiscard]] Real Qt (const Real& _t) const override
+    {
+        CheckTime(std::span<const Real>(&_t, 1));
+        return static_cast<const T&>(*this).Evaluate(_t, nullptr);
+    }
+
+    void Qt (   std::span<const Real>   _t
+            ,   std::span<Real>         _q
+            ) const override
+    {
+        CheckBlock(_t.size(), _q.size());
+        CheckTime(_t);
+
+    const T&    model (static_cast<const T&>(*this));
+
+        for (size_t k = 0; k < _t.size(); ++k) _q[k] = model.Evaluate(_t[k], nullptr);
+    }
+
+    void Jacobian   (   std::span<const Real>   _t
+                    ,   std::span<Real>         _jac
+                    ) const override
+    {
+        CheckBlock(_t.size() * NumberConst(), _jac.size());
+        CheckTime(_t);
+
+    const T&        model (static_cast<const T&>(*this));
+    const size_t    np (NumberConst());
+
+        for (size_t k = 0; k < _t.size(); ++k) model.Evaluate(_t[k], &_jac[k * np]);
+    }
+
+    [[nodiscard]] std::unique_ptr<Kinetics> Clone() const override
+    {
+        return std::make_unique<T>(static_cast<const T&>(*this));
+    }
+
+//==============================================================================
+// Nomes dos coeficientes
+//==============================================================================
+
+protected:
+
+    const VecPairString& InfoKinetics() const override { return infoKinetics; }
+
+    static VecPairString                    infoKinetics;       //! Vetor com nome e sigla dos coeficientes
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __KINETICS_H__ */
+
+/** @} */
@@ -0,0 +1,187 @@
+//==============================================================================
+// Name        : PseudoFirstOrder.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo cinetico de pseudo-primeira ordem (Lagergren)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup PseudoFirstOrder PseudoFirstOrder
+ *  @ingroup Kinetics
+ *  Modelo cinetico de pseudo-primeira ordem (Lagergren).
+ *  @{
+ */
+
+/// <summary>
+/// Modelo cinetico de pseudo-primeira ordem (Lagergren).
+/// </summary>
+///  Modelo com dois coeficientes, \f$ qe \f$, \f$ k1 \f$:
+///\begin{align}
+///     \[q(t) = q_e \left(1 - e^{-k_1 t}\right)\]
+///\end{align}
+///  Um artigo de referencia: Lagergren (1898); Ho e McKay, [aqui](https://doi.org/10.1016/S0032-9592(98)00112-5).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __PSEUDO_FIRST_ORDER_H__
+#define __PSEUDO_FIRST_ORDER_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>            // std::exp, std::log
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Kinetics.h>
+
+IST_NAMESPACE_OPEN
+
+class PseudoFirstOrder : public KineticsTemplate < PseudoFirstOrder >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "PseudoFirstOrder"
+                    ,   ID::PseudoFirstOrder
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    PseudoFirstOrder() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    PseudoFirstOrder(const PseudoFirstOrder&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~PseudoFirstOrder() = default;
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, que tambem sao os valores
+/// iniciais do ajuste.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     PseudoFirstOrder  var(qe, k1);
+///     Real              qt = var.Qt(t);
+/// @endcode
+/// </example>
+///  @param _qe Quantidade adsorvida no equilibrio.
+///  @param _k1 Constante de velocidade de pseudo-primeira ordem.
+///  @exception _qe <= 0.
+///  @exception _k1 <= 0.
+    PseudoFirstOrder   (   const Real& _qe
+                       ,   const Real& _k1
+                       );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    PseudoFirstOrder& operator = (const PseudoFirstOrder&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe inline
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida no equilibrio.
+/// </summary>
+    [[nodiscard]]
+    inline Real Qe () const {return  coeffValue[0];};
+
+/// <summary>
+/// Constante de velocidade de pseudo-primeira ordem.
+/// </summary>
+    [[nodiscard]]
+    inline Real K1 () const {return  coeffValue[1];};
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Avalia q(_t) sem verificacoes e, se _grad nao e nulo, escreve em _grad as
+/// derivadas (dq/dqe, dq/dk1).
+/// </summary>
+    inline Real Evaluate (const Real& _t, Real* _grad) const
+    {
+
+    const Real  qe (coeffValue[0]);
+    const Real  e (std::exp(- coeffValue[1] * _t));
+
+        if (_grad) {
+            _grad[0] = 1.0 - e;
+            _grad[1] = qe * _t * e;
+        }
+
+        return qe * (1.0 - e);
+
+    }
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    [[nodiscard]] bool Valid (const VecReal&) const override;
+
+    [[nodiscard]] bool EquilibriumIndex (UInt& _i) const override {_i = 0; return true;};
+
+};
+
+
+/// \example TestePseudoFirstOrder.cpp
+///Este e um arquivo com exemplos de aplicacao da classe PseudoFirstOrder.
+
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __PSEUDO_FIRST_ORDER_H__ */
+
+/** @} */
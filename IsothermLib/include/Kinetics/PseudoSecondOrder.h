@@ -0,0 +1,188 @@
+//==============================================================================
+// Name        : PseudoSecondOrder.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo cinetico de pseudo-segunda ordem (Ho e McKay)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup PseudoSecondOrder PseudoSecondOrder
+ *  @ingroup Kinetics
+ *  Modelo cinetico de pseudo-segunda ordem (Ho e McKay).
+ *  @{
+ */
+
+/// <summary>
+/// Modelo cinetico de pseudo-segunda ordem (Ho e McKay).
+/// </summary>
+///  Modelo com dois coeficientes, \f$ qe \f$, \f$ k2 \f$:
+///\begin{align}
+///     \[q(t) = \frac{q_e^2 k_2 t}{1 + q_e k_2 t}\]
+///\end{align}
+///  Um artigo de referencia: Ho e McKay, [aqui](https://doi.org/10.1016/S0032-9592(98)00112-5).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __PSEUDO_SECOND_ORDER_H__
+#define __PSEUDO_SECOND_ORDER_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>            // std::exp, std::log
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Kinetics.h>
+
+IST_NAMESPACE_OPEN
+
+class PseudoSecondOrder : public KineticsTemplate < PseudoSecondOrder >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "PseudoSecondOrder"
+                    ,   ID::PseudoSecondOrder
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    PseudoSecondOrder() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    PseudoSecondOrder(const PseudoSecondOrder&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~PseudoSecondOrder() = default;
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, que tambem sao os valores
+/// iniciais do ajuste.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     PseudoSecondOrder  var(qe, k2);
+///     Real               qt = var.Qt(t);
+/// @endcode
+/// </example>
+///  @param _qe Quantidade adsorvida no equilibrio.
+///  @param _k2 Constante de velocidade de pseudo-segunda ordem.
+///  @exception _qe <= 0.
+///  @exception _k2 <= 0.
+    PseudoSecondOrder   (   const Real& _qe
+                        ,   const Real& _k2
+                        );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    PseudoSecondOrder& operator = (const PseudoSecondOrder&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe inline
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida no equilibrio.
+/// </summary>
+    [[nodiscard]]
+    inline Real Qe () const {return  coeffValue[0];};
+
+/// <summary>
+/// Constante de velocidade de pseudo-segunda ordem.
+/// </summary>
+    [[nodiscard]]
+    inline Real K2 () const {return  coeffValue[1];};
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Avalia q(_t) sem verificacoes e, se _grad nao e nulo, escreve em _grad as
+/// derivadas (dq/dqe, dq/dk2).
+/// </summary>
+    inline Real Evaluate (const Real& _t, Real* _grad) const
+    {
+
+    const Real  qe (coeffValue[0]);
+    const Real  a (qe * coeffValue[1] * _t);
+    const Real  den (1.0 + a);
+
+        if (_grad) {
+            _grad[0] = a * (2.0 + a) / (den * den);
+            _grad[1] = qe * qe * _t / (den * den);
+        }
+
+        return qe * a / den;
+
+    }
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    [[nodiscard]] bool Valid (const VecReal&) const override;
+
+    [[nodiscard]] bool EquilibriumIndex (UInt& _i) const override {_i = 0; return true;};
+
+};
+
+
+/// \example TestePseudoSecondOrder.cpp
+///Este e um arquivo com exemplos de aplicacao da classe PseudoSecondOrder.
+
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __PSEUDO_SECOND_ORDER_H__ */
+
+/** @} */
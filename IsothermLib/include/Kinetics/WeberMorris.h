@@ -0,0 +1,184 @@
+//==============================================================================
+// Name        : WeberMorris.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo de difusao intraparticula de Weber-Morris
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup WeberMorris WeberMorris
+ *  @ingroup Kinetics
+ *  Modelo de difusao intraparticula de Weber-Morris.
+ *  @{
+ */
+
+/// <summary>
+/// Modelo de difusao intraparticula de Weber-Morris.
+/// </summary>
+///  Modelo com dois coeficientes, \f$ kid \f$, \f$ c \f$:
+///\begin{align}
+///     \[q(t) = k_{id} \sqrt{t} + C\]
+///\end{align}
+///  Um artigo de referencia: Weber e Morris, [aqui](https://doi.org/10.1061/JSEDAI.0000430).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __WEBER_MORRIS_H__
+#define __WEBER_MORRIS_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>            // std::exp, std::log
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Kinetics.h>
+
+IST_NAMESPACE_OPEN
+
+class WeberMorris : public KineticsTemplate < WeberMorris >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "WeberMorris"
+                    ,   ID::WeberMorris
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    WeberMorris() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    WeberMorris(const WeberMorris&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~WeberMorris() = default;
+
+/// <summary>
+/// Construtora com os coeficientes do modelo, que tambem sao os valores
+/// iniciais do ajuste.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     WeberMorris  var(kid, c);
+///     Real         qt = var.Qt(t);
+/// @endcode
+/// </example>
+///  @param _kid Constante de difusao intraparticula.
+///  @param _c Espessura da camada limite.
+///  @exception _kid <= 0.
+///  @exception _c < 0.
+    WeberMorris   (   const Real& _kid
+                  ,   const Real& _c
+                  );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    WeberMorris& operator = (const WeberMorris&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe inline
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Constante de difusao intraparticula.
+/// </summary>
+    [[nodiscard]]
+    inline Real Kid () const {return  coeffValue[0];};
+
+/// <summary>
+/// Espessura da camada limite.
+/// </summary>
+    [[nodiscard]]
+    inline Real C () const {return  coeffValue[1];};
+
+//==============================================================================
+// Avaliacao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Avalia q(_t) sem verificacoes e, se _grad nao e nulo, escreve em _grad as
+/// derivadas (dq/dkid, dq/dc).
+/// </summary>
+    inline Real Evaluate (const Real& _t, Real* _grad) const
+    {
+
+    const Real  s (std::sqrt(_t));
+
+        if (_grad) {
+            _grad[0] = s;
+            _grad[1] = 1.0;
+        }
+
+        return coeffValue[0] * s + coeffValue[1];
+
+    }
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    [[nodiscard]] bool Valid (const VecReal&) const override;
+
+};
+
+
+/// \example TesteWeberMorris.cpp
+///Este e um arquivo com exemplos de aplicacao da classe WeberMorris.
+
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __WEBER_MORRIS_H__ */
+
+/** @} */
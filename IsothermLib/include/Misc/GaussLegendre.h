@@ -0,0 +1,87 @@
+/** @defgroup GaussLegendre Quadratura de Gauss-Legendre
+ *  @ingroup Miscelinea
+ *  Pontos e pesos da quadratura de Gauss-Legendre.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : GaussLegendre.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Pontos e pesos da quadratura de Gauss-Legendre
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+#ifndef __GAUSS_LEGENDRE_ISOTHERM_H__
+#define __GAUSS_LEGENDRE_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <array>                // std::array
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/Configure.h>
+
+IST_NAMESPACE_OPEN
+
+/// <summary>
+/// Pontos da quadratura de Gauss-Legendre com 8 pontos em [-1, 1].
+/// </summary>
+inline constexpr std::array<Real, 8>    GL8X    =   { -0.9602898564975363, -0.7966664774136267
+                                                    , -0.5255324099163290, -0.1834346424956498
+                                                    ,  0.1834346424956498,  0.5255324099163290
+                                                    ,  0.7966664774136267,  0.9602898564975363 };
+
+/// <summary>
+/// Pesos da quadratura de Gauss-Legendre com 8 pontos em [-1, 1].
+/// </summary>
+inline constexpr std::array<Real, 8>    GL8W    =   {  0.1012285362903763,  0.2223810344533745
+                                                    ,  0.3137066458778873,  0.3626837833783620
+                                                    ,  0.3626837833783620,  0.3137066458778873
+                                                    ,  0.2223810344533745,  0.1012285362903763 };
+
+/// <summary>
+/// Integral de _func em [_a, _b] pela quadratura de Gauss-Legendre com 8 pontos.
+/// </summary>
+template <typename Func>
+inline Real GaussLegendre8  (   Func&&          _func
+                            ,   const Real&     _a
+                            ,   const Real&     _b
+                            )
+{
+
+const Real  half (0.5 * (_b - _a));
+const Real  mid (0.5 * (_b + _a));
+Real        sum (0.0);
+
+    for (UInt k = 0; k < 8; ++k) sum += GL8W[k] * _func(mid + half * GL8X[k]);
+
+    return half * sum;
+
+}
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __GAUSS_LEGENDRE_ISOTHERM_H__ */
+
+/** @} */
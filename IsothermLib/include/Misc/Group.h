@@ -93,3 +93,19 @@
 /** @defgroup Base Classes base das isotermas
  *  Grupo de Classes de onde sao derivadas as classes com os modelos de isotermas.
  */ 
+
+/** @defgroup Process Modelos de processo
+ *  Grupo de simuladores de processos de adsorcao que utilizam as isotermas.
+ */ 
+
+/** @defgroup Kinetics Modelos cineticos
+ *  Grupo de modelos cineticos de adsorcao, q(t), e do seu ajuste.
+ */ 
+
+/** @defgroup Surrogate Substitutos de isotermas
+ *  Grupo de isotermas que substituem modelos de avaliacao cara.
+ */ 
+
+/** @defgroup IO Entrada e saida de dados
+ *  Grupo de classes de leitura e gravacao de dados e curvas das isotermas.
+ */ 
@@ -99,6 +99,39 @@ public:
         ,   FritzSchlunderV = 500
         ,   FrenkelHalseyHill
         ,   Henderson       
+        ,   Multicomponent = 600
+        ,   ExtendedLangmuir
+        ,   ExtendedSips
+        ,   ExtendedRedlichPeterson
+        ,   ModifiedCompetitiveLangmuir
+        ,   IAST
+        ,   SpreadingPressureTable
+        ,   Process = 700
+        ,   Breakthrough
+        ,   BatchEquilibrium
+        ,   Chromatography
+        ,   PressureSwing
+        ,   Kinetics = 800
+        ,   PseudoFirstOrder
+        ,   PseudoSecondOrder
+        ,   ElovichKinetic
+        ,   Avrami
+        ,   WeberMorris
+        ,   Surrogate = 900
+        ,   TabulatedIsotherm
+        ,   MemoizedIsotherm
+        ,   IO = 1000
+        ,   CurveExport
+        ,   Dataset
+        ,   SweepWriter
+        ,   SweepReader
+        ,   ModelRegistry
+        ,   ModelSerializer
+        ,   Misc = 1100
+        ,   SolverStats
+        ,   Trace
+        ,   ThreadPool
+        ,   Sweep
   };    
     
 //==============================================================================
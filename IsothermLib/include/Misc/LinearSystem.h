@@ -0,0 +1,105 @@
+/** @defgroup LinearSystem Sistemas lineares densos
+ *  @ingroup Miscelinea
+ *  Eliminacao de Gauss para sistemas pequenos.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : LinearSystem.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Eliminacao de Gauss com pivotamento parcial para os sistemas
+//               pequenos dos metodos de minimos quadrados
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+
+#ifndef __LINEAR_SYSTEM_ISOTHERM_H__
+#define __LINEAR_SYSTEM_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <cmath>                // std::fabs, std::isfinite
+#include <utility>              // std::swap
+#include <vector>               // std::vector
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/Configure.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+/// <summary>
+/// Resolve _a x = _b por eliminacao de Gauss com pivotamento parcial.
+/// </summary>
+///  _a e _b sao destruidos e a solucao retorna em _b.
+///  @param _a Matriz quadrada, por linhas.
+///  @param _b Lado direito.
+///  @return false se a matriz e singular.
+inline bool GaussElimination    (   std::vector < std::vector < Real > >&   _a
+                                ,   std::vector < Real >&                   _b
+                                )
+{
+
+IST_TRACE("GaussElimination", "linalg");
+
+const size_t    n (_b.size());
+
+    for (size_t k = 0; k < n; ++k) {
+
+    size_t  piv (k);
+
+        for (size_t i = k + 1; i < n; ++i)
+            if (std::fabs(_a[i][k]) > std::fabs(_a[piv][k])) piv = i;
+
+        if (_a[piv][k] == 0.0) return false;
+
+        std::swap(_a[k], _a[piv]);
+        std::swap(_b[k], _b[piv]);
+
+        for (size_t i = k + 1; i < n; ++i) {
+
+        const Real  m (_a[i][k] / _a[k][k]);
+
+            for (size_t j = k; j < n; ++j) _a[i][j] -= m * _a[k][j];
+            _b[i] -= m * _b[k];
+        }
+    }
+
+    for (size_t k = n; k-- > 0;) {
+        for (size_t j = k + 1; j < n; ++j) _b[k] -= _a[k][j] * _b[j];
+        _b[k] /= _a[k][k];
+    }
+
+    for (const auto& x : _b)
+        if (!std::isfinite(x)) return false;
+
+    return true;
+
+}
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __LINEAR_SYSTEM_ISOTHERM_H__ */
+
+/** @} */
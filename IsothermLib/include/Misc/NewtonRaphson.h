@@ -16,7 +16,11 @@ using namespace std::placeholders;
 #include <Misc/Misc.h>
 
 typedef         std::function<Real(Real)>                           NRFunction;
-Real  NewtonRaphson (NRFunction, const Real&);
+/// <summary>
+/// Raiz de _func a partir de _ce. O ultimo argumento e o ID do modelo que
+/// chama o metodo, usado apenas pelos contadores de SolverStats.
+/// </summary>
+Real  NewtonRaphson (NRFunction, const Real&, const UInt& = 0);
 
 #endif /* __NEWTONRAPHSON_H__ */
 
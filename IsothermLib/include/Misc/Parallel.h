@@ -0,0 +1,107 @@
+/** @defgroup Parallel Execucao em paralelo
+ *  @ingroup Miscelinea
+ *  Funcao auxiliar para dividir lacos independentes entre varias threads.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : Parallel.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Divisao de lacos independentes entre threads
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+#ifndef __PARALLEL_ISOTHERM_H__
+#define __PARALLEL_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <algorithm>            // std::min
+#include <thread>               // std::thread
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/Configure.h>
+#include <Misc/ThreadPool.h>
+
+IST_NAMESPACE_OPEN
+
+/// <summary>
+/// Funcao que retorna o numero de threads a ser utilizado quando o usuario
+/// nao informa um valor (0).
+/// </summary>
+inline UInt NumberThreads (const UInt& _nthreads = 0)
+{
+    if (_nthreads > 0) return _nthreads;
+
+const UInt  nhard (std::thread::hardware_concurrency());
+
+    return nhard > 0 ? nhard : 1;
+}
+
+/// <summary>
+/// Divide o intervalo [0, _n) em _nthreads blocos contiguos e chama
+/// _func(inicio, fim) para cada bloco, como um lote de ThreadPool::Default().
+/// Como cada chamada recebe um unico bloco, _func pode preparar uma area de
+/// trabalho propria antes de percorrer o bloco. Com um so bloco, ou dentro
+/// de uma tarefa do conjunto, os blocos sao executados pela thread
+/// chamadora.
+/// </summary>
+///  E a forma de ThreadPool para lacos de blocos de custo semelhante: as
+///  threads de ThreadPool::Default() sao reaproveitadas, sem criar threads
+///  a cada chamada.
+///  @param _n Numero de iteracoes.
+///  @param _func Funcao com assinatura void(size_t, size_t).
+///  @param _nthreads Numero de blocos, limitado pelos trabalhadores de
+///  ThreadPool::Default() em execucao simultanea. 0 utiliza todos os nucleos.
+template <typename Func>
+void ParallelFor    (   const size_t&       _n
+                    ,   Func&&              _func
+                    ,   const UInt&         _nthreads = 0
+                    )
+{
+
+    if (_n == 0) return;
+
+const size_t    nthreads (std::min<size_t>(NumberThreads(_nthreads), _n));
+
+    if (nthreads == 1) {
+        _func(size_t(0), _n);
+        return;
+    }
+
+const size_t    chunk ((_n + nthreads - 1) / nthreads);
+
+    ThreadPool::Default().Run   (   (_n + chunk - 1) / chunk
+                                ,   [&_func, &_n, chunk](const size_t& _k, [[maybe_unused]] const UInt& _worker) {
+                                    _func(_k * chunk, std::min(_n, (_k + 1) * chunk));
+                                    }
+                                );
+
+}
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __PARALLEL_ISOTHERM_H__ */
+
+/** @} */
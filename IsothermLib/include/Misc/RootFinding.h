@@ -0,0 +1,113 @@
+/** @defgroup RootFinding Raizes com intervalo garantido
+ *  @ingroup Miscelinea
+ *  Metodo de Newton protegido por bissecao.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : RootFinding.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Metodo de Newton protegido por bissecao para funcoes
+//               crescentes em um intervalo conhecido
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+#ifndef __ROOT_FINDING_ISOTHERM_H__
+#define __ROOT_FINDING_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <cmath>                // std::fabs, std::isfinite
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/Configure.h>
+#include <Misc/SolverStats.h>
+
+IST_NAMESPACE_OPEN
+
+/// <summary>
+/// Raiz de uma funcao crescente em [_lo, _hi] pelo metodo de Newton
+/// protegido por bissecao.
+/// </summary>
+///  Sem std::function: _func e chamada diretamente e pode ser inlinada.
+///  Supoe-se f(_lo) <= 0 <= f(_hi); nenhum extremo e avaliado. Valores nao
+///  finitos de f sao tratados como positivos, o que permite intervalos que
+///  terminam em uma singularidade (theta = 1, por exemplo). Quando o passo
+///  de Newton sai do intervalo corrente, faz-se bissecao.
+///  @param _func Funcao _func(x, f, dfdx).
+///  @param _lo Extremo inferior do intervalo.
+///  @param _hi Extremo superior do intervalo.
+///  @param _x Estimativa inicial, substituida pela raiz.
+///  @param _tole Tolerancia absoluta em x.
+///  @param _itermax Numero maximo de iteracoes.
+///  @param _id ID do modelo, usado apenas pelos contadores de SolverStats.
+///  @return false se nao houve convergencia.
+template <typename Func>
+[[nodiscard]] inline bool BracketedNewton   (   Func&&          _func
+                                            ,   Real            _lo
+                                            ,   Real            _hi
+                                            ,   Real&           _x
+                                            ,   const Real&     _tole
+                                            ,   const UInt&     _itermax = 100
+                                            ,   [[maybe_unused]] const UInt& _id = ID::Isotherm
+                                            )
+{
+
+Real    fx (0.0);
+Real    dfx (0.0);
+
+IST_STATS(SolverStats::Probe probe (_id);)
+
+    if (!(_x > _lo && _x < _hi)) _x = 0.5 * (_lo + _hi);
+
+    for (UInt iter = 0; iter < _itermax; ++iter) {
+
+        _func(_x, fx, dfx);
+
+        IST_STATS(++probe.iterations; ++probe.evaluations;)
+
+        if (!std::isfinite(fx) || fx > 0.0) _hi = _x;
+        else if (fx < 0.0) _lo = _x;
+        else {IST_STATS(probe.converged = true;) return true;}
+
+    Real    xnew (std::isfinite(fx) && dfx > 0.0 ? _x - fx / dfx : _lo - 1.0);
+
+        if (!(xnew > _lo && xnew < _hi)) xnew = 0.5 * (_lo + _hi);
+
+    const Real  dx (std::fabs(xnew - _x));
+
+        _x = xnew;
+
+        if (dx <= _tole || _hi - _lo <= _tole) {IST_STATS(probe.converged = true;) return true;}
+    }
+
+    return false;
+
+}
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __ROOT_FINDING_ISOTHERM_H__ */
+
+/** @} */
@@ -0,0 +1,263 @@
+/** @defgroup SolverStats Contadores dos metodos iterativos
+ *  @ingroup Miscelinea
+ *  Contadores de chamadas, iteracoes, falhas e tempo dos metodos iterativos.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : SolverStats.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Contadores de chamadas, iteracoes, falhas e tempo dos
+//               metodos iterativos, por modelo
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/// <summary>
+/// Contadores dos metodos iterativos (NewtonRaphson e BracketedNewton),
+/// separados pelo ID do modelo que chamou o metodo.
+/// </summary>
+///  Os contadores so existem quando a biblioteca e compilada com
+///  ISOTHERM_STATS (opcao do CMake, desligada por padrao). Sem ela, as
+///  chamadas IST_STATS(...) dos metodos iterativos desaparecem na
+///  compilacao; a interface continua disponivel, mas Snapshot fica vazio.
+///
+///  Cada thread acumula os seus contadores em uma area propria, sem
+///  disputa entre threads; Snapshot soma as areas de todas as threads,
+///  inclusive das que ja terminaram. A medida de tempo e opcional
+///  (Timing(true)) e usa o contador de ciclos do processador (rdtsc) em
+///  x86, ou std::chrono::steady_clock nas demais arquiteturas.
+///
+///  Se a variavel de ambiente ISOTHERM_STATS_FILE estiver definida, os
+///  contadores sao gravados em JSON nesse arquivo ao final do programa,
+///  inclusive quando um metodo nao converge e o programa e interrompido.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __SOLVER_STATS_ISOTHERM_H__
+#define __SOLVER_STATS_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <chrono>               // std::chrono::steady_clock
+#include <cstdint>              // std::uint64_t
+#include <map>                  // std::map
+#include <string>               // std::string
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>          // __rdtsc
+#endif
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/ID.h>
+
+//==============================================================================
+// Instrumentacao removida na compilacao
+//==============================================================================
+
+#ifdef ISOTHERM_STATS
+#define IST_STATS(...) __VA_ARGS__
+#else
+#define IST_STATS(...)
+#endif
+
+IST_NAMESPACE_OPEN
+
+class SolverStats {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "SolverStats"
+                        ,   ID::SolverStats
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Contadores acumulados de um modelo.
+/// </summary>
+    struct Counters {
+        std::uint64_t   calls           = 0;    // chamadas do metodo
+        std::uint64_t   iterations      = 0;    // soma das iteracoes
+        std::uint64_t   maxIterations   = 0;    // maior numero de iteracoes
+        std::uint64_t   failures        = 0;    // chamadas sem convergencia
+        std::uint64_t   evaluations     = 0;    // avaliacoes da funcao
+        std::uint64_t   cycles          = 0;    // tempo, com Timing(true)
+
+        [[nodiscard]] Real MeanIterations () const
+        {
+            return calls > 0 ? Real(iterations) / Real(calls) : 0.0;
+        }
+
+        Counters& operator += (const Counters&);
+    };
+
+    typedef std::map < UInt, Counters >     MapCounters;
+
+/// <summary>
+/// Registra uma chamada de metodo iterativo ao sair do escopo.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     IST_STATS(SolverStats::Probe probe (_id);)
+///     for (...) {
+///         IST_STATS(++probe.iterations; ++probe.evaluations;)
+///     }
+///     IST_STATS(probe.converged = true;)
+/// @endcode
+/// </example>
+    class Probe {
+
+    public:
+
+        explicit Probe (const UInt& _id) : id(_id), start(Timing() ? Clock() : 0) {}
+
+        Probe (const Probe&) = delete;
+        Probe& operator = (const Probe&) = delete;
+
+        ~Probe ()
+        {
+            Record(id, iterations, evaluations, converged, start > 0 ? Clock() - start : 0);
+        }
+
+    UInt            iterations  = 0;
+    UInt            evaluations = 0;
+    bool            converged   = false;
+
+    private:
+
+    const UInt              id;
+    const std::uint64_t     start;
+
+    };
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// true se a biblioteca foi compilada com ISOTHERM_STATS.
+/// </summary>
+    [[nodiscard]] static constexpr bool Enabled ()
+    {
+#ifdef ISOTHERM_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+/// <summary>
+/// Liga ou desliga a medida de tempo. Desligada por padrao.
+/// </summary>
+    static void Timing (const bool&);
+    [[nodiscard]] static bool Timing ();
+
+/// <summary>
+/// Contador de ciclos do processador, ou de std::chrono::steady_clock.
+/// </summary>
+    [[nodiscard]] static std::uint64_t Clock ()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+/// <summary>
+/// Acumula uma chamada nos contadores da thread corrente.
+/// </summary>
+///  @param _id ID do modelo.
+///  @param _iter Numero de iteracoes.
+///  @param _eval Numero de avaliacoes da funcao.
+///  @param _converged false se o metodo nao convergiu.
+///  @param _cycles Tempo da chamada.
+    static void Record  (   const UInt&
+                        ,   const UInt&
+                        ,   const UInt&
+                        ,   const bool&
+                        ,   const std::uint64_t& = 0);
+
+/// <summary>
+/// Soma dos contadores de todas as threads, por ID do modelo. Modelos sem
+/// chamadas desde o ultimo Reset nao aparecem.
+/// </summary>
+    [[nodiscard]] static MapCounters Snapshot ();
+
+/// <summary>
+/// Contadores de um modelo.
+/// </summary>
+    [[nodiscard]] static Counters Get (const UInt&);
+
+/// <summary>
+/// Zera os contadores de todas as threads. Deve ser chamada quando nenhum
+/// metodo iterativo estiver em execucao.
+/// </summary>
+    static void Reset ();
+
+/// <summary>
+/// Nome do modelo usado em Text e Json.
+/// </summary>
+    [[nodiscard]] static std::string Name (const UInt&);
+
+/// <summary>
+/// Tabela com os contadores, um modelo por linha.
+/// </summary>
+    [[nodiscard]] static std::string Text ();
+
+/// <summary>
+/// Contadores em JSON, um modelo por linha.
+/// </summary>
+/// <example>
+/// Formato:
+/// @code
+///     {"enabled":true,"timing":false,"models":[
+///     {"id":305,"model":"Fowler - Guggenheim","calls":1000,"iterations":5210,"maxIterations":7,"failures":0,"evaluations":10420,"cycles":0}
+///     ]}
+/// @endcode
+/// </example>
+    [[nodiscard]] static std::string Json ();
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __SOLVER_STATS_ISOTHERM_H__ */
+
+/** @} */
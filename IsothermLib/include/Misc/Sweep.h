@@ -0,0 +1,213 @@
+/** @defgroup Sweep Varredura em paralelo
+ *  @ingroup Miscelinea
+ *  Avaliacao de Qe em todas as combinacoes de coeficientes, Ce e T.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : Sweep.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Avaliacao em paralelo de Qe em todas as combinacoes de
+//               grades de coeficientes, concentracoes e temperaturas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/// <summary>
+/// Varredura de um modelo: Qe em todas as combinacoes de uma grade de
+/// valores para cada coeficiente, de uma grade de Ce e de uma grade de T,
+/// para estudos de sensibilidade.
+/// </summary>
+///  Os pontos sao numerados com Ce variando mais rapido, depois T e por
+///  ultimo o conjunto de coeficientes, que por sua vez varia mais rapido no
+///  ultimo coeficiente (ver Index e Parameters). A saida e dividida em
+///  blocos de BLOCK pontos contiguos, que cabem na cache junto com o trecho
+///  correspondente de Ce, executados por um ThreadPool com roubo de
+///  trabalho. Cada trabalhador usa um clone proprio do modelo, que so e
+///  alterado por SetParameters quando o bloco muda de conjunto de
+///  coeficientes; nenhuma escrita e compartilhada entre os trabalhadores,
+///  exceto nas fronteiras dos blocos.
+///
+///  Conjuntos de coeficientes rejeitados pelo modelo recebem NaN em todos
+///  os seus pontos.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __SWEEP_ISOTHERM_H__
+#define __SWEEP_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <memory>               // std::unique_ptr
+#include <span>                 // std::span
+#include <string>               // std::string
+#include <vector>               // std::vector
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+#include <Misc/ThreadPool.h>
+
+IST_NAMESPACE_OPEN
+
+class Sweep {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Sweep"
+                        ,   ID::Sweep
+                        );
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+public:
+
+    static constexpr size_t BLOCK = 4096;      //! Pontos por bloco (32 KB de saida)
+
+//==============================================================================
+// Construtoras / Destrutora
+//==============================================================================
+
+public:
+
+    Sweep() = delete;
+
+    Sweep(Sweep&&) = default;
+
+    virtual ~Sweep() = default;
+
+/// <summary>
+/// Construtora.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Toth            toth (2.76, 0.39, 0.57);
+///     Sweep           sweep (toth, {{2.0, 2.5, 3.0}, {}, {0.4, 0.5, 0.6}}, ce, {300.0, 320.0});
+///     VecReal         qe (sweep.NumberPoints());
+///     sweep.Run(qe);
+/// @endcode
+/// </example>
+///  @param _iso Modelo; e copiado por Clone.
+///  @param _coef Grade de cada coeficiente, na ordem de Value(). Uma grade
+///  vazia mantem o valor do modelo.
+///  @param _ce Grade de Ce.
+///  @param _temperature Grade de T. Vazia: T = 0, como em Qe(Ce).
+///  @exception _coef com tamanho diferente de NumberConst() ou _ce vazia.
+    Sweep   (   const Isotherm&
+            ,   const std::vector < VecReal >&
+            ,   const VecReal&
+            ,   const VecReal& = {});
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    Sweep& operator = (Sweep&&) = default;
+
+//==============================================================================
+// Dimensoes
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline size_t NumberSets () const {return nset;};
+    [[nodiscard]] inline size_t NumberTemperatures () const {return temperature.size();};
+    [[nodiscard]] inline size_t NumberCe () const {return ce.size();};
+    [[nodiscard]] inline size_t NumberPoints () const {return nset * temperature.size() * ce.size();};
+
+/// <summary>
+/// Posicao na saida do ponto (conjunto _set, temperatura _t, Ce _c).
+/// </summary>
+    [[nodiscard]] inline size_t Index   (   const size_t&   _set
+                                        ,   const size_t&   _t
+                                        ,   const size_t&   _c
+                                        ) const
+    {
+        return (_set * temperature.size() + _t) * ce.size() + _c;
+    };
+
+/// <summary>
+/// Coeficientes do conjunto _set.
+/// </summary>
+    void Parameters (   const size_t&
+                    ,   std::span<Real>) const;
+
+    [[nodiscard]] VecReal Parameters (const size_t&) const;
+
+//==============================================================================
+// Execucao
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Calcula Qe em todos os pontos, gravando em _qe[Index(set, t, c)].
+/// </summary>
+///  @param _qe Saida, com NumberPoints() valores.
+///  @param _pool Threads utilizadas.
+///  @exception _qe com tamanho diferente de NumberPoints().
+    void Run    (   std::span<Real>
+                ,   ThreadPool& = ThreadPool::Default()) const;
+
+/// <summary>
+/// Calcula Qe em todos os pontos, gravando diretamente num arquivo mapeado
+/// em memoria, com os NumberPoints() valores Real na ordem de Index e sem
+/// cabecalho. Permite varreduras maiores que a memoria disponivel.
+/// </summary>
+///  @param _file Arquivo de saida; substituido se existir.
+///  @param _pool Threads utilizadas.
+///  @exception Erro na criacao ou no mapeamento do arquivo.
+    void Run    (   const std::string&
+                ,   ThreadPool& = ThreadPool::Default()) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+private:
+
+std::unique_ptr<Isotherm>       model;
+std::vector < VecReal >         coef;
+VecReal                         ce;
+VecReal                         temperature;
+size_t                          nset = 1;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __SWEEP_ISOTHERM_H__ */
+
+/** @} */
@@ -0,0 +1,194 @@
+/** @defgroup ThreadPool Conjunto de threads
+ *  @ingroup Miscelinea
+ *  Threads permanentes com distribuicao de tarefas por roubo de trabalho.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : ThreadPool.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Conjunto de threads permanentes, com uma fila de tarefas por
+//               thread e roubo de trabalho entre as filas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/// <summary>
+/// Conjunto de threads que executa um lote de tarefas independentes,
+/// numeradas de 0 a n - 1.
+/// </summary>
+///  As threads sao criadas uma unica vez e reaproveitadas em todos os
+///  lotes; ParallelFor usa Default() para os lacos divididos em blocos.
+///  Cada thread recebe uma faixa contigua de tarefas na sua fila e, quando
+///  a esgota, rouba tarefas do final das filas das outras; lotes com
+///  tarefas de custo desigual (modelos implicitos, coeficientes que exigem
+///  mais iteracoes) ficam equilibrados sem que o chamador escolha o tamanho
+///  dos blocos.
+///
+///  A thread chamadora e o trabalhador 0. O indice do trabalhador e passado
+///  a tarefa, para que ela use uma area de trabalho propria (por exemplo,
+///  vetores auxiliares) sem sincronizacao. Um lote iniciado de dentro de
+///  uma tarefa e executado em serie pela propria thread.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __THREAD_POOL_ISOTHERM_H__
+#define __THREAD_POOL_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <condition_variable>   // std::condition_variable
+#include <exception>            // std::exception_ptr
+#include <functional>           // std::function
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex
+#include <thread>               // std::thread
+#include <vector>               // std::vector
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/ID.h>
+
+IST_NAMESPACE_OPEN
+
+class ThreadPool {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "ThreadPool"
+                        ,   ID::ThreadPool
+                        );
+
+//==============================================================================
+// Tipos
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Tarefa: void(indice da tarefa, indice do trabalhador).
+/// </summary>
+    typedef std::function<void(const size_t&, const UInt&)>     Task;
+
+//==============================================================================
+// Construtoras / Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora.
+/// </summary>
+///  @param _nthreads Numero de trabalhadores, incluindo a thread chamadora.
+///  0 utiliza todos os nucleos.
+    explicit ThreadPool (const UInt& = 0);
+
+    ThreadPool (const ThreadPool&) = delete;
+
+    virtual ~ThreadPool ();
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ThreadPool& operator = (const ThreadPool&) = delete;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Numero de trabalhadores, incluindo a thread chamadora.
+/// </summary>
+    [[nodiscard]] inline UInt NumberWorkers () const {return UInt(queues.size());};
+
+/// <summary>
+/// Executa _task(k, trabalhador) para k = 0, ..., _ntasks - 1 e retorna
+/// quando todas as tarefas terminarem. Lotes chamados de threads distintas
+/// sao executados um de cada vez.
+/// </summary>
+///  O indice do trabalhador e unico dentro do lote, de 0 a
+///  NumberWorkers() - 1.
+///  @param _ntasks Numero de tarefas.
+///  @param _task Tarefa.
+///  @exception A primeira excecao lancada por uma tarefa e relancada na
+///  thread chamadora, depois que as demais terminarem.
+    void Run    (   const size_t&
+                ,   const Task&);
+
+/// <summary>
+/// Conjunto com todos os nucleos, criado no primeiro uso.
+/// </summary>
+    [[nodiscard]] static ThreadPool& Default ();
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+private:
+
+    void Worker (const UInt&);
+
+    void Work (const UInt&);
+
+    [[nodiscard]] bool Pop (const UInt&, size_t&);
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+private:
+
+    struct Queue;
+
+std::vector < std::unique_ptr<Queue> >  queues;
+std::vector < std::thread >             threads;
+
+std::mutex                              batch;          // Um lote de cada vez
+std::mutex                              mutex;
+std::condition_variable                 start;
+std::condition_variable                 done;
+const Task*                             task = nullptr;
+size_t                                  generation = 0;
+UInt                                    active = 0;
+bool                                    stop = false;
+std::exception_ptr                      error;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __THREAD_POOL_ISOTHERM_H__ */
+
+/** @} */
@@ -0,0 +1,233 @@
+/** @defgroup Trace Zonas de rastreamento
+ *  @ingroup Miscelinea
+ *  Zonas de rastreamento gravadas no formato Chrome trace / Perfetto.
+ *  @{
+ */
+
+//==============================================================================
+// Name        : Trace.h
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Zonas de rastreamento das etapas da biblioteca, gravadas no
+//               formato JSON do Chrome trace / Perfetto
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/// <summary>
+/// Rastreamento das etapas da biblioteca: cada zona IST_TRACE(nome,
+/// categoria) registra o instante de inicio e a duracao do escopo em que
+/// foi declarada.
+/// </summary>
+///  O rastreamento e ligado pela variavel de ambiente ISOTHERM_TRACE, com o
+///  nome do arquivo que recebe o JSON ao final do programa, ou por
+///  Trace::Start. Um erro nessa gravacao final e apenas informado, sem
+///  encerrar o programa de novo. Desligado, cada zona custa um teste de uma
+///  variavel global, sempre com o mesmo resultado.
+///
+///  Cada thread grava numa area circular propria, de CAPACITY eventos; os
+///  eventos mais antigos sao descartados quando a area enche. A area de
+///  uma thread que terminou e reaproveitada pela proxima thread criada,
+///  na mesma linha do visualizador. Json e Save devem ser chamadas quando
+///  nenhuma zona estiver aberta em outras threads.
+///
+///  O arquivo pode ser aberto em chrome://tracing ou em ui.perfetto.dev.
+///  Categorias usadas pela biblioteca: "isotherm", "solver", "linalg",
+///  "fit", "process" e "io".
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __TRACE_ISOTHERM_H__
+#define __TRACE_ISOTHERM_H__
+
+//==============================================================================
+// include c++
+//==============================================================================
+
+#include <atomic>               // std::atomic
+#include <chrono>               // std::chrono::steady_clock
+#include <cstdint>              // std::uint64_t
+#include <string>               // std::string
+
+//==============================================================================
+// include da Isotherm++
+//==============================================================================
+
+#include <Misc/ID.h>
+
+IST_NAMESPACE_OPEN
+
+class Trace {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Trace"
+                        ,   ID::Trace
+                        );
+
+//==============================================================================
+// Tipos e constantes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Evento de uma zona. Nome e categoria devem ser literais.
+/// </summary>
+    struct Event {
+        const char*     name;
+        const char*     category;
+        std::uint64_t   start;          // ns, std::chrono::steady_clock
+        std::uint64_t   duration;       // ns
+    };
+
+    static constexpr size_t CAPACITY = size_t(1) << 15;    //! Eventos por thread
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// true se o rastreamento esta ligado.
+/// </summary>
+    [[nodiscard]] static inline bool Enabled () {return enabled.load(std::memory_order_relaxed);}
+
+/// <summary>
+/// Liga o rastreamento.
+/// </summary>
+///  @param _file Arquivo gravado ao final do programa. Vazio: o arquivo de
+///  ISOTHERM_TRACE, se houver.
+    static void Start (const std::string& = "");
+
+/// <summary>
+/// Desliga o rastreamento; os eventos gravados sao mantidos.
+/// </summary>
+    static void Stop ();
+
+/// <summary>
+/// Descarta os eventos gravados.
+/// </summary>
+    static void Clear ();
+
+/// <summary>
+/// Instante corrente, em ns.
+/// </summary>
+    [[nodiscard]] static inline std::uint64_t Now ()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+/// <summary>
+/// Grava um evento na area da thread corrente.
+/// </summary>
+    static void Record  (   const char*
+                        ,   const char*
+                        ,   const std::uint64_t&
+                        ,   const std::uint64_t&);
+
+/// <summary>
+/// Numero de eventos guardados e de eventos descartados.
+/// </summary>
+    [[nodiscard]] static size_t NumberEvents ();
+    [[nodiscard]] static size_t Dropped ();
+
+/// <summary>
+/// Eventos no formato JSON do Chrome trace.
+/// </summary>
+/// <example>
+/// Formato:
+/// @code
+///     {"displayTimeUnit":"ns","traceEvents":[
+///     {"name":"thread_name","ph":"M","pid":1,"tid":1,"args":{"name":"thread 1"}},
+///     {"name":"Qe","cat":"isotherm","ph":"X","pid":1,"tid":1,"ts":12.345,"dur":4.210}
+///     ]}
+/// @endcode
+/// </example>
+    [[nodiscard]] static std::string Json ();
+
+/// <summary>
+/// Grava Json() em _file.
+/// </summary>
+///  @exception Erro de escrita.
+    static void Save (const std::string&);
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+private:
+
+static std::atomic<bool>    enabled;
+
+};
+
+/// <summary>
+/// Zona de rastreamento: grava o evento na destrutora.
+/// </summary>
+class TraceZone {
+
+public:
+
+    TraceZone (const char* _name, const char* _category)
+    {
+        if (Trace::Enabled()) [[unlikely]] {
+            name     = _name;
+            category = _category;
+            start    = Trace::Now();
+        }
+    }
+
+    TraceZone (const TraceZone&) = delete;
+    TraceZone& operator = (const TraceZone&) = delete;
+
+    ~TraceZone ()
+    {
+        if (name) [[unlikely]] Trace::Record(name, category, start, Trace::Now());
+    }
+
+private:
+
+const char*     name        = nullptr;
+const char*     category    = nullptr;
+std::uint64_t   start       = 0;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+//==============================================================================
+// Zona com nome e categoria literais, ate o fim do escopo
+//==============================================================================
+
+#define IST_TRACE_CONCAT_(a, b) a##b
+#define IST_TRACE_CONCAT(a, b) IST_TRACE_CONCAT_(a, b)
+#define IST_TRACE(_name, _category) \
+    ist::TraceZone IST_TRACE_CONCAT(istTraceZone, __LINE__) (_name, _category)
+
+#endif /* __TRACE_ISOTHERM_H__ */
+
+/** @} */
@@ -0,0 +1,157 @@
+//==============================================================================
+// Name        : ExtendedLangmuir.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Langmuir estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ExtendedLangmuir ExtendedLangmuir
+ *  @ingroup Multicomponent
+ *  Classe ExtendedLangmuir e uma isoterma multicomponente competitiva.
+ *  @{
+ */
+
+/// <summary>
+/// Classe com a equacao da isoterma de Langmuir estendida
+/// </summary>
+///  Isoterma multicomponente construida a partir das isotermas de Langmuir
+///  de cada componente puro, cuja formula e a seguinte:
+///\begin{align}
+///     \[Q_{e,i}(C_e, T) = \frac{q_{max,i}K_{1,i}C_{e,i}}{1+\sum_j K_{1,j}C_{e,j}}\]
+///\end{align}
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __EXTENDED_LANGMUIR_H__
+#define __EXTENDED_LANGMUIR_H__
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/Multicomponent.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+IST_NAMESPACE_OPEN
+
+class ExtendedLangmuir : public Multicomponent {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "ExtendedLangmuir"
+                    ,   ID::ExtendedLangmuir
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ExtendedLangmuir() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    ExtendedLangmuir(const ExtendedLangmuir&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ExtendedLangmuir() = default;
+
+/// <summary>
+/// Construtora com as isotermas de Langmuir dos componentes puros.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ExtendedLangmuir  var({Langmuir(q1, k1), Langmuir(q2, k2)});
+/// @endcode
+/// </example>
+///  @param _component Isoterma de Langmuir de cada componente puro.
+///  @exception _component vazio.
+///  @exception Isoterma de algum componente nao definida.
+    explicit ExtendedLangmuir (const std::vector < Langmuir >&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ExtendedLangmuir& operator = (const ExtendedLangmuir&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe
+//==============================================================================
+
+/// <summary>
+/// Funcao que retorna a isoterma de Langmuir do componente _i.
+/// </summary>
+    [[nodiscard]]
+    inline const Langmuir& Component (const UInt& _i) const {return component[_i];};
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const override
+    {
+        return std::make_unique<ExtendedLangmuir>(*this);
+    }
+
+protected:
+
+    void Evaluate   (   const Real* const*
+                    ,   Real* const*
+                    ,   Real*
+                    ,   const size_t&
+                    ,   const Real&
+                    ) const override;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::vector < Langmuir >    component;
+VecReal                     qmaxK1;             // q_{max,i} K_{1,i}
+VecReal                     coeffK1;            // K_{1,i} efetivo do denominador
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __EXTENDED_LANGMUIR_H__ */
+
+/** @} */
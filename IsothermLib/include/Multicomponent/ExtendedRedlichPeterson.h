@@ -0,0 +1,158 @@
+//==============================================================================
+// Name        : ExtendedRedlichPeterson.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Redlich-Peterson estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ExtendedRedlichPeterson ExtendedRedlichPeterson
+ *  @ingroup Multicomponent
+ *  Classe ExtendedRedlichPeterson e uma isoterma multicomponente competitiva.
+ *  @{
+ */
+
+/// <summary>
+/// Classe com a equacao da isoterma de Redlich-Peterson estendida
+/// </summary>
+///  Isoterma multicomponente construida a partir das isotermas de RedlichPeterson
+///  de cada componente puro, cuja formula e a seguinte:
+///\begin{align}
+///     \[Q_{e,i}(C_e, T) = \frac{K_{1,i}C_{e,i}}{1+\sum_j K_{2,j}C_{e,j}^{K_{3,j}}}\]
+///\end{align}
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __EXTENDED_REDLICH_PETERSON_H__
+#define __EXTENDED_REDLICH_PETERSON_H__
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/Multicomponent.h>
+#include <Isotherm/ThreeParameters/RedlichPeterson.h>
+
+IST_NAMESPACE_OPEN
+
+class ExtendedRedlichPeterson : public Multicomponent {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "ExtendedRedlichPeterson"
+                    ,   ID::ExtendedRedlichPeterson
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ExtendedRedlichPeterson() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    ExtendedRedlichPeterson(const ExtendedRedlichPeterson&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ExtendedRedlichPeterson() = default;
+
+/// <summary>
+/// Construtora com as isotermas de RedlichPeterson dos componentes puros.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ExtendedRedlichPeterson  var({RedlichPeterson(k11, k21, k31), RedlichPeterson(k12, k22, k32)});
+/// @endcode
+/// </example>
+///  @param _component Isoterma de RedlichPeterson de cada componente puro.
+///  @exception _component vazio.
+///  @exception Isoterma de algum componente nao definida.
+    explicit ExtendedRedlichPeterson (const std::vector < RedlichPeterson >&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ExtendedRedlichPeterson& operator = (const ExtendedRedlichPeterson&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe
+//==============================================================================
+
+/// <summary>
+/// Funcao que retorna a isoterma de RedlichPeterson do componente _i.
+/// </summary>
+    [[nodiscard]]
+    inline const RedlichPeterson& Component (const UInt& _i) const {return component[_i];};
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const override
+    {
+        return std::make_unique<ExtendedRedlichPeterson>(*this);
+    }
+
+protected:
+
+    void Evaluate   (   const Real* const*
+                    ,   Real* const*
+                    ,   Real*
+                    ,   const size_t&
+                    ,   const Real&
+                    ) const override;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::vector < RedlichPeterson >    component;
+VecReal                     coeffK1;            // K_{1,i}
+VecReal                     coeffK2;            // K_{2,i}
+VecReal                     coeffK3;            // K_{3,i}
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __EXTENDED_REDLICH_PETERSON_H__ */
+
+/** @} */
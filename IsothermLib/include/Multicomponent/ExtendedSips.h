@@ -0,0 +1,158 @@
+//==============================================================================
+// Name        : ExtendedSips.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Sips estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ExtendedSips ExtendedSips
+ *  @ingroup Multicomponent
+ *  Classe ExtendedSips e uma isoterma multicomponente competitiva.
+ *  @{
+ */
+
+/// <summary>
+/// Classe com a equacao da isoterma de Sips estendida
+/// </summary>
+///  Isoterma multicomponente construida a partir das isotermas de Sips
+///  de cada componente puro, cuja formula e a seguinte:
+///\begin{align}
+///     \[Q_{e,i}(C_e, T) = \frac{q_{max,i}\left(K_{1,i}C_{e,i}\right)^{1/K_{2,i}}}{1+\sum_j \left(K_{1,j}C_{e,j}\right)^{1/K_{2,j}}}\]
+///\end{align}
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __EXTENDED_SIPS_H__
+#define __EXTENDED_SIPS_H__
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/Multicomponent.h>
+#include <Isotherm/ThreeParameters/Sips.h>
+
+IST_NAMESPACE_OPEN
+
+class ExtendedSips : public Multicomponent {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "ExtendedSips"
+                    ,   ID::ExtendedSips
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ExtendedSips() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    ExtendedSips(const ExtendedSips&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ExtendedSips() = default;
+
+/// <summary>
+/// Construtora com as isotermas de Sips dos componentes puros.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ExtendedSips  var({Sips(q1, k1, n1), Sips(q2, k2, n2)});
+/// @endcode
+/// </example>
+///  @param _component Isoterma de Sips de cada componente puro.
+///  @exception _component vazio.
+///  @exception Isoterma de algum componente nao definida.
+    explicit ExtendedSips (const std::vector < Sips >&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ExtendedSips& operator = (const ExtendedSips&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe
+//==============================================================================
+
+/// <summary>
+/// Funcao que retorna a isoterma de Sips do componente _i.
+/// </summary>
+    [[nodiscard]]
+    inline const Sips& Component (const UInt& _i) const {return component[_i];};
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const override
+    {
+        return std::make_unique<ExtendedSips>(*this);
+    }
+
+protected:
+
+    void Evaluate   (   const Real* const*
+                    ,   Real* const*
+                    ,   Real*
+                    ,   const size_t&
+                    ,   const Real&
+                    ) const override;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::vector < Sips >        component;
+VecReal                     qmax;               // q_{max,i}
+VecReal                     coeffK1;            // K_{1,i}
+VecReal                     invK2;              // 1 / K_{2,i}
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __EXTENDED_SIPS_H__ */
+
+/** @} */
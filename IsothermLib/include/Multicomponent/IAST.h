@@ -0,0 +1,312 @@
+//==============================================================================
+// Name        : IAST.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Teoria da solucao adsorvida ideal (IAST) para isotermas
+//               de componentes puros quaisquer
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup IAST IAST
+ *  @ingroup Multicomponent
+ *  Teoria da solucao adsorvida ideal (IAST).
+ *  @{
+ */
+
+/// <summary>
+/// Teoria da solucao adsorvida ideal (IAST) para isotermas de componentes
+/// puros quaisquer.
+/// </summary>
+///  A pressao de espalhamento reduzida de cada componente puro e
+///\begin{align}
+///     \[\psi_i(C^0) = \int_0^{C^0} \frac{q_i(c)}{c}\,dc\]
+///\end{align}
+///  e a IAST procura o valor comum \f$ \psi \f$ tal que
+///  \f$ \sum_i C_i / C_i^0(\psi) = 1 \f$. O problema e resolvido por Newton
+///  na variavel unica \f$ \psi \f$, com a derivada analitica
+///  \f$ d f / d\psi = -\sum_i C_i / (C_i^0 q_i^0) \f$ e salvaguarda por
+///  bissecao no intervalo \f$ [\max_i \psi_i(C_i), \max_i \psi_i(C_T)] \f$.
+///
+///  A integral e avaliada de forma fechada para as isotermas de Henry,
+///  Langmuir, Freundlich, Sips e Toth (serie). Para as demais isotermas
+///  utiliza-se quadratura de Gauss-Legendre em paineis geometricos de
+///  \f$ \ln c \f$, que pode ser substituida por tabelas (Tabulate).
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __IAST_H__
+#define __IAST_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/Multicomponent.h>
+#include <Multicomponent/SpreadingPressureTable.h>
+
+IST_NAMESPACE_OPEN
+
+class IAST : public Multicomponent {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "IAST"
+                    ,   ID::IAST
+                    );
+
+//==============================================================================
+// Forma de avaliacao da pressao de espalhamento
+//==============================================================================
+
+public:
+
+    enum SpreadingKind {
+            HenryForm = 0
+        ,   LangmuirForm
+        ,   FreundlichForm
+        ,   SipsForm
+        ,   TothForm
+        ,   QuadratureForm
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    IAST() = default;
+
+/// <summary>
+/// Construtora de copia. As isotermas dos componentes sao clonadas.
+/// </summary>
+    IAST(const IAST&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~IAST() = default;
+
+/// <summary>
+/// Construtora com as isotermas dos componentes puros. As isotermas sao
+/// clonadas, de modo que alteracoes posteriores nos objetos originais
+/// nao afetam o calculo.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir    iso1(q1, k1);
+///     Toth        iso2(q2, k2, t2);
+///     IAST        iast({&iso1, &iso2});
+///     VecReal     qe = iast.Qe({c1, c2});
+/// @endcode
+/// </example>
+///  @param _component Isoterma de cada componente puro.
+///  @exception _component vazio.
+///  @exception Isoterma de algum componente nao definida.
+    explicit IAST (const std::vector < const Isotherm* >&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    IAST& operator = (const IAST&) = default;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Funcao que informa como a pressao de espalhamento do componente _i e avaliada.
+/// </summary>
+    [[nodiscard]]
+    inline SpreadingKind Kind (const UInt& _i) const {return component[_i].kind;};
+
+/// <summary>
+/// Funcao que retorna a isoterma do componente puro _i.
+/// </summary>
+    [[nodiscard]]
+    inline const Isotherm& Component (const UInt& _i) const {return *component[_i].isotherm;};
+
+/// <summary>
+/// Numero de threads utilizado na avaliacao de varias composicoes.
+/// 0 utiliza todos os nucleos.
+/// </summary>
+    [[nodiscard]] inline UInt Threads () const {return nThreads;};
+    inline void Threads (const UInt& _nthreads) {nThreads = _nthreads;};
+
+/// <summary>
+/// Pressao de espalhamento reduzida do componente puro _i.
+/// </summary>
+///  @param _i Componente.
+///  @param _c0 Concentracao (ou pressao parcial) do componente puro.
+///  @param _temp Temperatura, opcional.
+///  @exception _i maior ou igual ao numero de componentes.
+///  @exception _c0 < 0.
+    [[nodiscard]]
+    Real SpreadingPressure  (   const UInt&
+                            ,   const Real&
+                            ,   const Real& = 0) const;
+
+/// <summary>
+/// Tabela a pressao de espalhamento dos componentes avaliados por
+/// quadratura. Nas iteracoes seguintes, na mesma temperatura, a pressao de
+/// espalhamento e a sua inversa passam a ser consultas as tabelas.
+/// </summary>
+///  @param _cmin Menor concentracao tabelada.
+///  @param _cmax Maior concentracao tabelada.
+///  @param _tole Tolerancia relativa das tabelas.
+///  @param _temp Temperatura.
+    void Tabulate   (   const Real&
+                    ,   const Real&
+                    ,   const Real& = 1.0e-8
+                    ,   const Real& = 0);
+
+/// <summary>
+/// Associa ao componente _i uma tabela ja construida, por exemplo lida de
+/// arquivo com SpreadingPressureTable::Load.
+/// </summary>
+    void Table  (   const UInt&
+                ,   const SpreadingPressureTable&);
+
+/// <summary>
+/// Funcao que retorna a tabela do componente _i (nullptr, se nao houver).
+/// </summary>
+    [[nodiscard]]
+    inline const SpreadingPressureTable* Table (const UInt& _i) const {return component[_i].table.get();};
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+public:
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const override
+    {
+        return std::make_unique<IAST>(*this);
+    }
+
+protected:
+
+    void Evaluate   (   const Real* const*
+                    ,   Real* const*
+                    ,   Real*
+                    ,   const size_t&
+                    ,   const Real&
+                    ) const override;
+
+//==============================================================================
+// Estruturas internas
+//==============================================================================
+
+protected:
+
+    struct PureComponent {
+
+        SpreadingKind               kind = QuadratureForm;
+        Real                        par[4] = {0, 0, 0, 0};  // constantes da forma fechada
+        std::unique_ptr<Isotherm>   isotherm;               // modelo original
+        std::shared_ptr<const SpreadingPressureTable>   table;  // tabela opcional
+
+        PureComponent() = default;
+        PureComponent(const PureComponent&);
+        PureComponent& operator = (const PureComponent&);
+    };
+
+//  Area de trabalho de um solve, uma por thread. As isotermas sao
+//  reentrantes e compartilhadas entre as threads.
+
+    struct Workspace {
+
+        std::vector < const Isotherm* >             isotherm;
+        VecReal                                     c0;         // C_i^0(psi)
+        VecReal                                     q0;         // q_i^0(C_i^0)
+
+        explicit Workspace (const IAST&);
+    };
+
+//==============================================================================
+// Funcoes internas
+//==============================================================================
+
+protected:
+
+    Real Psi        (   const UInt&                 // componente
+                    ,   const Isotherm&             // isoterma do componente
+                    ,   const Real&                 // concentracao
+                    ,   const Real&                 // temperatura
+                    ) const;
+
+    Real Loading    (   const UInt&
+                    ,   const Isotherm&
+                    ,   const Real&
+                    ,   const Real&
+                    ) const;
+
+    Real InversePsi (   const UInt&
+                    ,   const Isotherm&
+                    ,   const Real&                 // psi
+                    ,   const Real&                 // estimativa inicial
+                    ,   const Real&                 // temperatura
+                    ) const;
+
+    void Solve      (   const Real*                 // concentracoes
+                    ,   Real*                       // quantidades adsorvidas
+                    ,   const Real&                 // temperatura
+                    ,   Workspace&
+                    ) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::vector < PureComponent >       component;
+UInt                                nThreads = 0;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __IAST_H__ */
+
+/** @} */
@@ -0,0 +1,150 @@
+//==============================================================================
+// Name        : ModifiedCompetitiveLangmuir.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Langmuir competitiva modificada
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup ModifiedCompetitiveLangmuir ModifiedCompetitiveLangmuir
+ *  @ingroup Multicomponent
+ *  Classe ModifiedCompetitiveLangmuir e uma isoterma multicomponente competitiva.
+ *  @{
+ */
+
+/// <summary>
+/// Classe com a equacao da isoterma de Langmuir estendida
+/// </summary>
+///  Isoterma de Langmuir estendida corrigida pelos fatores de interacao
+///  \f$ \eta_i \f$ de cada componente, cuja formula e a seguinte:
+///\begin{align}
+///     \[Q_{e,i}(C_e, T) = \frac{q_{max,i}K_{1,i}C_{e,i}/\eta_i}{1+\sum_j K_{1,j}C_{e,j}/\eta_j}\]
+///\end{align}
+///  Com \f$ \eta_i = 1 \f$ recupera-se a isoterma de Langmuir estendida.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __MODIFIED_COMPETITIVE_LANGMUIR_H__
+#define __MODIFIED_COMPETITIVE_LANGMUIR_H__
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/ExtendedLangmuir.h>
+
+IST_NAMESPACE_OPEN
+
+class ModifiedCompetitiveLangmuir : public ExtendedLangmuir {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "ModifiedCompetitiveLangmuir"
+                    ,   ID::ModifiedCompetitiveLangmuir
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    ModifiedCompetitiveLangmuir() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    ModifiedCompetitiveLangmuir(const ModifiedCompetitiveLangmuir&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~ModifiedCompetitiveLangmuir() = default;
+
+/// <summary>
+/// Construtora com as isotermas de Langmuir dos componentes puros e os
+/// fatores de interacao de cada componente.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     ModifiedCompetitiveLangmuir  var({Langmuir(q1, k1), Langmuir(q2, k2)}, {eta1, eta2});
+/// @endcode
+/// </example>
+///  @param _component Isoterma de Langmuir de cada componente puro.
+///  @param _eta Fator de interacao de cada componente.
+///  @exception _eta.size() diferente de _component.size().
+///  @exception _eta[i] <= 0.
+    ModifiedCompetitiveLangmuir (   const std::vector < Langmuir >&
+                                ,   const VecReal&
+                                );
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    ModifiedCompetitiveLangmuir& operator = (const ModifiedCompetitiveLangmuir&) = default;
+
+//==============================================================================
+// Acesso as constantes da classe
+//==============================================================================
+
+/// <summary>
+/// Funcao que retorna o fator de interacao do componente _i.
+/// </summary>
+    [[nodiscard]]
+    inline Real Eta (const UInt& _i) const {return eta[_i];};
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const override
+    {
+        return std::make_unique<ModifiedCompetitiveLangmuir>(*this);
+    }
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+private:
+
+VecReal                     eta;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __MODIFIED_COMPETITIVE_LANGMUIR_H__ */
+
+/** @} */
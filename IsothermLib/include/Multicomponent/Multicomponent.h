@@ -0,0 +1,191 @@
+//==============================================================================
+// Name        : Multicomponent.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe base das isotermas multicomponentes competitivas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup Multicomponent Multicomponent
+ *  @ingroup Base
+ *  Classe base das isotermas multicomponentes competitivas.
+ *  @{
+ */
+
+/// <summary>
+/// Classe base das isotermas multicomponentes competitivas.
+/// </summary>
+///  As concentracoes de uma mistura de N componentes sao armazenadas em
+///  layout SoA (estrutura de vetores): _ce[i][k] e a concentracao do
+///  componente i na composicao k. Assim, cada componente ocupa um vetor
+///  contiguo e todas as composicoes sao avaliadas em uma unica passagem.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __MULTICOMPONENT_H__
+#define __MULTICOMPONENT_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// typedef
+//==============================================================================
+
+typedef std::vector < VecReal >                                VecVecReal;
+
+//==============================================================================
+// classe Multicomponent
+//==============================================================================
+
+class Multicomponent {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Multicomponent"
+                        ,   ID::Multicomponent
+                        );
+
+//==============================================================================
+// Construtoras / Destrutora
+//==============================================================================
+
+public:
+
+    Multicomponent() = default;
+    Multicomponent(const Multicomponent&) = default;
+    virtual ~Multicomponent() = default;
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+protected:
+
+    Multicomponent& operator = (const Multicomponent&) = default;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Funcao que calcula a quantidade adsorvida de todos os componentes
+/// para uma unica composicao.
+/// </summary>
+///  @param _ce Concentracao de cada componente da mistura.
+///  @param _temp Temperatura, opcional.
+///  @return Quantidade adsorvida de cada componente.
+///  @exception _ce.size() diferente do numero de componentes.
+///  @exception _ce[i] < 0.
+    [[nodiscard]]
+    VecReal Qe  (   const VecReal&
+                ,   const Real& = 0) const;
+
+/// <summary>
+/// Funcao que calcula a quantidade adsorvida do componente _i
+/// para uma unica composicao.
+/// </summary>
+    [[nodiscard]]
+    Real Qe     (   const UInt&
+                ,   const VecReal&
+                ,   const Real& = 0) const;
+
+/// <summary>
+/// Funcao que calcula a quantidade adsorvida de todos os componentes
+/// para um conjunto de composicoes armazenado em layout SoA.
+/// </summary>
+///  @param _ce _ce[i][k] concentracao do componente i na composicao k.
+///  @param _qe _qe[i][k] quantidade adsorvida do componente i na composicao k.
+///             Redimensionado, caso necessario.
+///  @param _temp Temperatura, opcional.
+    void Qe     (   const VecVecReal&
+                ,   VecVecReal&
+                ,   const Real& = 0) const;
+
+/// <summary>
+/// Funcao que retorna o numero de componentes da mistura.
+/// </summary>
+    [[nodiscard]] inline size_t NumberComponents () const {return nComponents;};
+
+//==============================================================================
+// Funcoes puramente virtuais
+//==============================================================================
+
+public:
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Multicomponent> Clone() const = 0;
+
+protected:
+
+/// <summary>
+/// Avaliacao vetorizada do modelo. _ce[i] e _qe[i] apontam para vetores
+/// contiguos de _npto valores do componente i. _den e uma area de trabalho
+/// com _npto posicoes.
+/// </summary>
+    virtual void Evaluate   (   const Real* const*      // _ce[i]
+                            ,   Real* const*            // _qe[i]
+                            ,   Real*                   // _den
+                            ,   const size_t&           // _npto
+                            ,   const Real&             // _temp
+                            ) const = 0;
+
+/// <summary>
+/// Funcao que verifica o numero de componentes informado na construtora.
+/// </summary>
+    void CheckComponents (const size_t&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+size_t                                                  nComponents = 0;
+
+};
+
+typedef std::shared_ptr<Multicomponent>                PtrMulticomponent;
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __MULTICOMPONENT_H__ */
+
+/** @} */
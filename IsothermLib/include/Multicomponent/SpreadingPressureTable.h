@@ -0,0 +1,253 @@
+//==============================================================================
+// Name        : SpreadingPressureTable.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Tabela da pressao de espalhamento reduzida de um componente
+//               puro e da sua inversa
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup SpreadingPressureTable SpreadingPressureTable
+ *  @ingroup Multicomponent
+ *  Tabela da pressao de espalhamento reduzida de um componente puro.
+ *  @{
+ */
+
+/// <summary>
+/// Tabela da pressao de espalhamento reduzida de um componente puro e da
+/// sua inversa.
+/// </summary>
+///  A pressao de espalhamento reduzida e representada por splines cubicas
+///  de Hermite em \f$ s = \ln C \f$, cujas derivadas nos nos sao exatas,
+///  pois \f$ d\psi / ds = q(C) \f$. A inversa \f$ s(\psi) \f$ utiliza os
+///  mesmos nos com derivada \f$ 1 / q \f$. Os intervalos sao subdivididos
+///  ate que o erro no ponto medio seja menor que a tolerancia nas duas
+///  direcoes e que as duas splines sejam monotonas (criterio de
+///  Fritsch-Carlson). A localizacao do intervalo e feita em O(1) por um
+///  indice de baldes uniformes em \f$ s \f$ e em \f$ \psi \f$.
+///
+///  A tabela e imutavel e pode ser gravada em arquivo binario. A leitura
+///  mapeia o arquivo em memoria (mmap), de modo que varios processos
+///  compartilham as mesmas paginas.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __SPREADING_PRESSURE_TABLE_H__
+#define __SPREADING_PRESSURE_TABLE_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cstdint>          // std::uint32_t
+#include <memory>           // std::shared_ptr
+#include <string>           // std::string
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class SpreadingPressureTable {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "SpreadingPressureTable"
+                        ,   ID::SpreadingPressureTable
+                        );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    SpreadingPressureTable() = default;
+
+/// <summary>
+/// Construtora de copia. Os dados da tabela sao compartilhados.
+/// </summary>
+    SpreadingPressureTable(const SpreadingPressureTable&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~SpreadingPressureTable() = default;
+
+/// <summary>
+/// Construtora que tabela a pressao de espalhamento da isoterma _iso.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Kiselev                 iso(k1, k2, k3);
+///     SpreadingPressureTable  table(iso, 1.0e-6, 1.0e3);
+///     Real                    psi = table.Psi(c);
+///     Real                    c0 = table.Ce(psi);
+/// @endcode
+/// </example>
+///  @param _iso Isoterma do componente puro.
+///  @param _cmin Menor concentracao tabelada.
+///  @param _cmax Maior concentracao tabelada.
+///  @param _tole Tolerancia relativa.
+///  @param _temp Temperatura.
+///  @exception _cmin <= 0 ou _cmax <= _cmin ou _tole <= 0.
+    SpreadingPressureTable  (   const Isotherm&
+                            ,   const Real&
+                            ,   const Real&
+                            ,   const Real& = 1.0e-8
+                            ,   const Real& = 0);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    SpreadingPressureTable& operator = (const SpreadingPressureTable&) = default;
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Pressao de espalhamento reduzida em _c.
+/// </summary>
+    [[nodiscard]] Real Psi (const Real&) const;
+
+/// <summary>
+/// Concentracao do componente puro com pressao de espalhamento _psi.
+/// </summary>
+    [[nodiscard]] Real Ce (const Real&) const;
+
+/// <summary>
+/// Quantidade adsorvida em _c, derivada da spline em relacao a ln(c).
+/// </summary>
+    [[nodiscard]] Real Qe (const Real&) const;
+
+/// <summary>
+/// Grava a tabela em arquivo binario.
+/// </summary>
+    void Save (const std::string&) const;
+
+/// <summary>
+/// Le a tabela de um arquivo binario mapeado em memoria.
+/// </summary>
+    [[nodiscard]] static SpreadingPressureTable Load (const std::string&);
+
+/// <summary>
+/// Pressao de espalhamento reduzida calculada por quadratura de
+/// Gauss-Legendre em paineis geometricos de ln(c).
+/// </summary>
+///  @param _iso Isoterma do componente puro.
+///  @param _c Concentracao.
+///  @param _temp Temperatura.
+    [[nodiscard]]
+    static Real Quadrature  (   const Isotherm&
+                            ,   const Real&
+                            ,   const Real& = 0);
+
+//==============================================================================
+// Acesso aos dados da tabela
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline size_t NumberNodes () const {return header ? header->npto : 0;};
+    [[nodiscard]] inline Real Temperature () const {return header->temperature;};
+    [[nodiscard]] inline Real Tolerance () const {return header->tolerance;};
+    [[nodiscard]] inline Real Cmin () const {return header->cmin;};
+    [[nodiscard]] inline Real Cmax () const {return header->cmax;};
+
+//==============================================================================
+// Layout do arquivo: Header, s[n], psi[n], q[n], baldes de s[n-1],
+// baldes de psi[n-1]
+//==============================================================================
+
+protected:
+
+    struct Header {
+        char            magic[8];
+        std::uint64_t   npto;
+        Real            temperature;
+        Real            tolerance;
+        Real            cmin;
+        Real            cmax;
+    };
+
+    void Attach (   const std::shared_ptr<const void>&
+                ,   const size_t&
+                );
+
+    void Refine (   const Isotherm&
+                ,   const Real&                 // temperatura
+                ,   const Real&                 // tolerancia
+                ,   const Real&                 // s_a
+                ,   const Real&                 // psi_a
+                ,   const Real&                 // q_a
+                ,   const Real&                 // s_b
+                ,   const Real&                 // q_b
+                ,   const UInt&                 // profundidade
+                ,   VecReal&
+                ,   VecReal&
+                ,   VecReal&
+                ) const;
+
+    [[nodiscard]] size_t IntervalS (const Real&) const;
+    [[nodiscard]] size_t IntervalPsi (const Real&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::shared_ptr<const void>         storage;
+size_t                              nbytes = 0;
+const Header*                       header = nullptr;
+const Real*                         nodeS = nullptr;
+const Real*                         nodePsi = nullptr;
+const Real*                         nodeQ = nullptr;
+const std::uint32_t*                bucketS = nullptr;
+const std::uint32_t*                bucketPsi = nullptr;
+Real                                invDs = 0;
+Real                                invDpsi = 0;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __SPREADING_PRESSURE_TABLE_H__ */
+
+/** @} */
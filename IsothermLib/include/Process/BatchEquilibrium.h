@@ -0,0 +1,199 @@
+//==============================================================================
+// Name        : BatchEquilibrium.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Equilibrio de adsorcao em batelada (ensaio de jarro)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup BatchEquilibrium BatchEquilibrium
+ *  @ingroup Process
+ *  Equilibrio de adsorcao em batelada.
+ *  @{
+ */
+
+/// <summary>
+/// Equilibrio de adsorcao em batelada para um conjunto de doses.
+/// </summary>
+///  Para cada dose (C0, V, m) calcula Ce e qe que satisfazem o balanco de
+///  massa e a isoterma:
+///\begin{align}
+///     \[q_e = \frac{(C_0 - C_e) V}{m}, \qquad q_e = Q_e(C_e, T)\]
+///\end{align}
+///  A raiz e obtida pelo metodo de Newton protegido por bissecao no
+///  intervalo \f$ 0 < C_e \le C_0 \f$. Nos modelos em que Qe e implicito
+///  (Elovich, FowlerGuggenheim, HillDeBoer, Kiselev, WeberVanVliet), a
+///  isoterma inversa Ce(qe) e explicita e a raiz e procurada em qe, de modo
+///  que cada dose exige um unico laco de Newton. As doses sao divididas entre
+///  threads, que compartilham a isoterma.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __BATCH_EQUILIBRIUM_H__
+#define __BATCH_EQUILIBRIUM_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <span>             // std::span
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class BatchEquilibrium {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "BatchEquilibrium"
+                        ,   ID::BatchEquilibrium
+                        );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    BatchEquilibrium() = default;
+
+/// <summary>
+/// Construtora de copia. A isoterma e clonada.
+/// </summary>
+    BatchEquilibrium(const BatchEquilibrium&);
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~BatchEquilibrium() = default;
+
+/// <summary>
+/// Construtora com a isoterma do adsorbato.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir            iso(qmax, k1);
+///     BatchEquilibrium    batch(iso);
+///     batch.Solve(c0, volume, mass, ce, qe);
+/// @endcode
+/// </example>
+///  @param _iso Isoterma do adsorbato.
+///  @param _temp Temperatura.
+    explicit BatchEquilibrium   (   const Isotherm&
+                                ,   const Real& = 0);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    BatchEquilibrium& operator = (const BatchEquilibrium&);
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Concentracao de equilibrio de uma dose.
+/// </summary>
+///  @param _c0 Concentracao inicial.
+///  @param _volume Volume da solucao.
+///  @param _mass Massa de adsorvente.
+///  @exception _c0 < 0, _volume <= 0 ou _mass <= 0.
+    [[nodiscard]] Real Ce   (   const Real&
+                            ,   const Real&
+                            ,   const Real&) const;
+
+/// <summary>
+/// Equilibrio de um conjunto de doses, dividido entre threads.
+/// </summary>
+///  @param _c0 Concentracoes iniciais.
+///  @param _volume Volumes da solucao.
+///  @param _mass Massas de adsorvente.
+///  @param _ce Concentracoes de equilibrio.
+///  @param _qe Quantidades adsorvidas no equilibrio.
+///  @param _nthreads Numero de threads. 0 utiliza todos os nucleos.
+///  @exception Vetores com tamanhos diferentes.
+    void Solve  (   std::span<const Real>
+                ,   std::span<const Real>
+                ,   std::span<const Real>
+                ,   std::span<Real>
+                ,   std::span<Real>
+                ,   const UInt& = 0) const;
+
+/// <summary>
+/// Isoterma do adsorbato.
+/// </summary>
+    [[nodiscard]] inline const Isotherm& Model () const {return *isotherm;};
+
+/// <summary>
+/// Temperatura.
+/// </summary>
+    [[nodiscard]] inline Real Temperature () const {return temperature;};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    void Point  (   const Isotherm&
+                ,   const Real&             // C0
+                ,   const Real&             // V
+                ,   const Real&             // m
+                ,   Real&                   // Ce
+                ,   Real&                   // qe
+                ) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::unique_ptr<Isotherm>           isotherm;
+Real                                temperature = 0;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __BATCH_EQUILIBRIUM_H__ */
+
+/** @} */
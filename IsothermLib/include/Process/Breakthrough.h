@@ -0,0 +1,239 @@
+//==============================================================================
+// Name        : Breakthrough.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Simulador da curva de ruptura de um leito fixo com
+//               dispersao axial e forca motriz linear (LDF)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup Breakthrough Breakthrough
+ *  @ingroup Process
+ *  Curva de ruptura de um leito fixo.
+ *  @{
+ */
+
+/// <summary>
+/// Simulador da curva de ruptura de um leito fixo.
+/// </summary>
+///  Modelo unidimensional com dispersao axial e forca motriz linear:
+///\begin{align}
+///     \[\frac{\partial c}{\partial t} = D_L \frac{\partial^2 c}{\partial z^2}
+///       - v \frac{\partial c}{\partial z} - F \frac{\partial q}{\partial t}\]
+///     \[\frac{\partial q}{\partial t} = k_{LDF} \left(Q_e(c, T) - q\right)\]
+///\end{align}
+///  com condicao de Danckwerts na entrada e derivada nula na saida. O metodo
+///  das linhas utiliza volumes finitos (conveccao upwind) e Euler implicito
+///  no tempo. A quantidade adsorvida e eliminada analiticamente do passo
+///  implicito, de modo que o Newton de cada passo resolve apenas c, com
+///  jacobiana tridiagonal (algoritmo de Thomas). Qe e dQe/dCe sao avaliados
+///  em bloco sobre toda a coluna a cada iteracao.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __BREAKTHROUGH_H__
+#define __BREAKTHROUGH_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class Breakthrough {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Breakthrough"
+                        ,   ID::Breakthrough
+                        );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    Breakthrough() = default;
+
+/// <summary>
+/// Construtora de copia. A isoterma e clonada.
+/// </summary>
+    Breakthrough(const Breakthrough&);
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~Breakthrough() = default;
+
+/// <summary>
+/// Construtora com a isoterma e os parametros da coluna.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir        iso(qmax, k1);
+///     Breakthrough    column(iso, 0.5, 1.0e-2, 1.0e-5, 1.5, 0.1);
+///     column.Run(cfeed, 1.0, 10000);
+///     VecReal         outlet = column.Outlet();
+/// @endcode
+/// </example>
+///  @param _iso Isoterma do adsorbato.
+///  @param _length Comprimento do leito.
+///  @param _velocity Velocidade intersticial.
+///  @param _dispersion Coeficiente de dispersao axial.
+///  @param _phaseRatio Razao de fases F = (1 - eps) rho / eps.
+///  @param _kldf Coeficiente de transferencia de massa LDF.
+///  @param _ncells Numero de celulas.
+///  @param _temp Temperatura.
+///  @exception Parametros menores ou iguais a zero (D_L e F podem ser nulos).
+    Breakthrough    (   const Isotherm&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const UInt& = 1000
+                    ,   const Real& = 0);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    Breakthrough& operator = (const Breakthrough&);
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Simula a alimentacao de um leito limpo com concentracao _cfeed.
+/// </summary>
+///  @param _cfeed Concentracao da alimentacao.
+///  @param _dt Passo de tempo.
+///  @param _nsteps Numero de passos.
+///  @exception _cfeed, _dt ou _nsteps menores ou iguais a zero.
+    void Run    (   const Real&
+                ,   const Real&
+                ,   const UInt&);
+
+/// <summary>
+/// Executa varios casos (varredura de parametros) em paralelo. Cada caso
+/// possui o seu clone da isoterma.
+/// </summary>
+///  @param _cases Colunas a simular.
+///  @param _cfeed Concentracao da alimentacao.
+///  @param _dt Passo de tempo.
+///  @param _nsteps Numero de passos.
+///  @param _nthreads Numero de threads. 0 utiliza todos os nucleos.
+    static void Sweep   (   std::vector < Breakthrough >&
+                        ,   const Real&
+                        ,   const Real&
+                        ,   const UInt&
+                        ,   const UInt& = 0);
+
+//==============================================================================
+// Acesso aos resultados
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Instantes de tempo simulados.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Time () const {return time;};
+
+/// <summary>
+/// Concentracao na saida do leito em cada instante.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Outlet () const {return outlet;};
+
+/// <summary>
+/// Perfil de concentracao ao final da simulacao.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Concentration () const {return conc;};
+
+/// <summary>
+/// Perfil de quantidade adsorvida ao final da simulacao.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Loading () const {return load;};
+
+//==============================================================================
+// Acesso aos parametros
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline Real Length () const {return length;};
+    [[nodiscard]] inline Real Velocity () const {return velocity;};
+    [[nodiscard]] inline Real Dispersion () const {return dispersion;};
+    [[nodiscard]] inline Real PhaseRatio () const {return phaseRatio;};
+    [[nodiscard]] inline Real KLDF () const {return kldf;};
+    [[nodiscard]] inline UInt NumberCells () const {return ncells;};
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::unique_ptr<Isotherm>           isotherm;
+Real                                length = 0;
+Real                                velocity = 0;
+Real                                dispersion = 0;
+Real                                phaseRatio = 0;
+Real                                kldf = 0;
+UInt                                ncells = 0;
+Real                                temperature = 0;
+
+VecReal                             time;
+VecReal                             outlet;
+VecReal                             conc;
+VecReal                             load;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __BREAKTHROUGH_H__ */
+
+/** @} */
@@ -0,0 +1,276 @@
+//==============================================================================
+// Name        : Chromatography.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Coluna cromatografica pelo modelo de equilibrio-dispersivo
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup Chromatography Chromatography
+ *  @ingroup Process
+ *  Coluna cromatografica pelo modelo de equilibrio-dispersivo.
+ *  @{
+ */
+
+/// <summary>
+/// Coluna cromatografica pelo modelo de equilibrio-dispersivo.
+/// </summary>
+///  A fase estacionaria esta em equilibrio com a fase movel, q = Qe(c, T),
+///  e o modelo e escrito na forma conservativa para a concentracao total
+///  \f$ n = c + F Q_e(c) \f$:
+///\begin{align}
+///     \[\frac{\partial n}{\partial t} + u \frac{\partial c}{\partial z}
+///       = D_a \frac{\partial^2 c}{\partial z^2}\]
+///\end{align}
+///  O fluxo convectivo usa reconstrucao MUSCL com o limitador de Koren e o
+///  tempo e integrado pelo Runge-Kutta SSP de terceira ordem, de modo que as
+///  frentes de choque nao oscilam. Em cada estagio, c e recuperado de n por
+///  um Newton vetorial sobre toda a coluna: Qe e dQe/dCe sao avaliados em
+///  bloco, e cada celula mantem o seu intervalo de busca. A simulacao e
+///  deterministica, e varios cronogramas de injecao podem ser simulados em
+///  paralelo.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __CHROMATOGRAPHY_H__
+#define __CHROMATOGRAPHY_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class Chromatography {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "Chromatography"
+                        ,   ID::Chromatography
+                        );
+
+//==============================================================================
+// Injecao retangular
+//==============================================================================
+
+public:
+
+    struct Injection {
+        Real    start = 0;              //! Inicio da injecao
+        Real    width = 0;              //! Duracao da injecao
+        Real    concentration = 0;      //! Concentracao injetada
+    };
+
+    typedef std::vector<Injection>      Schedule;
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    Chromatography() = default;
+
+/// <summary>
+/// Construtora de copia. A isoterma e clonada.
+/// </summary>
+    Chromatography(const Chromatography&);
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~Chromatography() = default;
+
+/// <summary>
+/// Construtora com a isoterma e os parametros da coluna.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     Langmuir        iso(qmax, k1);
+///     Chromatography  column(iso, 0.25, 1.0e-3, 1.0e-7, 1.5);
+///     column.Run({{0.0, 60.0, 10.0}}, 1800.0);
+///     VecReal         outlet = column.Outlet();
+/// @endcode
+/// </example>
+///  @param _iso Isoterma da fase estacionaria.
+///  @param _length Comprimento da coluna.
+///  @param _velocity Velocidade intersticial.
+///  @param _dispersion Coeficiente de dispersao aparente.
+///  @param _phaseRatio Razao de fases F = (1 - eps) / eps.
+///  @param _ncells Numero de celulas.
+///  @param _temp Temperatura.
+///  @exception Parametros invalidos.
+    Chromatography  (   const Isotherm&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const Real&
+                    ,   const UInt& = 500
+                    ,   const Real& = 0);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    Chromatography& operator = (const Chromatography&);
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Simula a coluna, inicialmente limpa, ate _tend.
+/// </summary>
+///  @param _schedule Injecoes retangulares.
+///  @param _tend Tempo final.
+///  @param _cfl Numero de Courant, menor ou igual a 1.
+///  @exception Cronograma vazio ou com valores negativos, _tend <= 0.
+    void Run    (   const Schedule&
+                ,   const Real&
+                ,   const Real& = 0.4);
+
+/// <summary>
+/// Simula varios cronogramas em paralelo, um por coluna.
+/// </summary>
+///  @param _cases Colunas a simular.
+///  @param _schedules Cronogramas, um para cada coluna.
+///  @param _tend Tempo final.
+///  @param _cfl Numero de Courant.
+///  @param _nthreads Numero de threads. 0 utiliza todos os nucleos.
+    static void Sweep   (   std::vector < Chromatography >&
+                        ,   const std::vector < Schedule >&
+                        ,   const Real&
+                        ,   const Real& = 0.4
+                        ,   const UInt& = 0);
+
+/// <summary>
+/// Concentracao de alimentacao no instante _t.
+/// </summary>
+    [[nodiscard]] static Real Feed (const Schedule&, const Real&);
+
+//==============================================================================
+// Acesso aos resultados
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Instantes de tempo simulados.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Time () const {return time;};
+
+/// <summary>
+/// Concentracao na saida da coluna em cada instante.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Outlet () const {return outlet;};
+
+/// <summary>
+/// Perfil de concentracao ao final da simulacao.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Concentration () const {return conc;};
+
+//==============================================================================
+// Acesso aos parametros
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline Real Length () const {return length;};
+    [[nodiscard]] inline Real Velocity () const {return velocity;};
+    [[nodiscard]] inline Real Dispersion () const {return dispersion;};
+    [[nodiscard]] inline Real PhaseRatio () const {return phaseRatio;};
+    [[nodiscard]] inline UInt NumberCells () const {return ncells;};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Taxa de variacao de n por celula, dado o perfil _c e a alimentacao _cin.
+/// </summary>
+    void Rate   (   const VecReal&
+                ,   const Real&
+                ,   VecReal&
+                ) const;
+
+/// <summary>
+/// Recupera c de n = c + F Qe(c) em todas as celulas.
+/// </summary>
+    void Invert (   const VecReal&
+                ,   const Real&             // concentracao de referencia
+                ,   VecReal&
+                );
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::unique_ptr<Isotherm>           isotherm;
+Real                                length = 0;
+Real                                velocity = 0;
+Real                                dispersion = 0;
+Real                                phaseRatio = 0;
+UInt                                ncells = 0;
+Real                                temperature = 0;
+
+VecReal                             time;
+VecReal                             outlet;
+VecReal                             conc;
+
+VecReal                             ceff;           //! Areas de trabalho da inversao
+VecReal                             qs;
+VecReal                             dqs;
+VecReal                             lower;
+VecReal                             upper;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __CHROMATOGRAPHY_H__ */
+
+/** @} */
@@ -0,0 +1,291 @@
+//==============================================================================
+// Name        : PressureSwing.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Ciclo de adsorcao com modulacao de pressao (PSA, Skarstrom)
+//               com aceleracao do estado estacionario ciclico
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup PressureSwing PressureSwing
+ *  @ingroup Process
+ *  Ciclo PSA de Skarstrom.
+ *  @{
+ */
+
+/// <summary>
+/// Ciclo de adsorcao com modulacao de pressao (PSA) de Skarstrom.
+/// </summary>
+///  O leito e isotermico, sem queda de pressao e sem dispersao axial, com
+///  transferencia de massa LDF. O ciclo tem quatro etapas:
+///  pressurizacao com a alimentacao (saida fechada), adsorcao a pressao alta,
+///  despressurizacao em contracorrente (entrada aberta) e purga a pressao
+///  baixa com parte do produto leve. A velocidade do gas e obtida do balanco
+///  molar total em cada passo, e os balancos por componente usam volumes
+///  finitos upwind. As cargas de equilibrio sao avaliadas em bloco sobre
+///  todo o leito com um modelo multicomponente (IAST das isotermas puras,
+///  por exemplo Langmuir, Sips, Toth ou DubininRadushkevich, ou
+///  ExtendedLangmuir).
+///
+///  O estado estacionario ciclico (CSS) e o ponto fixo do mapa de um ciclo,
+///  x -> G(x), em que x sao as fracoes molares e as cargas do leito no inicio
+///  da pressurizacao. A aceleracao de Anderson combina os ultimos resultados
+///  de G e reduz varias vezes o numero de ciclos simulados em relacao a
+///  substituicao direta (memoria zero), que e a simulacao ciclo a ciclo.
+///
+///  Pressoes em Pa: as isotermas devem usar a pressao parcial em Pa.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __PRESSURE_SWING_H__
+#define __PRESSURE_SWING_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>           // std::unique_ptr
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/Multicomponent.h>
+
+IST_NAMESPACE_OPEN
+
+class PressureSwing {
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentityBase  (   "PressureSwing"
+                        ,   ID::PressureSwing
+                        );
+
+//==============================================================================
+// Dados do leito e do ciclo
+//==============================================================================
+
+public:
+
+    struct Bed {
+        Real        length = 0;         //! Comprimento [m]
+        Real        voidage = 0;        //! Porosidade do leito
+        Real        density = 0;        //! Massa especifica aparente [kg/m3]
+        Real        temperature = 0;    //! Temperatura [K]
+        VecReal     kldf;               //! Coeficiente LDF de cada componente [1/s]
+    };
+
+    struct Cycle {
+        Real        pHigh = 0;          //! Pressao de adsorcao [Pa]
+        Real        pLow = 0;           //! Pressao de purga [Pa]
+        VecReal     yFeed;              //! Fracoes molares da alimentacao
+        Real        vFeed = 0;          //! Velocidade da alimentacao [m/s]
+        Real        vPurge = 0;         //! Velocidade da purga [m/s]
+        Real        tPress = 0;         //! Duracao da pressurizacao [s]
+        Real        tAds = 0;           //! Duracao da adsorcao [s]
+        Real        tBlow = 0;          //! Duracao da despressurizacao [s]
+        Real        tPurge = 0;         //! Duracao da purga [s]
+    };
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    PressureSwing() = default;
+
+/// <summary>
+/// Construtora de copia. O modelo de equilibrio e clonado.
+/// </summary>
+    PressureSwing(const PressureSwing&);
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~PressureSwing() = default;
+
+/// <summary>
+/// Construtora com o modelo de equilibrio da mistura.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     IAST            mix({&langmuirN2, &tothO2});
+///     PressureSwing   psa(mix, bed, cycle);
+///     UInt            ncycles = psa.Solve();
+///     Real            purity = psa.Purity(1);
+/// @endcode
+/// </example>
+///  @param _mix Modelo de equilibrio multicomponente.
+///  @param _bed Dados do leito.
+///  @param _cycle Dados do ciclo.
+///  @param _ncells Numero de celulas.
+///  @exception Dados inconsistentes com o numero de componentes ou invalidos.
+    PressureSwing   (   const Multicomponent&
+                    ,   const Bed&
+                    ,   const Cycle&
+                    ,   const UInt& = 30);
+
+/// <summary>
+/// Construtora com as isotermas dos gases puros, combinadas pela IAST.
+/// </summary>
+    PressureSwing   (   const std::vector < const Isotherm* >&
+                    ,   const Bed&
+                    ,   const Cycle&
+                    ,   const UInt& = 30);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    PressureSwing& operator = (const PressureSwing&);
+
+//==============================================================================
+// Funcoes
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Calcula o estado estacionario ciclico a partir do leito em equilibrio
+/// com a alimentacao a pressao baixa.
+/// </summary>
+///  @param _maxCycles Numero maximo de ciclos simulados.
+///  @param _tole Tolerancia da diferenca entre dois ciclos.
+///  @param _memory Memoria da aceleracao de Anderson; 0 e substituicao direta.
+///  @return Numero de ciclos simulados.
+///  @exception Sem convergencia em _maxCycles ciclos.
+    UInt Solve  (   const UInt& = 500
+                ,   const Real& = 1.0e-6
+                ,   const UInt& = 5);
+
+//==============================================================================
+// Acesso aos resultados
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Norma da diferenca entre dois ciclos sucessivos em cada iteracao.
+/// </summary>
+    [[nodiscard]] inline const VecReal& Residuals () const {return residuals;};
+
+/// <summary>
+/// Fracoes molares no leito no inicio do ciclo, por componente.
+/// </summary>
+    [[nodiscard]] inline const VecVecReal& MoleFraction () const {return yBed;};
+
+/// <summary>
+/// Cargas no leito no inicio do ciclo, por componente.
+/// </summary>
+    [[nodiscard]] inline const VecVecReal& Loading () const {return qBed;};
+
+/// <summary>
+/// Mols por ciclo, por unidade de area livre, de cada componente que
+/// entram com a alimentacao, saem no produto, entram com a purga e saem
+/// no rejeito.
+/// </summary>
+    [[nodiscard]] inline Real FeedIn (const UInt& _i) const {return feedIn.at(_i);};
+    [[nodiscard]] inline Real ProductOut (const UInt& _i) const {return productOut.at(_i);};
+    [[nodiscard]] inline Real PurgeIn (const UInt& _i) const {return purgeIn.at(_i);};
+    [[nodiscard]] inline Real WasteOut (const UInt& _i) const {return wasteOut.at(_i);};
+
+/// <summary>
+/// Pureza do componente _i no produto da etapa de adsorcao.
+/// </summary>
+    [[nodiscard]] Real Purity (const UInt&) const;
+
+/// <summary>
+/// Recuperacao liquida do componente _i: (produto - purga) / alimentacao.
+/// </summary>
+    [[nodiscard]] Real Recovery (const UInt&) const;
+
+    [[nodiscard]] inline size_t NumberComponents () const {return ncomp;};
+    [[nodiscard]] inline UInt NumberCells () const {return ncells;};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+    enum StepKind {Pressurization, Adsorption, Blowdown, Purge};
+
+    void Check () const;
+
+/// <summary>
+/// Mapa de um ciclo: _x e substituido por G(_x). As fracoes molares ocupam
+/// o inicio de _x e as cargas, divididas por qref, o final.
+/// </summary>
+    void CycleMap (VecReal&);
+
+/// <summary>
+/// Integra uma etapa do ciclo a partir do estado em yBed e qBed.
+/// </summary>
+    void Step   (   const StepKind&
+                ,   const Real&             // duracao
+                ,   const VecReal&          // composicao da purga
+                );
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::unique_ptr<Multicomponent>     mixture;
+Bed                                 bed;
+Cycle                               cycle;
+UInt                                ncells = 0;
+size_t                              ncomp = 0;
+Real                                qref = 1;
+
+VecReal                             residuals;
+VecVecReal                          yBed;
+VecVecReal                          qBed;
+VecReal                             feedIn;
+VecReal                             productOut;
+VecReal                             purgeIn;
+VecReal                             wasteOut;
+
+VecVecReal                          pPartial;       //! Areas de trabalho
+VecVecReal                          qStar;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __PRESSURE_SWING_H__ */
+
+/** @} */
@@ -0,0 +1,279 @@
+//==============================================================================
+// Name        : MemoizedIsotherm.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Isoterma que memoriza os valores de Qe de outra isoterma
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup MemoizedIsotherm MemoizedIsotherm
+ *  @ingroup Surrogate
+ *  Isoterma com memoria dos valores ja calculados.
+ *  @{
+ */
+
+/// <summary>
+/// Isoterma que guarda os valores de Qe(Ce, T) de outra isoterma, de modo que
+/// consultas repetidas, comuns nos lacos de otimizacao com modelos
+/// implicitos, sejam resolvidas por uma busca em tabela hash.
+/// </summary>
+///  Os pares (Ce, T) sao comparados bit a bit. A memoria e dividida em
+///  particoes, cada uma com a sua trava e a sua lista LRU; consultas em
+///  particoes diferentes nao disputam a mesma trava. Todas as particoes
+///  usam o mesmo clone do modelo, avaliado fora da trava, pois os modelos
+///  sao reentrantes.
+///
+///  Cada particao guarda no maximo Capacity() valores, obtido do limite de
+///  memoria informado; ao atingi-lo, o valor usado ha mais tempo e
+///  descartado. Hits() e Misses() contam as consultas resolvidas pela
+///  memoria e pelo modelo. DQDC e Ce sao repassadas ao modelo, sem memoria.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __MEMOIZED_ISOTHERM_H__
+#define __MEMOIZED_ISOTHERM_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <atomic>           // std::atomic
+#include <cstdint>          // std::uint64_t
+#include <list>             // std::list
+#include <memory>           // std::unique_ptr
+#include <mutex>            // std::mutex
+#include <unordered_map>    // std::unordered_map
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class MemoizedIsotherm : public IsothermTemplate < MemoizedIsotherm >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "MemoizedIsotherm"
+                    ,   ID::MemoizedIsotherm
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    MemoizedIsotherm() = default;
+
+/// <summary>
+/// Construtora de copia. A copia recebe um clone do modelo e uma memoria
+/// vazia com o mesmo limite.
+/// </summary>
+    MemoizedIsotherm(const MemoizedIsotherm&);
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~MemoizedIsotherm() = default;
+
+/// <summary>
+/// Construtora com o modelo e o limite de memoria.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     FowlerGuggenheim    iso(qmax, k1, k2);
+///     MemoizedIsotherm    memo(iso, 1 << 20);
+///     Real                qe = memo.Qe(ce, temp);
+/// @endcode
+/// </example>
+///  @param _iso Isoterma memorizada.
+///  @param _budget Limite de memoria, em bytes.
+///  @param _nshard Numero de particoes.
+///  @exception _budget insuficiente para um valor por particao ou _nshard = 0.
+    MemoizedIsotherm    (   const Isotherm&
+                        ,   const size_t& = 1 << 24
+                        ,   const UInt& = 16);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    MemoizedIsotherm& operator = (const MemoizedIsotherm&);
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida, da memoria ou do modelo.
+/// </summary>
+    using Isotherm::Qe;
+
+    [[nodiscard]]
+    Real Qe (const Real&, const Real&) const override;
+
+    [[nodiscard]]
+    inline Real Qe (const Real& _c) const override
+    {
+        return Qe(_c, 0);
+    }
+
+/// <summary>
+/// Derivada dQe/dCe do modelo.
+/// </summary>
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
+/// <summary>
+/// Isoterma inversa do modelo.
+/// </summary>
+    [[nodiscard]]
+    Real Ce (   const Real&
+            ,   const Real& = 0) const override;
+
+    [[nodiscard]]
+    bool ExplicitCe (   const Real&
+                    ,   const Real&
+                    ,   Real&
+                    ,   Real&
+                    ) const override;
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Isotherm> CloneImplementation() const override
+    {
+        return std::make_unique<MemoizedIsotherm>(*this);
+    }
+
+//==============================================================================
+// Acesso aos dados da memoria
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline size_t Budget () const {return static_cast<size_t>(Value(0));};
+    [[nodiscard]] inline size_t NumberShards () const {return shards.size();};
+
+/// <summary>
+/// Numero maximo de valores guardados por particao.
+/// </summary>
+    [[nodiscard]] inline size_t Capacity () const {return capacity;};
+
+/// <summary>
+/// Numero de valores guardados.
+/// </summary>
+    [[nodiscard]] size_t Size () const;
+
+    [[nodiscard]] inline std::uint64_t Hits () const {return hits.load(std::memory_order_relaxed);};
+    [[nodiscard]] inline std::uint64_t Misses () const {return misses.load(std::memory_order_relaxed);};
+
+/// <summary>
+/// Descarta os valores guardados e zera os contadores.
+/// </summary>
+    void Clear ();
+
+/// <summary>
+/// Isoterma memorizada.
+/// </summary>
+    [[nodiscard]] const Isotherm& Model () const;
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Par (Ce, T) de uma consulta e a sua funcao hash.
+/// </summary>
+    struct Key {
+
+        Real            ce;
+        Real            temperature;
+
+        [[nodiscard]] bool operator == (const Key&) const;
+    };
+
+    struct KeyHash {
+
+        [[nodiscard]] size_t operator () (const Key&) const;
+    };
+
+    struct Entry {
+
+        Key             key;
+        Real            qe;
+    };
+
+/// <summary>
+/// Particao da memoria: lista LRU, com o valor mais recente no inicio, e
+/// indice hash sobre a lista.
+/// </summary>
+    struct Shard {
+
+        std::mutex                                                          mutex;
+        std::list < Entry >                                                 lru;
+        std::unordered_map < Key, std::list < Entry >::iterator, KeyHash >  index;
+    };
+
+    void Copy (const MemoizedIsotherm&);
+
+    void Check () const;
+
+    [[nodiscard]] Shard& Locate (const Key&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+std::unique_ptr<Isotherm>                   model;
+std::vector < std::unique_ptr < Shard > >   shards;
+size_t                                      capacity = 0;
+mutable std::atomic < std::uint64_t >       hits {0};
+mutable std::atomic < std::uint64_t >       misses {0};
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __MEMOIZED_ISOTHERM_H__ */
+
+/** @} */
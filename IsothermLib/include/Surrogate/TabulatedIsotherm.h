@@ -0,0 +1,329 @@
+//==============================================================================
+// Name        : TabulatedIsotherm.h
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Isoterma tabelada com controle de erro, substituta de modelos
+//               de avaliacao cara
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+/** @defgroup TabulatedIsotherm TabulatedIsotherm
+ *  @ingroup Surrogate
+ *  Isoterma tabelada com controle de erro.
+ *  @{
+ */
+
+/// <summary>
+/// Isoterma tabelada com controle de erro, que substitui qualquer Isotherm
+/// de avaliacao cara, como os modelos implicitos resolvidos por Newton.
+/// </summary>
+///  A tabela representa \f$ u(s) = \ln Q_e(e^s) \f$ por splines cubicas de
+///  Hermite em \f$ s = \ln C \f$, com as derivadas exatas nos nos obtidas de
+///  DQDC. O erro absoluto em u e, portanto, o erro relativo em Qe. Os
+///  intervalos de [Cmin, Cmax] sao subdivididos ate que o erro nos pontos
+///  t = 1/4, 1/2 e 3/4 de cada intervalo seja menor que a tolerancia. Ao
+///  final, o erro e medido em t = 1/3 de todos os intervalos e guardado em
+///  ErrorBound().
+///
+///  Com uma faixa de temperaturas, as mesmas abscissas em s sao tabeladas
+///  nos nos de Chebyshev-Lobatto de [Tmin, Tmax], e a temperatura e
+///  interpolada pela formula baricentrica. O numero de nos e dobrado ate que
+///  o erro entre os nos tambem seja menor que a tolerancia.
+///
+///  A localizacao do intervalo e feita em O(1) por um indice de baldes
+///  uniformes em s. A avaliacao em bloco calcula os pesos da temperatura uma
+///  so vez e separa a localizacao dos intervalos da avaliacao das splines,
+///  um laco sem desvios que o compilador pode vetorizar. Fora de
+///  [Cmin, Cmax], u e extrapolada linearmente, isto e, Qe segue uma lei de
+///  potencia, sem garantia de erro.
+///  \authors   Joao Flavio Vieira de Vasconcellos
+///  \version   1.0
+///  \date      2022
+///  \bug       Nao ha bugs conhecidos.
+///
+///  \copyright GNU Public License.
+
+#ifndef __TABULATED_ISOTHERM_H__
+#define __TABULATED_ISOTHERM_H__
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cstdint>          // std::uint32_t
+#include <vector>           // std::vector
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm.h>
+
+IST_NAMESPACE_OPEN
+
+class TabulatedIsotherm : public IsothermTemplate < TabulatedIsotherm >
+{
+
+//==============================================================================
+// ID da classe
+//==============================================================================
+
+public:
+
+    DefineIdentity  (   "TabulatedIsotherm"
+                    ,   ID::TabulatedIsotherm
+                    );
+
+//==============================================================================
+// Funcoes Construtoras/Destrutora
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Construtora default.
+/// </summary>
+    TabulatedIsotherm() = default;
+
+/// <summary>
+/// Construtora de copia.
+/// </summary>
+    TabulatedIsotherm(const TabulatedIsotherm&) = default;
+
+/// <summary>
+/// Destrutora.
+/// </summary>
+    virtual ~TabulatedIsotherm() = default;
+
+/// <summary>
+/// Construtora que tabela _iso a temperatura fixa.
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     FowlerGuggenheim    iso(qmax, k1, k2);
+///     TabulatedIsotherm   table(iso, 1.0e-6, 1.0e3, 1.0e-9, temp);
+///     Real                qe = table.Qe(ce);
+/// @endcode
+/// </example>
+///  @param _iso Isoterma tabelada.
+///  @param _cmin Menor concentracao tabelada.
+///  @param _cmax Maior concentracao tabelada.
+///  @param _tole Tolerancia do erro relativo em Qe.
+///  @param _temp Temperatura. As consultas aceitam apenas _temp ou 0, a
+///  temperatura nao informada.
+///  @exception _cmin <= 0 ou _cmax <= _cmin ou _tole <= 0.
+    TabulatedIsotherm   (   const Isotherm&
+                        ,   const Real&
+                        ,   const Real&
+                        ,   const Real& = 1.0e-9
+                        ,   const Real& = 0);
+
+/// <summary>
+/// Construtora que tabela _iso em [Cmin, Cmax] x [Tmin, Tmax].
+/// </summary>
+/// <example>
+/// Uso:
+/// @code
+///     TabulatedIsotherm   table(iso, 1.0e-6, 1.0e3, 280.0, 360.0, 1.0e-9);
+///     Real                qe = table.Qe(ce, 300.0);
+/// @endcode
+/// </example>
+///  @param _iso Isoterma tabelada.
+///  @param _cmin Menor concentracao tabelada.
+///  @param _cmax Maior concentracao tabelada.
+///  @param _tmin Menor temperatura tabelada.
+///  @param _tmax Maior temperatura tabelada.
+///  @param _tole Tolerancia do erro relativo em Qe.
+///  @exception Faixas vazias, _tmin <= 0 ou _tole <= 0.
+    TabulatedIsotherm   (   const Isotherm&
+                        ,   const Real&
+                        ,   const Real&
+                        ,   const Real&
+                        ,   const Real&
+                        ,   const Real&);
+
+//==============================================================================
+// Sobrecarga de operadores
+//==============================================================================
+
+public:
+
+    TabulatedIsotherm& operator = (const TabulatedIsotherm&) = default;
+
+//==============================================================================
+// Funcoes virtuais
+//==============================================================================
+
+public:
+
+/// <summary>
+/// Quantidade adsorvida interpolada.
+/// </summary>
+///  @exception _c < 0, _temp fora da faixa de temperaturas ou, com uma so
+///  temperatura, _temp diferente de 0 e da temperatura tabelada.
+    using Isotherm::Qe;
+
+    [[nodiscard]]
+    Real Qe (const Real&, const Real&) const override;
+
+    [[nodiscard]]
+    inline Real Qe (const Real& _c) const override
+    {
+        return Qe(_c, 0);
+    }
+
+/// <summary>
+/// Quantidade adsorvida interpolada para um conjunto de concentracoes.
+/// </summary>
+    void Qe (   std::span<const Real>
+            ,   std::span<Real>
+            ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe da spline.
+/// </summary>
+    [[nodiscard]]
+    Real DQDC   (   const Real&
+                ,   const Real& = 0) const override;
+
+/// <summary>
+/// Derivada dQe/dCe da spline para um conjunto de concentracoes.
+/// </summary>
+    void DQDC   (   std::span<const Real>
+                ,   std::span<Real>
+                ,   const Real& = 0) const override;
+
+    [[nodiscard]]
+    virtual std::unique_ptr<Isotherm> CloneImplementation() const override
+    {
+        return std::make_unique<TabulatedIsotherm>(*this);
+    }
+
+//==============================================================================
+// Acesso aos dados da tabela
+//==============================================================================
+
+public:
+
+    [[nodiscard]] inline Real Cmin () const {return Value(0);};
+    [[nodiscard]] inline Real Cmax () const {return Value(1);};
+    [[nodiscard]] inline Real Tmin () const {return Value(2);};
+    [[nodiscard]] inline Real Tmax () const {return Value(3);};
+    [[nodiscard]] inline Real Tolerance () const {return Value(4);};
+
+/// <summary>
+/// Maior erro relativo em Qe medido apos a construcao.
+/// </summary>
+    [[nodiscard]] inline Real ErrorBound () const {return errorBound;};
+
+    [[nodiscard]] inline size_t NumberNodes () const {return nodeS.size();};
+    [[nodiscard]] inline size_t NumberTemperatures () const {return nodeT.size();};
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+protected:
+
+/// <summary>
+/// Constroi a tabela com _nt nos de temperatura; retorna o erro medido.
+/// </summary>
+    Real Build  (   const Isotherm&
+                ,   const UInt&
+                );
+
+/// <summary>
+/// Subdivide [_sa, _sb] ate que o erro em todas as temperaturas seja menor
+/// que a tolerancia. _ua, _da, _ub e _db tem um valor por temperatura.
+/// </summary>
+    void Refine (   const Isotherm&
+                ,   const Real&                 // s_a
+                ,   const VecReal&              // u_a
+                ,   const VecReal&              // du/ds em s_a
+                ,   const Real&                 // s_b
+                ,   const VecReal&              // u_b
+                ,   const VecReal&              // du/ds em s_b
+                ,   const UInt&                 // profundidade
+                ,   VecReal&                    // s
+                ,   std::vector < VecReal >&    // u por temperatura
+                ,   std::vector < VecReal >&    // du/ds por temperatura
+                ) const;
+
+/// <summary>
+/// Valores e derivadas de u = ln Qe em s = ln C para cada temperatura.
+/// </summary>
+    void Sample (   const Isotherm&
+                ,   const Real&
+                ,   VecReal&
+                ,   VecReal&
+                ) const;
+
+/// <summary>
+/// Pesos baricentricos da temperatura _temp nos nos de temperatura, em
+/// _w[0 .. NumberTemperatures()).
+/// </summary>
+    void Weights (const Real&, Real*) const;
+
+/// <summary>
+/// Verifica a concentracao e a temperatura de uma consulta.
+/// </summary>
+    void Check (const Real&, const Real&) const;
+
+/// <summary>
+/// Interpola u e du/ds em _s com os pesos _w.
+/// </summary>
+    void Interpolate    (   const Real&
+                        ,   const Real*
+                        ,   Real&
+                        ,   Real&
+                        ) const;
+
+/// <summary>
+/// Avaliacao em bloco de Qe ou, com _derivative, de dQe/dCe.
+/// </summary>
+    void Block  (   std::span<const Real>
+                ,   std::span<Real>
+                ,   const Real&
+                ,   const bool&
+                ) const;
+
+    [[nodiscard]] size_t Interval (const Real&) const;
+
+//==============================================================================
+// Dados da classe
+//==============================================================================
+
+protected:
+
+VecReal                             nodeS;          //! Abscissas s = ln C
+VecReal                             nodeU;          //! u = ln Qe, por temperatura e no
+VecReal                             nodeD;          //! du/ds, por temperatura e no
+VecReal                             nodeT;          //! Nos de temperatura
+VecReal                             baryT;          //! Pesos baricentricos dos nos de temperatura
+std::vector < std::uint32_t >       bucket;         //! Indice de baldes uniformes em s
+Real                                invDs = 0;
+Real                                errorBound = 0;
+
+};
+
+IST_NAMESPACE_CLOSE
+
+#endif /* __TABULATED_ISOTHERM_H__ */
+
+/** @} */
@@ -45,6 +45,15 @@ static std::string IsoExceptionStr[] =
     ,       "O valor de theta maior ou igual a 1."                     // BadThetaGEOne
     ,       "O valor de theta menor ou igual a 0."                     // BadThetaLEZero
     ,       "O valor de K_1 C menor ou igual a 1."                     // BadKCeK1LEOne
+    ,       "Numero de componentes da mistura inconsistente."          // BadNumberComponents
+    ,       "Tamanho dos vetores de composicao inconsistente."         // BadCompositionSize
+    ,       "Fator de interacao menor ou igual a zero."                // BadEtaLEZero
+    ,       "Intervalo de concentracao invalido."                      // BadRange
+    ,       "Erro de leitura ou escrita de arquivo."                   // BadFile
+    ,       "Parametro do processo invalido."                          // BadParameter
+    ,       "Tempo menor do que zero."                                 // BadTimeLTZero
+    ,       "Qe menor do que zero."                                    // BadQeLTZero
+    ,       "Qe fora da faixa atingida pela isoterma."                 // BadQeRange
 };
 
 
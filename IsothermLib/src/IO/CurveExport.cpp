@@ -0,0 +1,428 @@
+//==============================================================================
+// Name        : CurveExport.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Gravacao de curvas de isotermas em texto ou binario
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <IO/CurveExport.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+namespace {
+
+const char          MAGIC[8] = {'I', 'S', 'T', 'C', 'R', 'V', '0', '1'};
+
+//  Maior numero de caracteres de um double na menor representacao decimal
+
+const size_t        MAXCHARS = 24;
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "CurveExport :: CurveExport (const size_t&, const Real&, const Real&, const Grid&)"
+CurveExport :: CurveExport  (   const size_t&   _npto
+                            ,   const Real&     _xini
+                            ,   const Real&     _xfim
+                            ,   const Grid&     _grid
+                            )
+{
+
+    try {
+
+        if (_npto < 2 || !(_xfim > _xini)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+        if (_grid == Grid::Log && _xini <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Cada ponto e obtido do seu indice, sem acumular o passo, e o ultimo e
+//  exatamente _xfim
+
+    ce.resize(_npto);
+
+    if (_grid == Grid::Linear) {
+
+    const Real  dx ((_xfim - _xini) / (_npto - 1));
+
+        for (size_t k = 0; k < _npto; ++k) ce[k] = _xini + k * dx;
+
+    } else {
+
+    const Real  lini (std::log(_xini));
+    const Real  dx ((std::log(_xfim) - lini) / (_npto - 1));
+
+        for (size_t k = 0; k < _npto; ++k) ce[k] = std::exp(lini + k * dx);
+
+        ce.front() = _xini;
+    }
+
+    ce.back() = _xfim;
+
+}
+
+//==============================================================================
+// Gravacao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::ofstream CurveExport :: Open (const std::string&, const Format&, const size_t&) const"
+std::ofstream
+CurveExport :: Open (   const std::string&  _file
+                    ,   const Format&       _format
+                    ,   const size_t&       _ncol
+                    ) const
+{
+
+std::ofstream   out;
+
+    try {
+
+        if (ce.empty()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        out.open(_file, std::ios::binary | std::ios::trunc);
+
+        if (_format == Format::Columnar) {
+
+        Header  head {};
+
+            std::memcpy(head.magic, MAGIC, sizeof(MAGIC));
+            head.npto = ce.size();
+            head.ncol = _ncol;
+
+            out.write(reinterpret_cast<const char*>(&head), sizeof(Header));
+        }
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return out;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void CurveExport :: Append (std::ofstream&, const std::string&, const Format&, const size_t&, std::span<const Real>, std::span<const Real>, std::string&) const"
+void
+CurveExport :: Append   (   std::ofstream&          _out
+                        ,   const std::string&      _file
+                        ,   const Format&           _format
+                        ,   const size_t&           _ini
+                        ,   std::span<const Real>   _x
+                        ,   std::span<const Real>   _y
+                        ,   std::string&            _buffer
+                        ) const
+{
+
+IST_TRACE("CurveExport", "io");
+
+const size_t    n (_x.size());
+
+    switch (_format) {
+
+        case Format::Text: {
+
+            _buffer.resize(n * (2 * MAXCHARS + 2));
+
+        char*   ptr (_buffer.data());
+        char*   end (_buffer.data() + _buffer.size());
+
+            for (size_t k = 0; k < n; ++k) {
+                ptr    = std::to_chars(ptr, end, _x[k]).ptr;
+                *ptr++ = '\t';
+                ptr    = std::to_chars(ptr, end, _y[k]).ptr;
+                *ptr++ = '\n';
+            }
+
+            _out.write(_buffer.data(), ptr - _buffer.data());
+            break;
+        }
+
+        case Format::Binary: {
+
+            _buffer.resize(2 * n * sizeof(Real));
+
+        char*   ptr (_buffer.data());
+
+            for (size_t k = 0; k < n; ++k) {
+                std::memcpy(ptr, &_x[k], sizeof(Real));
+                std::memcpy(ptr + sizeof(Real), &_y[k], sizeof(Real));
+                ptr += 2 * sizeof(Real);
+            }
+
+            _out.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+            break;
+        }
+
+        case Format::Columnar: {
+
+        const std::streamoff    offset (sizeof(Header) + _ini * sizeof(Real));
+        const std::streamoff    column (ce.size() * sizeof(Real));
+
+            _out.seekp(offset);
+            _out.write(reinterpret_cast<const char*>(_x.data()), static_cast<std::streamsize>(n * sizeof(Real)));
+            _out.seekp(offset + column);
+            _out.write(reinterpret_cast<const char*>(_y.data()), static_cast<std::streamsize>(n * sizeof(Real)));
+            break;
+        }
+    }
+
+    try {
+
+        if (!_out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void CurveExport :: Append (std::ofstream&, const std::string&, const Format&, const size_t&, std::span<const Real>, std::span<const Real>, const size_t&, std::string&) const"
+void
+CurveExport :: Append   (   std::ofstream&          _out
+                        ,   const std::string&      _file
+                        ,   const Format&           _format
+                        ,   const size_t&           _ini
+                        ,   std::span<const Real>   _x
+                        ,   std::span<const Real>   _y
+                        ,   const size_t&           _ncurve
+                        ,   std::string&            _buffer
+                        ) const
+{
+
+IST_TRACE("CurveExport", "io");
+
+const size_t    n (_x.size());
+const size_t    ncol (1 + _ncurve);
+
+//  _y guarda as curvas uma apos a outra: o valor da curva j no ponto k e
+//  _y[j * n + k]
+
+    switch (_format) {
+
+        case Format::Text: {
+
+            _buffer.resize(n * ncol * (MAXCHARS + 1));
+
+        char*   ptr (_buffer.data());
+        char*   end (_buffer.data() + _buffer.size());
+
+            for (size_t k = 0; k < n; ++k) {
+                ptr = std::to_chars(ptr, end, _x[k]).ptr;
+                for (size_t j = 0; j < _ncurve; ++j) {
+                    *ptr++ = '\t';
+                    ptr    = std::to_chars(ptr, end, _y[j * n + k]).ptr;
+                }
+                *ptr++ = '\n';
+            }
+
+            _out.write(_buffer.data(), ptr - _buffer.data());
+            break;
+        }
+
+        case Format::Binary: {
+
+            _buffer.resize(n * ncol * sizeof(Real));
+
+        char*   ptr (_buffer.data());
+
+            for (size_t k = 0; k < n; ++k) {
+                std::memcpy(ptr, &_x[k], sizeof(Real));
+                ptr += sizeof(Real);
+                for (size_t j = 0; j < _ncurve; ++j) {
+                    std::memcpy(ptr, &_y[j * n + k], sizeof(Real));
+                    ptr += sizeof(Real);
+                }
+            }
+
+            _out.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+            break;
+        }
+
+        case Format::Columnar: {
+
+        const std::streamoff    offset (sizeof(Header) + _ini * sizeof(Real));
+        const std::streamoff    column (ce.size() * sizeof(Real));
+
+            _out.seekp(offset);
+            _out.write(reinterpret_cast<const char*>(_x.data()), static_cast<std::streamsize>(n * sizeof(Real)));
+
+            for (size_t j = 0; j < _ncurve; ++j) {
+                _out.seekp(offset + static_cast<std::streamoff>(j + 1) * column);
+                _out.write(reinterpret_cast<const char*>(_y.data() + j * n), static_cast<std::streamsize>(n * sizeof(Real)));
+            }
+            break;
+        }
+    }
+
+    try {
+
+        if (!_out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void CurveExport :: WriteHeader (std::ofstream&, const std::string&, std::span<const Curve>) const"
+void
+CurveExport :: WriteHeader  (   std::ofstream&          _out
+                            ,   const std::string&      _file
+                            ,   std::span<const Curve>  _curves
+                            ) const
+{
+
+    _out << "#Ce";
+
+    for (const auto& curve : _curves) _out << '\t' << curve.name;
+
+    _out << '\n';
+
+    try {
+
+        if (!_out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::vector < std::unique_ptr<Isotherm> > CurveExport :: CloneModels (std::span<const Curve>)"
+std::vector < std::unique_ptr<Isotherm> >
+CurveExport :: CloneModels (std::span<const Curve> _curves)
+{
+
+std::vector < std::unique_ptr<Isotherm> >   models;
+
+    models.reserve(_curves.size());
+
+    for (const auto& curve : _curves) models.push_back(curve.iso->Clone());
+
+    return models;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void CurveExport :: Close (std::ofstream&, const std::string&) const"
+void
+CurveExport :: Close    (   std::ofstream&          _out
+                        ,   const std::string&      _file
+                        ) const
+{
+
+    _out.close();
+
+    try {
+
+        if (!_out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,400 @@
+//==============================================================================
+// Name        : Dataset.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Leitura de dados experimentais de equilibrio (CSV/TSV)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+
+//==============================================================================
+// includes POSIX
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <IO/Dataset.h>
+#include <Misc/Parallel.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+namespace {
+
+//  Grandezas lidas de cada linha, na ordem de Layout
+
+enum Slot {SCE = 0, SQE, STEMP, SWEIGHT, SSERIES, NSLOT};
+
+//  Menor bloco lido por uma thread
+
+const size_t        MINBLOCK = 1 << 20;
+
+inline bool IsBlank (const char& _c)
+{
+    return _c == ' ' || _c == '\t';
+}
+
+}
+
+//==============================================================================
+// Leitura
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Dataset Dataset :: Load (const std::string&, const Layout&, const UInt&)"
+Dataset
+Dataset :: Load (   const std::string&  _file
+                ,   const Layout&       _layout
+                ,   const UInt&         _nthreads
+                )
+{
+
+IST_TRACE("Dataset::Load", "io");
+
+Dataset     data;
+void*       addr (MAP_FAILED);
+size_t      bytes (0);
+
+    try {
+
+    const int       fd (::open(_file.c_str(), O_RDONLY));
+    struct stat     info;
+
+        if (fd < 0 || ::fstat(fd, &info) != 0) {
+            if (fd >= 0) ::close(fd);
+            throw   IsoException    (   IST_LOC
+                                    ,   data.className()
+                                    ,   BadFile
+                                    ,   _file
+                                    );
+        }
+
+        bytes = static_cast<size_t>(info.st_size);
+
+        if (bytes > 0) addr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        ::close(fd);
+
+        if (bytes > 0 && addr == MAP_FAILED) throw
+                IsoException    (   IST_LOC
+                                ,   data.className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (bytes == 0) return Parse(std::string_view(), _layout, _nthreads);
+
+    ::madvise(addr, bytes, MADV_SEQUENTIAL);
+
+    data = Parse(std::string_view(static_cast<const char*>(addr), bytes), _layout, _nthreads);
+
+    ::munmap(addr, bytes);
+
+    return data;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "Dataset Dataset :: Parse (std::string_view, const Layout&, const UInt&)"
+Dataset
+Dataset :: Parse    (   std::string_view    _text
+                    ,   const Layout&       _layout
+                    ,   const UInt&         _nthreads
+                    )
+{
+
+IST_TRACE("Dataset::Parse", "io");
+
+Dataset     data;
+
+    try {
+
+        if (_layout.ce.index < 0 || _layout.qe.index < 0) throw
+                IsoException    (   IST_LOC
+                                ,   data.className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Linhas de cabecalho
+
+    for (UInt k = 0; k < _layout.skip && !_text.empty(); ++k) {
+
+    const size_t    eol (_text.find('\n'));
+
+        _text.remove_prefix(eol == std::string_view::npos ? _text.size() : eol + 1);
+    }
+
+//  Blocos de pelo menos MINBLOCK bytes, cada um iniciado no comeco de uma
+//  linha
+
+const size_t            nblock (std::max<size_t>(1, std::min<size_t>(NumberThreads(_nthreads), _text.size() / MINBLOCK)));
+std::vector < size_t >  bound (nblock + 1, _text.size());
+
+    bound[0] = 0;
+
+    for (size_t b = 1; b < nblock; ++b) {
+
+    const size_t    eol (_text.find('\n', std::max(bound[b - 1], b * (_text.size() / nblock))));
+
+        bound[b] = eol == std::string_view::npos ? _text.size() : eol + 1;
+    }
+
+std::vector < Dataset >         part (nblock);
+std::vector < std::string >     bad (nblock);
+std::vector < char >            valid (nblock, true);
+
+    ParallelFor (   nblock
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+                        for (size_t b = _ini; b < _fim; ++b)
+                            valid[b] = part[b].ParseBlock(_text.substr(bound[b], bound[b + 1] - bound[b]), _layout, bad[b]);
+                    }
+                ,   _nthreads
+                );
+
+    try {
+
+        for (size_t b = 0; b < nblock; ++b) if (!valid[b]) throw
+                IsoException    (   IST_LOC
+                                ,   data.className()
+                                ,   BadFile
+                                ,   bad[b]
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    data = std::move(part.front());
+
+    for (size_t b = 1; b < nblock; ++b) data.Append(part[b]);
+
+    data.Sort();
+
+    return data;
+
+}
+
+bool
+Dataset :: ParseBlock   (   std::string_view    _text
+                        ,   const Layout&       _layout
+                        ,   std::string&        _bad
+                        )
+{
+
+const Column*   column[NSLOT] { &_layout.ce
+                              , &_layout.qe
+                              , &_layout.temperature
+                              , &_layout.weight
+                              , &_layout.series
+                              };
+const bool      spaces (_layout.delimiter == ' ');
+
+//  Grandeza associada a cada coluna do arquivo
+
+int             ncol (0);
+
+    for (const auto col : column) ncol = std::max(ncol, col->index + 1);
+
+std::vector < int > slot (ncol, -1);
+
+    for (int s = 0; s < NSLOT; ++s) if (column[s]->index >= 0) slot[column[s]->index] = s;
+
+const int       nread (std::count_if(slot.begin(), slot.end(), [](const int& _s) {return _s >= 0;}));
+
+const size_t    nline (std::count(_text.begin(), _text.end(), '\n') + 1);
+
+    ce.reserve(nline);
+    qe.reserve(nline);
+    temperature.reserve(nline);
+    weight.reserve(nline);
+    series.reserve(nline);
+
+const char*     ptr (_text.data());
+const char*     end (_text.data() + _text.size());
+
+    while (ptr < end) {
+
+    const char*     eol (static_cast<const char*>(std::memchr(ptr, '\n', end - ptr)));
+    const char*     next (eol == nullptr ? end : eol + 1);
+    const char*     lend (eol == nullptr ? end : eol);
+
+        if (lend > ptr && *(lend - 1) == '\r') --lend;
+
+    const char*     pos (ptr);
+
+        while (pos < lend && IsBlank(*pos)) ++pos;
+
+        if (pos == lend || *pos == _layout.comment) {
+            ptr = next;
+            continue;
+        }
+
+    Real            value[NSLOT] {0.0, 0.0, 0.0, 1.0, 0.0};
+    int             found (0);
+
+        for (int col = 0; col < ncol; ++col) {
+
+        const char*     fend (pos);
+
+            if (spaces) while (fend < lend && !IsBlank(*fend)) ++fend;
+            else        while (fend < lend && *fend != _layout.delimiter) ++fend;
+
+            if (slot[col] >= 0) {
+
+            const char*     fini (pos);
+            const char*     flim (fend);
+
+                while (fini < flim && IsBlank(*fini)) ++fini;
+                while (flim > fini && IsBlank(*(flim - 1))) --flim;
+                if (fini < flim && *fini == '+') ++fini;
+
+            const auto      [last, error] (std::from_chars(fini, flim, value[slot[col]]));
+
+                if (error != std::errc() || last != flim || fini == flim) break;
+
+                ++found;
+            }
+
+            if (fend == lend) break;
+
+            pos = fend + 1;
+
+            if (spaces) while (pos < lend && IsBlank(*pos)) ++pos;
+        }
+
+        if (found != nread) {
+            _bad.assign(ptr, lend);
+            return false;
+        }
+
+        for (int s = 0; s < NSLOT; ++s) if (column[s]->index >= 0) value[s] = column[s]->scale * value[s] + column[s]->offset;
+
+        if (column[STEMP]->index < 0) value[STEMP] = column[STEMP]->offset;
+
+        ce.push_back(value[SCE]);
+        qe.push_back(value[SQE]);
+        temperature.push_back(value[STEMP]);
+        weight.push_back(value[SWEIGHT]);
+        series.push_back(value[SSERIES]);
+
+        ptr = next;
+    }
+
+    return true;
+
+}
+
+void
+Dataset :: Append (const Dataset& _other)
+{
+
+    ce.insert(ce.end(), _other.ce.begin(), _other.ce.end());
+    qe.insert(qe.end(), _other.qe.begin(), _other.qe.end());
+    temperature.insert(temperature.end(), _other.temperature.begin(), _other.temperature.end());
+    weight.insert(weight.end(), _other.weight.begin(), _other.weight.end());
+    series.insert(series.end(), _other.series.begin(), _other.series.end());
+
+}
+
+//==============================================================================
+// Grupos
+//==============================================================================
+
+void
+Dataset :: Sort ()
+{
+
+const size_t    n (ce.size());
+const auto      less    = [&](const size_t& _a, const size_t& _b) {
+                            return  series[_a] < series[_b]
+                                ||  (series[_a] == series[_b] && temperature[_a] < temperature[_b]);
+                          };
+
+//  Arquivos ja agrupados, o caso comum, nao sao reordenados
+
+bool            sorted (true);
+
+    for (size_t k = 1; k < n && sorted; ++k) sorted = !less(k, k - 1);
+
+    if (!sorted) {
+
+    std::vector < size_t >  index (n);
+    VecReal                 aux (n);
+
+        std::iota(index.begin(), index.end(), 0);
+        std::stable_sort(index.begin(), index.end(), less);
+
+        for (VecReal* vec : {&ce, &qe, &temperature, &weight, &series}) {
+            for (size_t k = 0; k < n; ++k) aux[k] = (*vec)[index[k]];
+            vec->swap(aux);
+        }
+    }
+
+    groups.clear();
+
+    for (size_t k = 0; k < n; ++k) {
+
+        if  (   groups.empty()
+            ||  series[k] != groups.back().series
+            ||  temperature[k] != groups.back().temperature
+            )   groups.push_back(Group {series[k], temperature[k], k, k});
+
+        groups.back().end = k + 1;
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
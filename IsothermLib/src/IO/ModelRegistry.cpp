@@ -0,0 +1,323 @@
+//==============================================================================
+// Name        : ModelRegistry.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Criacao de isotermas pelo ID ou pelo nome da classe
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <IO/ModelRegistry.h>
+
+//==============================================================================
+// Modelos da biblioteca
+//==============================================================================
+
+#include <Isotherm/OneParameter/Henry.h>
+#include <Isotherm/TwoParameters/DubininRadushkevich.h>
+#include <Isotherm/TwoParameters/Elovich.h>
+#include <Isotherm/TwoParameters/Freundlich.h>
+#include <Isotherm/TwoParameters/Halsey.h>
+#include <Isotherm/TwoParameters/HarkinJura.h>
+#include <Isotherm/TwoParameters/Jovanovic.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+#include <Isotherm/TwoParameters/Temkin.h>
+#include <Isotherm/ThreeParameters/BrouersSotolongo.h>
+#include <Isotherm/ThreeParameters/BrunauerEmmettTeller.h>
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>
+#include <Isotherm/ThreeParameters/FritzSchlunder.h>
+#include <Isotherm/ThreeParameters/Hill.h>
+#include <Isotherm/ThreeParameters/HillDeBoer.h>
+#include <Isotherm/ThreeParameters/HollKrich.h>
+#include <Isotherm/ThreeParameters/Jossens.h>
+#include <Isotherm/ThreeParameters/Khan.h>
+#include <Isotherm/ThreeParameters/Kiselev.h>
+#include <Isotherm/ThreeParameters/KobleCorrigan.h>
+#include <Isotherm/ThreeParameters/LangmuirFreundlich.h>
+#include <Isotherm/ThreeParameters/MacMillanTeller.h>
+#include <Isotherm/ThreeParameters/RadkePrausnitsI.h>
+#include <Isotherm/ThreeParameters/RadkePrausnitsII.h>
+#include <Isotherm/ThreeParameters/RadkePrausnitsIII.h>
+#include <Isotherm/ThreeParameters/RedlichPeterson.h>
+#include <Isotherm/ThreeParameters/Sips.h>
+#include <Isotherm/ThreeParameters/Toth.h>
+#include <Isotherm/ThreeParameters/Unilan.h>
+#include <Isotherm/ThreeParameters/ValenzuelaMyers.h>
+#include <Isotherm/ThreeParameters/ViethSladek.h>
+#include <Isotherm/FourParameters/Baudu.h>
+#include <Isotherm/FourParameters/FritzSchlunderIV.h>
+#include <Isotherm/FourParameters/MarczewskiJaroniec.h>
+#include <Isotherm/FourParameters/WeberVanVliet.h>
+#include <Isotherm/FiveParameters/FrenkelHalseyHill.h>
+#include <Isotherm/FiveParameters/FritzSchlunderV.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Tabela
+//==============================================================================
+
+ModelRegistry&
+ModelRegistry :: Default ()
+{
+
+static ModelRegistry    registry;
+static std::once_flag   once;
+
+    std::call_once  (   once
+                    ,   []() {
+                        registry.Register<Henry>();
+                        registry.Register<DubininRadushkevich>();
+                        registry.Register<Elovich>();
+                        registry.Register<Freundlich>();
+                        registry.Register<Halsey>();
+                        registry.Register<HarkinJura>();
+                        registry.Register<Jovanovic>();
+                        registry.Register<Langmuir>();
+                        registry.Register<Temkin>();
+                        registry.Register<BrouersSotolongo>();
+                        registry.Register<BrunauerEmmettTeller>();
+                        registry.Register<FowlerGuggenheim>();
+                        registry.Register<FritzSchlunder>();
+                        registry.Register<Hill>();
+                        registry.Register<HillDeboer>();
+                        registry.Register<HollKrich>();
+                        registry.Register<Jossens>();
+                        registry.Register<Khan>();
+                        registry.Register<Kiselev>();
+                        registry.Register<KobleCorrigan>();
+                        registry.Register<LangmuirFreundlich>();
+                        registry.Register<MacMillanTeller>();
+                        registry.Register<RadkePrausnitsI>();
+                        registry.Register<RadkePrausnitsII>();
+                        registry.Register<RadkePrausnitsIII>();
+                        registry.Register<RedlichPeterson>();
+                        registry.Register<Sips>();
+                        registry.Register<Toth>();
+                        registry.Register<Unilan>();
+                        registry.Register<ValenzuelaMyers>();
+                        registry.Register<ViethSladek>();
+                        registry.Register<Baudu>();
+                        registry.Register<FritzSchlunderIV>();
+                        registry.Register<MarczewskiJaroniec>();
+                        registry.Register<WeberVanVliet>();
+                        registry.Register<FrenkelHalseyHill>();
+                        registry.Register<FritzSchlunderV>();
+                        }
+                    );
+
+    return registry;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void ModelRegistry :: Register (const UInt&, const std::string&, Factory)"
+void
+ModelRegistry :: Register   (   const UInt&         _id
+                            ,   const std::string&  _name
+                            ,   Factory             _create
+                            )
+{
+
+    try {
+
+        if (_create == nullptr) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                ,   _name
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+const std::unique_lock  lock (mutex);
+const auto              old (byID.find(_id));
+
+    if (old != byID.end()) byName.erase(old->second.name);
+
+    byID[_id] = Entry {_id, _name, _create};
+    byName[_name] = _id;
+
+}
+
+//==============================================================================
+// Consultas
+//==============================================================================
+
+ModelRegistry::Factory
+ModelRegistry :: Find (const UInt& _id) const
+{
+
+const std::shared_lock  lock (mutex);
+const auto              entry (byID.find(_id));
+
+    return entry == byID.end() ? nullptr : entry->second.create;
+
+}
+
+ModelRegistry::Factory
+ModelRegistry :: Find (std::string_view _name) const
+{
+
+const std::shared_lock  lock (mutex);
+const auto              id (byName.find(_name));
+
+    return id == byName.end() ? nullptr : byID.at(id->second).create;
+
+}
+
+std::vector < ModelRegistry::Entry >
+ModelRegistry :: Entries () const
+{
+
+std::vector < Entry >   entries;
+
+    {
+    const std::shared_lock  lock (mutex);
+
+        entries.reserve(byID.size());
+        for (const auto& [id, entry] : byID) entries.push_back(entry);
+    }
+
+    std::sort   (   entries.begin()
+                ,   entries.end()
+                ,   [](const Entry& _a, const Entry& _b) {return _a.id < _b.id;}
+                );
+
+    return entries;
+
+}
+
+size_t
+ModelRegistry :: Size () const
+{
+
+const std::shared_lock  lock (mutex);
+
+    return byID.size();
+
+}
+
+//==============================================================================
+// Criacao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::unique_ptr<Isotherm> ModelRegistry :: Create (const UInt&, std::span<const Real>)"
+std::unique_ptr<Isotherm>
+ModelRegistry :: Create (   const UInt&             _id
+                        ,   std::span<const Real>   _par
+                        ) const
+{
+
+const Factory   create (Find(_id));
+
+    try {
+
+        if (create == nullptr) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                ,   std::to_string(_id)
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+std::unique_ptr<Isotherm>   iso (create());
+
+    SetParameters(*iso, _par);
+
+    return iso;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::unique_ptr<Isotherm> ModelRegistry :: Create (std::string_view, std::span<const Real>)"
+std::unique_ptr<Isotherm>
+ModelRegistry :: Create (   std::string_view        _name
+                        ,   std::span<const Real>   _par
+                        ) const
+{
+
+const Factory   create (Find(_name));
+
+    try {
+
+        if (create == nullptr) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                ,   std::string(_name)
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+std::unique_ptr<Isotherm>   iso (create());
+
+    SetParameters(*iso, _par);
+
+    return iso;
+
+}
+
+void
+ModelRegistry :: SetParameters  (   Isotherm&               _iso
+                                ,   std::span<const Real>   _par
+                                )
+{
+
+const size_t    ncoef (_iso.NumberConst());
+
+    if (_par.size() != ncoef + 1) {
+        _iso.SetParameters(_par);
+        return;
+    }
+
+    _iso.SetParameters(_par.first(ncoef));
+    _iso.Rgas(_par.back());
+
+}
+
+IST_NAMESPACE_CLOSE
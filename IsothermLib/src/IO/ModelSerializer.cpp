@@ -0,0 +1,597 @@
+//==============================================================================
+// Name        : ModelSerializer.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Gravacao e leitura de modelos ajustados em binario e JSON
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+//==============================================================================
+// includes POSIX
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <IO/ModelSerializer.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Formato
+//==============================================================================
+
+namespace {
+
+const char      MAGIC[8] = {'I', 'S', 'T', 'M', 'O', 'D', '0', '1'};
+
+//  Profundidade maxima dos valores JSON ignorados
+
+const int       MAXDEPTH = 64;
+
+struct Header {
+    char            magic[8];
+    std::uint64_t   count;
+};
+
+struct Record {
+    std::uint32_t   id;
+    std::uint32_t   ncoef;
+};
+
+//  Leitor JSON restrito ao necessario: objetos, vetores, textos sem
+//  conversao de escapes, numeros e literais
+
+class JsonReader {
+
+public:
+
+    explicit JsonReader (std::string_view _text) : ptr(_text.data()), end(_text.data() + _text.size()) {};
+
+    void Space ()
+    {
+        while (ptr < end && (*ptr == ' ' || *ptr == '\t' || *ptr == '\n' || *ptr == '\r')) ++ptr;
+    }
+
+    bool Peek (const char& _c)
+    {
+        Space();
+        return ptr < end && *ptr == _c;
+    }
+
+    bool Expect (const char& _c)
+    {
+        if (!Peek(_c)) return false;
+        ++ptr;
+        return true;
+    }
+
+    bool AtEnd ()
+    {
+        Space();
+        return ptr == end;
+    }
+
+    bool String (std::string_view& _str)
+    {
+        if (!Expect('"')) return false;
+
+    const char*     ini (ptr);
+
+        while (ptr < end && *ptr != '"') {
+            if (*ptr == '\\' && ptr + 1 < end) ++ptr;
+            ++ptr;
+        }
+
+        if (ptr >= end) return false;
+
+        _str = std::string_view(ini, ptr - ini);
+        ++ptr;
+        return true;
+    }
+
+    bool Number (Real& _value)
+    {
+        Space();
+
+    const auto      [last, error] (std::from_chars(ptr, end, _value));
+
+        if (error != std::errc()) return false;
+
+        ptr = last;
+        return true;
+    }
+
+    bool Skip (const int& _depth = 0)
+    {
+        if (_depth > MAXDEPTH) return false;
+
+        Space();
+
+        if (ptr >= end) return false;
+
+    std::string_view    str;
+
+        switch (*ptr) {
+
+            case '"':
+                return String(str);
+
+            case '{':
+                ++ptr;
+                if (Expect('}')) return true;
+                do {
+                    if (!String(str) || !Expect(':') || !Skip(_depth + 1)) return false;
+                } while (Expect(','));
+                return Expect('}');
+
+            case '[':
+                ++ptr;
+                if (Expect(']')) return true;
+                do {
+                    if (!Skip(_depth + 1)) return false;
+                } while (Expect(','));
+                return Expect(']');
+
+            default: {
+            const char*     ini (ptr);
+
+                while (ptr < end && (std::isalnum(static_cast<unsigned char>(*ptr)) || *ptr == '-' || *ptr == '+' || *ptr == '.')) ++ptr;
+                return ptr > ini;
+            }
+        }
+    }
+
+//  Objeto de um modelo; _coef e reutilizado entre os modelos
+
+//  A constante dos gases, se presente, e acrescentada ao final de _coef
+
+    bool Model  (   std::string_view&   _name
+                ,   Real&               _id
+                ,   bool&               _hasID
+                ,   VecReal&            _coef
+                )
+    {
+    Real    rgas;
+    bool    hasRgas (false);
+
+        _name = std::string_view();
+        _hasID = false;
+        _coef.clear();
+
+        if (!Expect('{')) return false;
+        if (Expect('}')) return true;
+
+        do {
+
+        std::string_view    key;
+
+            if (!String(key) || !Expect(':')) return false;
+
+            if (key == "model") {
+                if (!String(_name)) return false;
+            }
+            else if (key == "id") {
+                if (!Number(_id)) return false;
+                _hasID = true;
+            }
+            else if (key == "coefficients") {
+                if (!Expect('[')) return false;
+                if (!Expect(']')) {
+                    do {
+                    Real    value;
+                        if (!Number(value)) return false;
+                        _coef.push_back(value);
+                    } while (Expect(','));
+                    if (!Expect(']')) return false;
+                }
+            }
+            else if (key == "rgas") {
+                if (!Number(rgas)) return false;
+                hasRgas = true;
+            }
+            else if (!Skip()) return false;
+
+        } while (Expect(','));
+
+        if (hasRgas) _coef.push_back(rgas);
+
+        return Expect('}');
+    }
+
+//  Trecho do texto a partir da posicao atual, para a mensagem de erro
+
+    std::string Context () const
+    {
+        return ptr == end ? std::string("fim do texto") : std::string(ptr, std::min<size_t>(end - ptr, 32));
+    }
+
+private:
+
+const char*     ptr;
+const char*     end;
+
+};
+
+}
+
+//==============================================================================
+// Gravacao
+//==============================================================================
+
+std::string
+ModelSerializer :: Write    (   const Isotherm& _iso
+                            ,   const Format&   _format
+                            )
+{
+
+const Isotherm* models[] {&_iso};
+
+    return Write(models, _format);
+
+}
+
+void
+ModelSerializer :: Begin    (   std::string&    _out
+                            ,   const Format&   _format
+                            ,   const size_t&   _count
+                            )
+{
+
+    if (_format == Json) {
+        _out.reserve(2 + 80 * _count);
+        _out += "[\n";
+        return;
+    }
+
+Header      header;
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.count = _count;
+
+    _out.reserve(sizeof(Header) + (sizeof(Record) + 3 * sizeof(Real)) * _count);
+    _out.append(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+}
+
+void
+ModelSerializer :: Append   (   std::string&    _out
+                            ,   const Format&   _format
+                            ,   const Isotherm& _iso
+                            )
+{
+
+const VecReal&  coef (_iso.Coefficients());
+const Real      rgas (_iso.Rgas());
+const bool      hasRgas (rgas != Isotherm::RGASCONST);
+
+    if (_format == Binary) {
+
+    const Record    record {_iso.classID(), static_cast<std::uint32_t>(coef.size() + hasRgas)};
+
+        _out.append(reinterpret_cast<const char*>(&record), sizeof(Record));
+        _out.append(reinterpret_cast<const char*>(coef.data()), coef.size() * sizeof(Real));
+        if (hasRgas) _out.append(reinterpret_cast<const char*>(&rgas), sizeof(Real));
+        return;
+    }
+
+char        buffer[32];
+
+    _out += "{\"model\":\"";
+    _out += _iso.className();
+    _out += "\",\"id\":";
+    _out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), _iso.classID()).ptr);
+    _out += ",\"coefficients\":[";
+
+    for (size_t k = 0; k < coef.size(); ++k) {
+        if (k > 0) _out += ',';
+        _out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), coef[k]).ptr);
+    }
+
+    _out += ']';
+
+    if (hasRgas) {
+        _out += ",\"rgas\":";
+        _out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), rgas).ptr);
+    }
+
+    _out += "},\n";
+
+}
+
+void
+ModelSerializer :: End  (   std::string&    _out
+                        ,   const Format&   _format
+                        )
+{
+
+    if (_format == Binary) return;
+
+//  Virgula depois do ultimo modelo
+
+    if (_out.size() >= 2 && _out[_out.size() - 2] == ',') _out.erase(_out.size() - 2, 1);
+
+    _out += "]\n";
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void ModelSerializer :: Save (const std::string&, const std::string&)"
+void
+ModelSerializer :: Save (   const std::string&  _file
+                        ,   const std::string&  _data
+                        )
+{
+
+IST_TRACE("ModelSerializer::Save", "io");
+
+    try {
+
+    std::ofstream   out (_file, std::ios::binary | std::ios::trunc);
+
+        out.write(_data.data(), static_cast<std::streamsize>(_data.size()));
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   ModelSerializer().className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Leitura
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ModelSerializer::VecModel ModelSerializer :: Parse (std::string_view, const ModelRegistry&)"
+ModelSerializer::VecModel
+ModelSerializer :: Parse    (   std::string_view        _text
+                            ,   const ModelRegistry&    _registry
+                            )
+{
+
+IST_TRACE("ModelSerializer::Parse", "io");
+
+VecModel        models;
+VecReal         coef;
+std::string     bad;
+
+//  Ultimo modelo encontrado, para evitar consultas repetidas a tabela
+
+UInt                    lastID (0);
+ModelRegistry::Factory  lastCreate (nullptr);
+
+    if (_text.size() >= sizeof(MAGIC) && std::memcmp(_text.data(), MAGIC, sizeof(MAGIC)) == 0) {
+
+    Header      header {};
+
+        if (_text.size() < sizeof(Header)) bad = "header";
+        else {
+
+            std::memcpy(&header, _text.data(), sizeof(Header));
+            models.reserve(std::min<size_t>(header.count, _text.size() / sizeof(Record)));
+        }
+
+    size_t      pos (sizeof(Header));
+
+        for (std::uint64_t k = 0; bad.empty() && k < header.count; ++k) {
+
+        Record      record;
+
+            if (pos + sizeof(Record) > _text.size()) {
+                bad = "registro " + std::to_string(k);
+                break;
+            }
+
+            std::memcpy(&record, _text.data() + pos, sizeof(Record));
+            pos += sizeof(Record);
+
+            if (pos + record.ncoef * sizeof(Real) > _text.size()) {
+                bad = "registro " + std::to_string(k);
+                break;
+            }
+
+            if (lastCreate == nullptr || record.id != lastID) {
+                lastID = record.id;
+                lastCreate = _registry.Find(lastID);
+            }
+
+            if (lastCreate == nullptr) {
+                bad = "ID " + std::to_string(record.id);
+                break;
+            }
+
+            coef.resize(record.ncoef);
+            std::memcpy(coef.data(), _text.data() + pos, record.ncoef * sizeof(Real));
+            pos += record.ncoef * sizeof(Real);
+
+            models.push_back(lastCreate());
+            ModelRegistry::SetParameters(*models.back(), coef);
+        }
+    }
+    else {
+
+    JsonReader          reader (_text);
+    const bool          array (reader.Expect('['));
+    bool                closed (array && reader.Expect(']'));
+    std::string_view    name;
+    Real                id (0);
+    bool                hasID (false);
+    std::string_view    lastName;
+    bool                lastByID (false);
+
+        models.reserve(std::count(_text.begin(), _text.end(), '{'));
+
+        while (!closed) {
+
+            if (!reader.Model(name, id, hasID, coef)) {
+                bad = reader.Context();
+                break;
+            }
+
+            if (hasID && (id < 0 || id > std::numeric_limits<UInt>::max() || id != std::floor(id))) {
+                bad = "id " + std::to_string(id);
+                break;
+            }
+
+        const UInt      uid (hasID ? static_cast<UInt>(id) : 0);
+
+            if  (   lastCreate == nullptr
+                ||  hasID != lastByID
+                ||  (hasID ? uid != lastID : name != lastName)
+                ) {
+                lastCreate = hasID ? _registry.Find(uid) : _registry.Find(name);
+                lastByID = hasID;
+                lastID = uid;
+                lastName = name;
+            }
+
+            if (!hasID && name.empty()) {
+                bad = "modelo sem \"model\" e sem \"id\"";
+                break;
+            }
+
+            if (lastCreate == nullptr) {
+                bad = hasID ? "id " + std::to_string(uid) : std::string(name);
+                break;
+            }
+
+            models.push_back(lastCreate());
+            ModelRegistry::SetParameters(*models.back(), coef);
+
+            if (!array) break;
+
+            if (reader.Expect(']')) closed = true;
+            else if (!reader.Expect(',')) {
+                bad = reader.Context();
+                break;
+            }
+        }
+
+        if (bad.empty() && !reader.AtEnd()) bad = reader.Context();
+    }
+
+    try {
+
+        if (!bad.empty()) throw
+                IsoException    (   IST_LOC
+                                ,   ModelSerializer().className()
+                                ,   BadFile
+                                ,   bad
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return models;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "ModelSerializer::VecModel ModelSerializer :: Load (const std::string&, const ModelRegistry&)"
+ModelSerializer::VecModel
+ModelSerializer :: Load (   const std::string&      _file
+                        ,   const ModelRegistry&    _registry
+                        )
+{
+
+void*       addr (MAP_FAILED);
+size_t      bytes (0);
+
+    try {
+
+    const int       fd (::open(_file.c_str(), O_RDONLY));
+    struct stat     info;
+
+        if (fd < 0 || ::fstat(fd, &info) != 0) {
+            if (fd >= 0) ::close(fd);
+            throw   IsoException    (   IST_LOC
+                                    ,   ModelSerializer().className()
+                                    ,   BadFile
+                                    ,   _file
+                                    );
+        }
+
+        bytes = static_cast<size_t>(info.st_size);
+
+        if (bytes > 0) addr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        ::close(fd);
+
+        if (bytes > 0 && addr == MAP_FAILED) throw
+                IsoException    (   IST_LOC
+                                ,   ModelSerializer().className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (bytes == 0) return Parse(std::string_view(), _registry);
+
+    ::madvise(addr, bytes, MADV_SEQUENTIAL);
+
+VecModel    models (Parse(std::string_view(static_cast<const char*>(addr), bytes), _registry));
+
+    ::munmap(addr, bytes);
+
+    return models;
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,491 @@
+//==============================================================================
+// Name        : SweepStore.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Arquivo binario em colunas para resultados de varreduras
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+
+//==============================================================================
+// includes POSIX
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <IO/SweepStore.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+using namespace SweepFormat;
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+namespace {
+
+//  Nome com tamanho fixo, completado com zeros
+
+void WriteName  (   std::ofstream&          _out
+                ,   const std::string&      _name
+                ,   const size_t&           _size
+                )
+{
+
+std::string     name (_name.substr(0, _size));
+
+    name.resize(_size, '\0');
+    _out.write(name.data(), static_cast<std::streamsize>(_size));
+
+}
+
+std::string ReadName (const char* _ptr, const size_t& _size)
+{
+    return std::string(_ptr, strnlen(_ptr, _size));
+}
+
+}
+
+//==============================================================================
+// SweepWriter
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "SweepWriter :: SweepWriter (const std::string&, const Isotherm&, const std::vector < SweepAxis >&, const std::vector < std::string >&)"
+SweepWriter :: SweepWriter  (   const std::string&                  _file
+                            ,   const Isotherm&                     _iso
+                            ,   const std::vector < SweepAxis >&    _axes
+                            ,   const std::vector < std::string >&  _columns
+                            )
+                            :   file (_file)
+                            ,   ncol (_columns.size())
+{
+
+    try {
+
+        if (_columns.empty()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    const VecReal&  coef (_iso.Coefficients());
+    Header          head {};
+
+        std::memcpy(head.magic, MAGIC, sizeof(MAGIC));
+        head.model = _iso.classID();
+        head.ncoef = coef.size();
+        head.naxis = _axes.size();
+        head.ncol  = ncol;
+        head.bytes = sizeof(Header) + MODELSIZE + coef.size() * sizeof(Real) + ncol * NAMESIZE;
+
+        for (const auto& axis : _axes) head.bytes += sizeof(AxisHeader) + axis.values.size() * sizeof(Real);
+
+        out.open(file, std::ios::binary | std::ios::trunc);
+
+        out.write(reinterpret_cast<const char*>(&head), sizeof(Header));
+        WriteName(out, _iso.className(), MODELSIZE);
+        out.write(reinterpret_cast<const char*>(coef.data()), static_cast<std::streamsize>(coef.size() * sizeof(Real)));
+
+        for (const auto& axis : _axes) {
+
+        AxisHeader  info {};
+
+            std::memcpy(info.name, axis.name.data(), std::min(axis.name.size(), NAMESIZE));
+            info.npto = axis.values.size();
+
+            out.write(reinterpret_cast<const char*>(&info), sizeof(AxisHeader));
+            out.write(reinterpret_cast<const char*>(axis.values.data()), static_cast<std::streamsize>(axis.values.size() * sizeof(Real)));
+        }
+
+        for (const auto& name : _columns) WriteName(out, name, NAMESIZE);
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "SweepWriter :: SweepWriter (const std::string&)"
+SweepWriter :: SweepWriter (const std::string& _file)
+                           : file (_file)
+{
+
+    try {
+
+    std::ifstream   in (file, std::ios::binary);
+    Header          head {};
+
+        in.read(reinterpret_cast<char*>(&head), sizeof(Header));
+
+        if (!in || std::memcmp(head.magic, MAGIC, sizeof(MAGIC)) != 0 || head.ncol == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   file
+                                );
+
+        ncol = head.ncol;
+
+//  Um bloco incompleto no final, de uma gravacao interrompida, e descartado
+//  para que os novos blocos continuem legiveis
+
+    const size_t    bytes (std::filesystem::file_size(file));
+    size_t          pos (head.bytes);
+    ChunkHeader     chunk {};
+
+        if (pos > bytes) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   file
+                                );
+
+        while (pos + sizeof(ChunkHeader) <= bytes) {
+
+            in.seekg(static_cast<std::streamoff>(pos));
+            in.read(reinterpret_cast<char*>(&chunk), sizeof(ChunkHeader));
+
+            if  (   !in
+                ||  chunk.bytes != sizeof(ChunkHeader) + (2 + chunk.nrows) * ncol * sizeof(Real)
+                ||  pos + chunk.bytes > bytes
+                )   break;
+
+            pos += chunk.bytes;
+        }
+
+        in.close();
+
+        if (pos < bytes) std::filesystem::resize_file(file, pos);
+
+        out.open(file, std::ios::binary | std::ios::app);
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void SweepWriter :: Append (std::span<const std::span<const Real>>)"
+void
+SweepWriter :: Append (std::span<const std::span<const Real>> _columns)
+{
+
+IST_TRACE("SweepWriter::Append", "io");
+
+    try {
+
+        if (ncol == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_columns.size() != ncol) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    const size_t    nrows (_columns.front().size());
+
+        for (const auto& column : _columns) if (column.size() != nrows) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+        if (nrows == 0) return;
+
+//  Minimos e maximos de cada coluna, sem os NaN das linhas rejeitadas; uma
+//  coluna somente com NaN fica com [-inf, +inf] e o bloco nunca e descartado
+
+        stats.resize(2 * ncol);
+
+        for (size_t k = 0; k < ncol; ++k) {
+
+        const Real  inf (std::numeric_limits<Real>::infinity());
+        Real        min (inf);
+        Real        max (-inf);
+
+            for (const Real value : _columns[k]) {
+                if (std::isnan(value)) continue;
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+
+            if (min > max) {
+                min = -inf;
+                max = inf;
+            }
+
+            stats[k]        = min;
+            stats[ncol + k] = max;
+        }
+
+    const ChunkHeader   head {nrows, sizeof(ChunkHeader) + (2 + nrows) * ncol * sizeof(Real)};
+
+        out.write(reinterpret_cast<const char*>(&head), sizeof(ChunkHeader));
+        out.write(reinterpret_cast<const char*>(stats.data()), static_cast<std::streamsize>(stats.size() * sizeof(Real)));
+
+        for (const auto& column : _columns)
+            out.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(nrows * sizeof(Real)));
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+void
+SweepWriter :: Flush ()
+{
+
+    out.flush();
+
+}
+
+//==============================================================================
+// SweepReader
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "SweepReader :: SweepReader (const std::string&)"
+SweepReader :: SweepReader (const std::string& _file)
+{
+
+IST_TRACE("SweepReader", "io");
+
+void*       addr (MAP_FAILED);
+size_t      bytes (0);
+
+    try {
+
+    const int       fd (::open(_file.c_str(), O_RDONLY));
+    struct stat     info;
+
+        if (fd < 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+        if (::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(Header)) {
+            bytes = static_cast<size_t>(info.st_size);
+            addr  = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        }
+
+        ::close(fd);
+
+        if (addr == MAP_FAILED) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+        storage = std::shared_ptr<const void>   (   addr
+                                                ,   [bytes](const void* _addr) {
+                                                        ::munmap(const_cast<void*>(_addr), bytes);
+                                                    }
+                                                );
+
+    const char*     base (static_cast<const char*>(addr));
+
+        header = static_cast<const Header*>(addr);
+
+        if  (   std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0
+            ||  header->bytes > bytes
+            ||  header->bytes < sizeof(Header) + MODELSIZE + header->ncoef * sizeof(Real) + header->ncol * NAMESIZE
+            )   throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+//  Cabecalho: nome do modelo, coeficientes, eixos e colunas
+
+    size_t          pos (sizeof(Header));
+
+        model        = ReadName(base + pos, MODELSIZE);
+        pos         += MODELSIZE;
+        coefficients = std::span<const Real>(reinterpret_cast<const Real*>(base + pos), header->ncoef);
+        pos         += header->ncoef * sizeof(Real);
+
+        for (UInt k = 0; k < header->naxis; ++k) {
+
+        const AxisHeader*   info (reinterpret_cast<const AxisHeader*>(base + pos));
+        const Real*         values (reinterpret_cast<const Real*>(base + pos + sizeof(AxisHeader)));
+
+            if  (   pos + sizeof(AxisHeader) > header->bytes
+                ||  pos + sizeof(AxisHeader) + info->npto * sizeof(Real) > header->bytes
+                )   throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadFile
+                                    ,   _file
+                                    );
+
+            axes.push_back(SweepAxis {ReadName(info->name, NAMESIZE), VecReal(values, values + info->npto)});
+            pos += sizeof(AxisHeader) + info->npto * sizeof(Real);
+        }
+
+        if (pos + header->ncol * NAMESIZE > header->bytes) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+        for (UInt k = 0; k < header->ncol; ++k, pos += NAMESIZE) columns.push_back(ReadName(base + pos, NAMESIZE));
+
+        if (pos != header->bytes) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Indice dos blocos; somente os ChunkHeader sao lidos
+
+const char*     base (static_cast<const char*>(addr));
+const size_t    ncol (header->ncol);
+size_t          pos (header->bytes);
+
+    while (pos + sizeof(ChunkHeader) <= bytes) {
+
+    const ChunkHeader*  head (reinterpret_cast<const ChunkHeader*>(base + pos));
+    const Real*         stat (reinterpret_cast<const Real*>(base + pos + sizeof(ChunkHeader)));
+
+        if  (   head->bytes != sizeof(ChunkHeader) + (2 + head->nrows) * ncol * sizeof(Real)
+            ||  pos + head->bytes > bytes
+            )   break;
+
+        chunks.push_back(Chunk {head->nrows, stat, stat + ncol, stat + 2 * ncol});
+        pos += head->bytes;
+    }
+
+}
+
+size_t
+SweepReader :: NumberRows () const
+{
+
+size_t  nrows (0);
+
+    for (const auto& chunk : chunks) nrows += chunk.nrows;
+
+    return nrows;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::vector < size_t > SweepReader :: Select (const size_t&, const Real&, const Real&) const"
+std::vector < size_t >
+SweepReader :: Select   (   const size_t&   _col
+                        ,   const Real&     _lo
+                        ,   const Real&     _hi
+                        ) const
+{
+
+    try {
+
+        if (!(_col < columns.size())) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+std::vector < size_t >  index;
+
+    for (size_t k = 0; k < chunks.size(); ++k)
+        if (chunks[k].max[_col] >= _lo && chunks[k].min[_col] <= _hi) index.push_back(k);
+
+    return index;
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -111,6 +111,7 @@ FritzSchlunderV :: FritzSchlunderV  (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 }
@@ -154,4 +155,83 @@ auto    value = ( auxi / ((*(ptrValue + 1)) + auxi1) );
  
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real FritzSchlunderV :: DQDC (const Real&, const Real&) const"
+Real
+FritzSchlunderV :: DQDC (   const Real&     _ce
+                        ,   const Real&
+                        ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax Ce^a / (K1 + K2 Ce^b)
+
+auto    auxi1 = (*(ptrValue + 2)) * pow(_ce, *(ptrValue + 4));
+auto    deno  = (*(ptrValue + 1)) + auxi1;
+
+    return  (*ptrValue) * pow(_ce, expoA1)
+            * (prodAK + diffAB * auxi1) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+FritzSchlunderV :: CheckParameters (   std::span<const Real>   _par
+                                   ,   IsoExceptionIndex&      _error
+                                   ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else if (_par[3] <= 0.0) _error = BadK3LEZero;
+    else if (_par[4] <= 0.0) _error = BadK4LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+FritzSchlunderV :: Prepare ()
+{
+
+    expoA1 = Value(3) - 1.0;
+    prodAK = Value(3) * Value(1);
+    diffAB = Value(3) - Value(4);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -112,6 +112,7 @@ Baudu :: Baudu  (   const Real&     _qmax
         
     };
     
+    Prepare();
     setup = true;
 
 }
@@ -150,12 +151,92 @@ Baudu ::  Qe    (   const Real& _ce
     }
  
 auto    ptrValue = std::begin(coeffValue);
-auto    auxi  = *(ptrValue + 1) * pow(_ce, 1 -  *(ptrValue + 2) +  *(ptrValue + 3));
-auto    auxi1 = *(ptrValue + 1) * pow(_ce, 1 -  *(ptrValue + 2));
+auto    auxi  = *(ptrValue + 1) * pow(_ce, expoXY);
+auto    auxi1 = *(ptrValue + 1) * pow(_ce, expoX);
 auto    value = (*ptrValue) * auxi / (1 + auxi1);
 
     return  (value >= ZERO ? value : 0.0);
  
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Baudu :: DQDC (const Real&, const Real&) const"
+Real
+Baudu :: DQDC (   const Real&     _ce
+              ,   const Real&
+              ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+            
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce^(1 - x + y) / (1 + K1 Ce^(1 - x))
+
+auto    auxi1 = *(ptrValue + 1) * pow(_ce, expoX);
+auto    deno  = 1 + auxi1;
+
+    return  prodQK * pow(_ce, expoXY - 1)
+            * (expoXY + *(ptrValue + 3) * auxi1) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Baudu :: CheckParameters (   std::span<const Real>   _par
+                         ,   IsoExceptionIndex&      _error
+                         ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else if (_par[3] <= 0.0) _error = BadK3LEZero;
+    else if (_par[3] >= 1.0) _error = BadK3GEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Baudu :: Prepare ()
+{
+
+    expoX  = 1.0 - Value(2);
+    expoXY = expoX + Value(3);
+    prodQK = Value(0) * Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -111,6 +111,7 @@ FritzSchlunderIV :: FritzSchlunderIV    (   const Real&     _qmax
         
     };
     
+    Prepare();
     setup = true;
 
 }
@@ -155,4 +156,83 @@ auto    value = (*ptrValue) * pow(_ce, *(ptrValue + 2)) / auxi;
  
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real FritzSchlunderIV :: DQDC (const Real&, const Real&) const"
+Real
+FritzSchlunderIV :: DQDC (   const Real&     _ce
+                         ,   const Real&
+                         ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+            
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax Ce^a / (1 + K1 Ce^b)
+
+auto    auxi = *(ptrValue + 1) * pow(_ce, *(ptrValue + 3));
+auto    deno = 1 + auxi;
+
+    return  (*ptrValue) * pow(_ce, expoA1)
+            * (*(ptrValue + 2) + diffAB * auxi) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+FritzSchlunderIV :: CheckParameters (   std::span<const Real>   _par
+                                    ,   IsoExceptionIndex&      _error
+                                    ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else if (_par[3] <= 0.0) _error = BadK3LEZero;
+    else if (_par[3] > 1.0)  _error = BadK3GTOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+FritzSchlunderIV :: Prepare ()
+{
+
+    expoA1 = Value(2) - 1.0;
+    diffAB = Value(2) - Value(3);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
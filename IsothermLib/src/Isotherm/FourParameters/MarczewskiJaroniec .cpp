@@ -117,6 +117,7 @@ MarczewskiJaroniec :: MarczewskiJaroniec    (   const Real&     _qmax
         
     };
     
+    Prepare();
     setup = true;
 
 }
@@ -157,10 +158,87 @@ MarczewskiJaroniec ::  Qe    (   const Real& _ce
 auto    ptrValue = std::begin(coeffValue);
 auto    auxi  = pow(*(ptrValue + 1) * _ce, *(ptrValue + 2));
 auto    auxi1 = auxi / (1 + auxi);
-auto    value = (*ptrValue) * pow(auxi1, *(ptrValue + 3) / *(ptrValue + 2) );
+auto    value = (*ptrValue) * pow(auxi1, expoMN);
 
     return  (value >= ZERO ? value : 0.0);
  
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real MarczewskiJaroniec :: DQDC (const Real&, const Real&) const"
+Real
+MarczewskiJaroniec :: DQDC (   const Real&     _ce
+                           ,   const Real&
+                           ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+            
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax (a / (1 + a))^(m/n), a = (K1 Ce)^n
+
+auto    auxi  = pow(*(ptrValue + 1) * _ce, *(ptrValue + 2));
+auto    value = (*ptrValue) * pow(auxi / (1 + auxi), expoMN);
+
+    return *(ptrValue + 3) * value / (_ce * (1 + auxi));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+MarczewskiJaroniec :: CheckParameters (   std::span<const Real>   _par
+                                      ,   IsoExceptionIndex&      _error
+                                      ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else if (_par[3] <= 0.0) _error = BadK3LEZero;
+    else if (_par[3] >= 1.0) _error = BadK3GEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+MarczewskiJaroniec :: Prepare ()
+{
+
+    expoMN = Value(3) / Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -25,6 +25,7 @@
 // includes lib c++
 //==============================================================================
 
+#include <algorithm>                // std::max
 #include <cmath>
 #include <iostream>
 
@@ -105,6 +106,7 @@ WeberVanVliet :: WeberVanVliet  (   const Real&     _k1
         
     };
     
+    Prepare();
     setup = true;
 
 }
@@ -142,10 +144,9 @@ WeberVanVliet ::  Qe    (   const Real& _ce
         
     }
  
-    const_cast<Real&>(auxiCe) = _ce / this->K1();
-    
-auto fp    = std::bind(&WeberVanVliet::FQe, *this, _1);
-auto value = NewtonRaphson (fp, 0.5);
+const Real  auxiCe (_ce * invK1);
+auto fp    = [this, auxiCe](Real _q) {return FQe(_q, auxiCe);};
+auto value = NewtonRaphson (fp, 0.5, classID());
 
     return (value >= ZERO ? value : 0.0);
  
@@ -153,13 +154,91 @@ auto value = NewtonRaphson (fp, 0.5);
 
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  WeberVanVliet ::  FQe (const Real&) const"
+#define __FUNCT__ "Real  WeberVanVliet ::  FQe (const Real&, const Real&) const"
 Real  
-WeberVanVliet ::  FQe (const Real& _q) const {
+WeberVanVliet ::  FQe (const Real& _q, const Real& _auxiCe) const {
 
 auto    ptrValue = std::begin(coeffValue);    
 auto    auxi  =  *(ptrValue + 1) * pow(_q, *(ptrValue + 2)) + *(ptrValue + 3) ;    
-    return auxiCe - pow(_q, auxi);
+    return _auxiCe - pow(_q, auxi);
+
+}
+
+
+//==============================================================================
+// Isoterma inversa explicita
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool WeberVanVliet :: ExplicitCe (const Real&, const Real&, Real&, Real&) const"
+bool
+WeberVanVliet :: ExplicitCe (   const Real&     _qe
+                            ,   const Real&
+                            ,   Real&           _ce
+                            ,   Real&           _dcdq
+                            ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Ce = K1 q^(K2 q^K3 + K4)
+
+    if (_qe <= 0.0) {
+        _ce = _dcdq = 0.0;
+        return true;
+    }
+
+const Real  logq (std::log(_qe));
+const Real  qk3 (std::pow(_qe, K3()));
+const Real  expo (K2() * qk3 + K4());
+
+    _ce   = K1() * std::exp(expo * logq);
+    _dcdq = _ce * (expo + prodK23 * qk3 * logq) / _qe;
+
+    return true;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+WeberVanVliet :: CheckParameters (   std::span<const Real>   _par
+                                 ,   IsoExceptionIndex&      _error
+                                 ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] <= 0.0) _error = BadK2LEZero;
+    else if (_par[2] <= 0.0) _error = BadK3LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+WeberVanVliet :: Prepare ()
+{
+
+    invK1   = 1.0 / Value(0);
+    prodK23 = Value(1) * Value(2);
 
 }
 
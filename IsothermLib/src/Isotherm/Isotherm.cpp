@@ -28,13 +28,21 @@
 //==============================================================================
 
 #include <Isotherm.h>
+#include <Error/IsoException.h>
+#include <IO/CurveExport.h>
+#include <Misc/RootFinding.h>
+#include <Misc/ThreadPool.h>
+#include <Misc/Trace.h>
 
 //==============================================================================
 // include da lib c++ 
 //==============================================================================
 
+#include <algorithm>                // std::copy
+#include <cmath>                    // std::exp, std::log
 #include <iomanip>                  // std::setw
 #include <fstream>                  // std::ofstream
+#include <iostream>                 // std::cout
 #include <iterator>                 // std::ostream_iterator
 
 IST_NAMESPACE_OPEN
@@ -112,27 +120,395 @@ Isotherm ::  PlotGraph  (   const std::string&          _filename
 
 {
 
-const auto      DC((_xfim - _xinit) / (_npto - 1));
-std::ofstream   output (_filename);
-auto            ce(_xinit - DC);
-auto            xFim(_xfim - 0.5 * DC);
-Real            valorQe;
+    CurveExport(_npto, _xinit, _xfim).Write (   *this
+                                            ,   _filename
+                                            ,   _eixoX
+                                            ,   _eixoY
+                                            ,   CurveExport::Format::Text
+                                            ,   _temperature
+                                            );
 
-    output << std::scientific;
+}
+
+//==============================================================================
+// Avaliacao em bloco
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: CheckBlock (const size_t&, const size_t&) const"
+void
+Isotherm :: CheckBlock  (   const size_t&   _nce
+                        ,   const size_t&   _nqe
+                        ) const
+{
+
+    try {
+
+        if (_nce != _nqe) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+void
+Isotherm :: Qe  (   std::span<const Real>   _ce
+                ,   std::span<Real>         _qe
+                ,   const Real&             _temperature
+                ) const
+{
+
+IST_TRACE("Qe", "isotherm");
+
+    CheckBlock(_ce.size(), _qe.size());
+
+    for (size_t k = 0; k < _ce.size(); ++k) _qe[k] = Qe(_ce[k], _temperature);
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+Real
+Isotherm :: DQDC    (   const Real&     _ce
+                    ,   const Real&     _temperature
+                    ) const
+{
+
+//  Modelos implicitos com inversa explicita: dQe/dCe = 1 / (dCe/dqe) em qe(Ce)
+
+const Real  qe (Qe(_ce, _temperature));
+Real        ce (0.0);
+Real        dcdq (0.0);
+
+    if (ExplicitCe(qe, _temperature, ce, dcdq) && dcdq > 0.0 && std::isfinite(dcdq))
+        return 1.0 / dcdq;
+
+const Real  PERC (1e-06);
+
+    if (_ce > 0.0)
+    {
+        return  0.5 * ( Qe(_ce * (1 + PERC), _temperature) -
+                        Qe(_ce * (1 - PERC), _temperature))
+                / (_ce * PERC);
+    }
+
+    return  (Qe(PERC, _temperature) - qe) / PERC;
+
+}
+
+void
+Isotherm :: DQDC    (   std::span<const Real>   _ce
+                    ,   std::span<Real>         _dqdc
+                    ,   const Real&             _temperature
+                    ) const
+{
+
+IST_TRACE("DQDC", "isotherm");
+
+    CheckBlock(_ce.size(), _dqdc.size());
+
+    for (size_t k = 0; k < _ce.size(); ++k) _dqdc[k] = DQDC(_ce[k], _temperature);
+
+}
+
+//==============================================================================
+// Avaliacao em bloco com politica de execucao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: ParallelQe (std::span<const Real>, std::span<Real>, const Real&, ThreadPool*) const"
+void
+Isotherm :: ParallelQe  (   std::span<const Real>   _ce
+                        ,   std::span<Real>         _qe
+                        ,   const Real&             _temperature
+                        ,   ThreadPool*             _pool
+                        ) const
+{
+
+    CheckBlock(_ce.size(), _qe.size());
+
+const size_t    npto (_ce.size());
+ThreadPool&     pool (_pool != nullptr ? *_pool : ThreadPool::Default());
+
+    pool.Run    (   (npto + PARALLELBLOCK - 1) / PARALLELBLOCK
+                ,   [&](const size_t& _k, const UInt&) {
+
+                    const size_t    ini (_k * PARALLELBLOCK);
+                    const size_t    n (std::min(PARALLELBLOCK, npto - ini));
+
+                        Qe(_ce.subspan(ini, n), _qe.subspan(ini, n), _temperature);
+                    }
+                );
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: ParallelDQDC (std::span<const Real>, std::span<Real>, const Real&, ThreadPool*) const"
+void
+Isotherm :: ParallelDQDC    (   std::span<const Real>   _ce
+                            ,   std::span<Real>         _dqdc
+                            ,   const Real&             _temperature
+                            ,   ThreadPool*             _pool
+                            ) const
+{
+
+    CheckBlock(_ce.size(), _dqdc.size());
+
+const size_t    npto (_ce.size());
+ThreadPool&     pool (_pool != nullptr ? *_pool : ThreadPool::Default());
+
+    pool.Run    (   (npto + PARALLELBLOCK - 1) / PARALLELBLOCK
+                ,   [&](const size_t& _k, const UInt&) {
+
+                    const size_t    ini (_k * PARALLELBLOCK);
+                    const size_t    n (std::min(PARALLELBLOCK, npto - ini));
+
+                        DQDC(_ce.subspan(ini, n), _dqdc.subspan(ini, n), _temperature);
+                    }
+                );
+
+}
+
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+namespace {
+
+const Real          CETOLE      = 1.0e-14;      // tolerancia em ln(Ce)
+const UInt          CEITERMAX   = 200;          // numero maximo de iteracoes
+const Real          LNSTEP      = 2.302585092994046;   // passo ln(10) da busca do intervalo
+const Real          LNLIMIT     = 690.0;        // |ln(Ce)| maximo da busca
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: CheckQe (const Real&, const bool&) const"
+void
+Isotherm :: CheckQe (   const Real&     _qe
+                    ,   const bool&     _inRange
+                    ) const
+{
 
+    try {
 
-    do {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (!(_qe >= 0.0)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadQeLTZero
+                                );
+
+        if (!_inRange) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadQeRange
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Isotherm :: Ce (const Real&, const Real&) const"
+Real
+Isotherm :: Ce  (   const Real&     _qe
+                ,   const Real&     _temperature
+                ) const
+{
+
+IST_TRACE("BracketedNewton", "solver");
+
+    CheckQe(_qe, true);
+
+Real    ce (0.0);
+Real    dcdq (0.0);
+
+    if (ExplicitCe(_qe, _temperature, ce, dcdq)) {
+        CheckQe(_qe, std::isfinite(ce));
+        return ce;
+    }
+
+    if (_qe == 0.0) return 0.0;
+
+Real    cmin (0.0);
+Real    cmax (0.0);
+
+    CeRange(_temperature, cmin, cmax);
+
+//  Intervalo em x = ln(Ce), com Qe(exp(lo)) < _qe <= Qe(exp(hi))
+
+const Real  xmin (cmin > 0.0 ? std::log(cmin) : - LNLIMIT);
+const Real  xmax (std::isfinite(cmax) ? std::log(cmax) : LNLIMIT);
+Real        lo (xmin);
+Real        hi (xmax);
+Real        x (std::isfinite(cmax) ? xmax - LNSTEP : std::max(0.0, xmin + LNSTEP));
+
+    if (Qe(std::exp(x), _temperature) < _qe) {
+
+        do {
+            lo = x;
+            x  = std::min(x + LNSTEP, xmax);
+        } while (x < xmax && Qe(std::exp(x), _temperature) < _qe);
+
+        CheckQe(_qe, x < xmax || std::isfinite(cmax));
+
+        if (x < xmax) hi = x;
+    }
+    else {
+
+        do {
+            hi = x;
+            x  = std::max(x - LNSTEP, xmin);
+        } while (x > xmin && Qe(std::exp(x), _temperature) >= _qe);
+
+        if (x > xmin) lo = x;
+    }
+
+auto    residual = [&](const Real& _x, Real& _f, Real& _df) {
+
+        const Real  c (std::exp(_x));
+
+            _f  = Qe(c, _temperature) - _qe;
+            _df = DQDC(c, _temperature) * c;
+        };
+
+    x = 0.5 * (lo + hi);
+
+    try {
+
+        if (!BracketedNewton(residual, lo, hi, x, CETOLE, CEITERMAX, classID())) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return std::exp(x);
+
+}
+
+void
+Isotherm :: Ce  (   std::span<const Real>   _qe
+                ,   std::span<Real>         _ce
+                ,   const Real&             _temperature
+                ) const
+{
+
+IST_TRACE("Ce", "isotherm");
+
+    CheckBlock(_qe.size(), _ce.size());
+
+    for (size_t k = 0; k < _qe.size(); ++k) _ce[k] = Ce(_qe[k], _temperature);
+
+}
+
+//==============================================================================
+// Alteracao dos coeficientes
+//==============================================================================
+
+bool
+Isotherm :: TrySetParameters    (   std::span<const Real>   _par
+                                ,   IsoExceptionIndex&      _error
+                                ) noexcept
+{
+
+    if (_par.size() != coeffValue.size()) {
+        _error = BadCompositionSize;
+        return false;
+    }
+
+    if (!CheckParameters(_par, _error)) return false;
+
+    std::copy(_par.begin(), _par.end(), coeffValue.begin());
+    Prepare();
+    setup = true;
+
+    return true;
+
+}
+
+bool
+Isotherm :: TrySetParameters (std::span<const Real> _par) noexcept
+{
+
+IsoExceptionIndex   error;
+
+    return TrySetParameters(_par, error);
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: SetParameters (std::span<const Real>)"
+void
+Isotherm :: SetParameters (std::span<const Real> _par)
+{
+
+IsoExceptionIndex   error;
+
+    try {
+
+        if (!TrySetParameters(_par, error)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   error
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Isotherm :: Rgas (const Real&)"
+void
+Isotherm :: Rgas ([[maybe_unused]] const Real& _rgas)
+{
 
-        ce      += DC;
-        valorQe = Qe(ce, _temperature);
+    try {
 
-        output << std::setw(15) << _eixoX(valorQe, ce)
-               << std::setw(15) << _eixoY(valorQe, ce)
-               << std::endl;
+        throw   IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                ,   "Rgas"
+                                );
 
-    } while (ce < xFim);
+    } catch (const IsoException& _isoExcept) {
 
-    output.close();
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
 
 }
 
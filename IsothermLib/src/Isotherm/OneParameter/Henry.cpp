@@ -29,6 +29,7 @@
 // includes lib c++
 //==============================================================================
 
+#include <cmath>
 #include <iostream>
 
 //==============================================================================
@@ -113,4 +114,79 @@ Henry ::  Qe    (   const Real& _ce
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Henry :: Ce (const Real&, const Real&) const"
+Real
+Henry :: Ce (   const Real&     _qe
+            ,   const Real&     
+            ) const
+{
+
+    CheckQe(_qe, true);
+
+//  qe = K1 Ce
+
+    return _qe / K1();
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Henry :: DQDC (const Real&, const Real&) const"
+Real
+Henry :: DQDC (   const Real&     _ce
+              ,   const Real&
+              ) const
+{
+
+    try {
+
+        if (!setup) throw
+            IsoException (IST_LOC, className(), BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = K1 Ce
+
+    return *ptrValue;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Henry :: CheckParameters (   std::span<const Real>   _par
+                         ,   IsoExceptionIndex&      _error
+                         ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else return true;
+
+    return false;
+
+}
+
 IST_NAMESPACE_CLOSE
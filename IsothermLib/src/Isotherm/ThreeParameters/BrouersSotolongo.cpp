@@ -96,6 +96,7 @@ BrouersSotolongo :: BrouersSotolongo    (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 }
@@ -142,4 +143,78 @@ auto    value = *ptrValue *   (1 - auxi);
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real BrouersSotolongo :: DQDC (const Real&, const Real&) const"
+Real
+BrouersSotolongo :: DQDC (   const Real&     _ce
+                         ,   const Real&
+                         ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax (1 - exp(- K1 Ce^K2))
+
+auto    auxiK2 = pow(_ce, *(ptrValue + 2));
+auto    auxi   = exp(-((*(ptrValue + 1)) * auxiK2));
+
+    return prodQK * auxiK2 * auxi / _ce;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+BrouersSotolongo :: CheckParameters (   std::span<const Real>   _par
+                                    ,   IsoExceptionIndex&      _error
+                                    ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+BrouersSotolongo :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1) * Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -93,6 +93,7 @@ BrunauerEmmettTeller :: BrunauerEmmettTeller    (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -152,11 +153,108 @@ auto    ptrValue = std::begin(coeffValue);
     }
 
 
-auto    auxi  = 1.0 + (*(ptrValue + 1) - 1) * _ce / *(ptrValue + 2);
-auto    value = *ptrValue * (*(ptrValue + 1) * _ce / ((*(ptrValue + 2) - _ce) * auxi));
+auto    auxi  = 1.0 + slope * _ce;
+auto    value = prodQK * _ce / ((*(ptrValue + 2) - _ce) * auxi);
 
    return  (value >= ZERO ? value : 0.0);
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real BrunauerEmmettTeller :: DQDC (const Real&, const Real&) const"
+Real
+BrunauerEmmettTeller :: DQDC (   const Real&     _ce
+                             ,   const Real&
+                             ) const
+{
+
+auto    ptrValue = std::begin(coeffValue);
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+       
+       
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+       
+        if (_ce >= *(ptrValue + 2)) {
+       
+            std::stringstream sstr;
+           
+           
+            sstr    << "ce = "
+                    << _ce
+                    << " e K2 = "
+                    << *(ptrValue + 2)
+                    << "\n";
+            throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeGEK2
+                                ,   sstr.str()
+                                );
+        }  
+
+       
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  qe = qmax K1 Ce / ((K2 - Ce) (1 + (K1 - 1) Ce / K2))
+
+auto    auxiA = *(ptrValue + 2) - _ce;
+auto    auxiB = 1.0 + slope * _ce;
+auto    deno  = auxiA * auxiB;
+auto    nume  = deno + _ce * auxiB - _ce * auxiA * slope;
+
+    return prodQK * nume / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+BrunauerEmmettTeller :: CheckParameters (   std::span<const Real>   _par
+                                        ,   IsoExceptionIndex&      _error
+                                        ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] < 1.0)  _error = BadK1LTOne;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+BrunauerEmmettTeller :: Prepare ()
+{
+
+    slope  = (Value(1) - 1.0) / Value(2);
+    prodQK = Value(0) * Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -26,6 +26,8 @@
 // includes lib c++
 //==============================================================================
 
+#include <algorithm>                // std::max
+#include <limits>                   // std::numeric_limits
 #include <iostream>                     // std::cout, std::flush
 #include <cmath>
 
@@ -106,6 +108,7 @@ FowlerGuggenheim :: FowlerGuggenheim (  const Real& _qmax,
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -152,12 +155,9 @@ Real FowlerGuggenheim ::  Qe    (   const Real&     _ce
 
 
 
-    const_cast<Real&>(auxiCe) = _ce * this->K1();
-    const_cast<Real&>(tempK)  = _temp;
-
-
-auto fp    = std::bind(&FowlerGuggenheim::FQe, *this, _1);
-auto resul = NewtonRaphson (fp, 0.5);
+const Real  auxiCe (_ce * this->K1());
+auto fp    = [this, auxiCe, &_temp](Real _theta) {return FQe(_theta, auxiCe, _temp);};
+auto resul = NewtonRaphson (fp, 0.5, classID());
 auto value = resul * this->Qmax();
 
     return (value >= ZERO ? value : 0.0);
@@ -166,9 +166,9 @@ auto value = resul * this->Qmax();
 
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  FowlerGuggenheim ::  FQe (const Real&) const"
+#define __FUNCT__ "Real  FowlerGuggenheim ::  FQe (const Real&, const Real&, const Real&) const"
 Real
-FowlerGuggenheim ::  FQe (const Real& _theta) const {
+FowlerGuggenheim ::  FQe (const Real& _theta, const Real& _auxiCe, const Real& _temp) const {
    
 
         try {
@@ -193,11 +193,99 @@ FowlerGuggenheim ::  FQe (const Real& _theta) const {
         }
 
 
-Real       auxiK2 = _theta * this->K2() / (RGAS * tempK);
+Real       auxiK2 = _theta * prodKR / _temp;
 Real       auxi1  = _theta / (1 - _theta);
 Real       auxi2 = auxi1 * exp(auxiK2);
 
-    return auxiCe - auxi2;
+    return _auxiCe - auxi2;
+
+}
+
+
+//==============================================================================
+// Isoterma inversa explicita
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool FowlerGuggenheim :: ExplicitCe (const Real&, const Real&, Real&, Real&) const"
+bool
+FowlerGuggenheim :: ExplicitCe (   const Real&     _qe
+                               ,   const Real&     _temp
+                               ,   Real&           _ce
+                               ,   Real&           _dcdq
+                               ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_temp <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  K1 Ce = theta / (1 - theta) exp(K2 theta / (R T))
+
+const Real  theta (std::max(_qe, 0.0) / Qmax());
+
+    if (theta >= 1.0) {
+        _ce = _dcdq = std::numeric_limits<Real>::infinity();
+        return true;
+    }
+
+const Real  b (prodKR / _temp);
+const Real  u (theta / (1.0 - theta));
+const Real  du (1.0 / ((1.0 - theta) * (1.0 - theta)));
+const Real  expo (std::exp(b * theta));
+
+    _ce   = u * expo * invK1;
+    _dcdq = expo * (du + u * b) * invK1Q;
+
+    return true;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+FowlerGuggenheim :: CheckParameters (   std::span<const Real>   _par
+                                    ,   IsoExceptionIndex&      _error
+                                    ) const
+{
+
+    if      (_par[0] < 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] < 0.0) _error = BadK1LEZero;
+    else if (_par[2] < 0.0) _error = BadK2LTZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+FowlerGuggenheim :: Prepare ()
+{
+
+    prodKR = Value(2) / RGAS;
+    invK1  = 1.0 / Value(1);
+    invK1Q = invK1 / Value(0);
 
 }
 
@@ -87,6 +87,7 @@ FritzSchlunder :: FritzSchlunder    (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -117,7 +118,7 @@ FritzSchlunder ::  Qe (const Real& _ce, const Real&) const {
     }
 
 auto    ptrValue = std::begin(coeffValue);
-auto    auxi = (*ptrValue) * (*(ptrValue + 1)) * _ce;
+auto    auxi = prodQK * _ce;
 auto    auxiK2 = pow(_ce, *(ptrValue + 2));
 auto    auxiQ = 1 + ((*ptrValue) * auxiK2);
 
@@ -125,4 +126,74 @@ auto    auxiQ = 1 + ((*ptrValue) * auxiK2);
         return ( auxi / auxiQ );
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real FritzSchlunder :: DQDC (const Real&, const Real&) const"
+Real
+FritzSchlunder :: DQDC (   const Real&     _ce
+                       ,   const Real&
+                       ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce < 0.0)  throw
+                IsoException (IST_LOC, className(), BadCeLTZero);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout << _isoExcept << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce / (1 + qmax Ce^K2)
+
+auto    auxiK2 = (*ptrValue) * pow(_ce, *(ptrValue + 2));
+auto    auxiQ  = 1 + auxiK2;
+
+    return prodQK * (1 + compK2 * auxiK2) / (auxiQ * auxiQ);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+FritzSchlunder :: CheckParameters (   std::span<const Real>   _par
+                                  ,   IsoExceptionIndex&      _error
+                                  ) const
+{
+
+    if      (_par[0] < 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] < 0.0) _error = BadK1LEZero;
+    else if (_par[2] < 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+FritzSchlunder :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1);
+    compK2 = 1.0 - Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
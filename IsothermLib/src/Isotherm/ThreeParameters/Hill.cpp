@@ -97,6 +97,7 @@ Hill :: Hill    (   const Real& _qmax
 
     };
 
+    Prepare();
 
 }
 
@@ -134,4 +135,74 @@ auto    value       = *ptrValue * auxi / (auxi + *(ptrValue + 1));
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Hill :: DQDC (const Real&, const Real&) const"
+Real
+Hill :: DQDC (   const Real&     _ce
+             ,   const Real&
+             ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax Ce^K2 / (K1 + Ce^K2)
+
+auto    auxi = pow(_ce, *(ptrValue + 2));
+auto    deno = auxi + *(ptrValue + 1);
+
+    return prodQK * pow(_ce, expoK2) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Hill :: CheckParameters (   std::span<const Real>   _par
+                        ,   IsoExceptionIndex&      _error
+                        ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Hill :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1) * Value(2);
+    expoK2 = Value(2) - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -29,6 +29,8 @@
 // includes lib c++
 //==============================================================================
 
+#include <algorithm>                // std::max
+#include <limits>                   // std::numeric_limits
 #include <cmath>                // std::exp
 #include <iostream>             // std::cout
 
@@ -111,6 +113,7 @@ HillDeboer :: HillDeboer    (   const Real& _qmax
 
     }
 
+    Prepare();
     setup = true;
 
 
@@ -156,12 +159,10 @@ HillDeboer ::  Qe   (   const Real&     _ce
         exit(EXIT_FAILURE);
     }
 
-    const_cast<Real&>(auxiCe) = _ce * this->K1();
-    const_cast<Real&>(tempK)  = 1.0 / (_temp * Rgas());
-    
-    
-auto fp    = std::bind(&HillDeboer::FQe, *this, _1);
-auto resul = NewtonRaphson (fp, 0.95);
+const Real  auxiCe (_ce * this->K1());
+const Real  tempK (1.0 / (_temp * Rgas()));
+auto fp    = [this, auxiCe, tempK](Real _theta) {return FQe(_theta, auxiCe, tempK);};
+auto resul = NewtonRaphson (fp, 0.95, classID());
 auto value = resul * Qmax();
 
     return (value >= ZERO ? value : 0.0);
@@ -170,16 +171,103 @@ auto value = resul * Qmax();
 
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  HillDeboer ::  FQe (const Real&) const"
+#define __FUNCT__ "Real  HillDeboer ::  FQe (const Real&, const Real&, const Real&) const"
 Real  
-HillDeboer ::  FQe (const Real& _theta) const {
+HillDeboer ::  FQe (const Real& _theta, const Real& _auxiCe, const Real& _tempK) const {
 
 
 auto       auxi1  = _theta / (1.0 - _theta);
-auto       auxiK2 = _theta * this->K2() * tempK;
+auto       auxiK2 = _theta * this->K2() * _tempK;
 auto       auxi2  = auxi1 * exp(auxi1 - auxiK2);
 
-    return auxiCe - auxi2;
+    return _auxiCe - auxi2;
+
+}
+
+
+//==============================================================================
+// Isoterma inversa explicita
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool HillDeboer :: ExplicitCe (const Real&, const Real&, Real&, Real&) const"
+bool
+HillDeboer :: ExplicitCe (   const Real&     _qe
+                         ,   const Real&     _temp
+                         ,   Real&           _ce
+                         ,   Real&           _dcdq
+                         ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_temp <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  K1 Ce = theta / (1 - theta) exp(theta / (1 - theta) - K2 theta / (R T))
+
+const Real  theta (std::max(_qe, 0.0) / Qmax());
+
+    if (theta >= 1.0) {
+        _ce = _dcdq = std::numeric_limits<Real>::infinity();
+        return true;
+    }
+
+const Real  b (K2() / (Rgas() * _temp));
+const Real  u (theta / (1.0 - theta));
+const Real  du (1.0 / ((1.0 - theta) * (1.0 - theta)));
+const Real  expo (std::exp(u - b * theta));
+
+    _ce   = u * expo * invK1;
+    _dcdq = expo * (du + u * (du - b)) * invK1Q;
+
+    return true;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+HillDeboer :: CheckParameters (   std::span<const Real>   _par
+                              ,   IsoExceptionIndex&      _error
+                              ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] < 0.0)  _error = BadK2LTZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+HillDeboer :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    invK1Q = invK1 / Value(0);
 
 }
 
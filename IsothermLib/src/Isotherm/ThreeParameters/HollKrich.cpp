@@ -98,6 +98,7 @@ VecPairString IsothermTemplate < HollKrich >::infoIsotherm = detailsHollKrich;
 
     }
    
+    Prepare();
     setup = true;
 
 
@@ -137,4 +138,73 @@ auto    value = *ptrValue * (auxi1 / (1 + auxi1));
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real HollKrich :: DQDC (const Real&, const Real&) const"
+Real
+HollKrich :: DQDC (   const Real&     _ce
+                  ,   const Real&
+                  ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce^K2 / (1 + K1 Ce^K2)
+
+auto    auxi = 1 + *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+
+    return prodQK * pow(_ce, expoK2) / (auxi * auxi);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+HollKrich :: CheckParameters (   std::span<const Real>   _par
+                             ,   IsoExceptionIndex&      _error
+                             ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+HollKrich :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1) * Value(2);
+    expoK2 = Value(2) - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -95,6 +95,7 @@ Jossens :: Jossens  (   const Real&     _qmax
 
     }
    
+    Prepare();
     setup = true;
 
 
@@ -135,4 +136,72 @@ auto    value = *ptrValue * (_ce / auxi1);
      
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Jossens :: DQDC (const Real&, const Real&) const"
+Real
+Jossens :: DQDC (   const Real&     _ce
+                ,   const Real&
+                ) const
+{
+
+    try {
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = H Ce / (1 + F Ce^p)
+
+auto    auxi = *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+auto    deno = 1 + auxi;
+
+    return *ptrValue * (1 + compP * auxi) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Jossens :: CheckParameters (   std::span<const Real>   _par
+                           ,   IsoExceptionIndex&      _error
+                           ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Jossens :: Prepare ()
+{
+
+    compP = 1.0 - Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
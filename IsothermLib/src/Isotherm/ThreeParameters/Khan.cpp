@@ -98,6 +98,7 @@ Khan :: Khan    (   const Real&     _qmax
 
     }
    
+    Prepare();
     setup = true;
 
 
@@ -139,6 +140,77 @@ auto    value = *ptrValue * auxi;
      
 
 
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Khan :: DQDC (const Real&, const Real&) const"
+Real
+Khan :: DQDC (   const Real&     _ce
+             ,   const Real&
+             ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce / (1 + K1 Ce)^K2
+
+auto    k1c  = *(ptrValue + 1) * _ce;
+
+    return prodQK * (1 + compK2 * k1c) / pow(k1c + 1, expoK2);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Khan :: CheckParameters (   std::span<const Real>   _par
+                        ,   IsoExceptionIndex&      _error
+                        ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Khan :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1);
+    compK2 = 1.0 - Value(2);
+    expoK2 = Value(2) + 1.0;
+
 }
 
 IST_NAMESPACE_CLOSE
\ No newline at end of file
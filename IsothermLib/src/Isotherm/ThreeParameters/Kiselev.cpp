@@ -25,6 +25,8 @@
 // includes lib c++
 //==============================================================================
 
+#include <algorithm>                // std::max
+#include <limits>                   // std::numeric_limits
 #include <iostream>                     // std::cout, std::flush
 
 
@@ -102,6 +104,7 @@ Kiselev :: Kiselev  (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -142,10 +145,9 @@ Real Kiselev ::  Qe     (   const Real&     _ce
         exit(EXIT_FAILURE); 
     }
 
-    const_cast<Real&>(auxiCe) = _ce * this->K1();
-
-auto fp    = std::bind(&Kiselev::FQe, *this, _1);
-auto result = NewtonRaphson (fp, 0.5);
+const Real  auxiCe (_ce * this->K1());
+auto fp    = [this, auxiCe](Real _theta) {return FQe(_theta, auxiCe);};
+auto result = NewtonRaphson (fp, 0.5, classID());
 auto value = result * this->Qmax();
 
     return (value >= ZERO ? value : 0.0) ;
@@ -154,9 +156,9 @@ auto value = result * this->Qmax();
 
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  Kiselev ::  FQe (const Real&) const"
+#define __FUNCT__ "Real  Kiselev ::  FQe (const Real&, const Real&) const"
 Real
-Kiselev ::  FQe (const Real& _theta) const {
+Kiselev ::  FQe (const Real& _theta, const Real& _auxiCe) const {
 
 
         try {
@@ -182,7 +184,86 @@ Real       auxiK2     = 1 + _theta * this->K2();
 Real       auxiTheta  = 1 - _theta;
 Real       auxi1      = _theta / (auxiK2 * auxiTheta);
 
-    return auxiCe - auxi1;
+    return _auxiCe - auxi1;
+
+}
+
+
+//==============================================================================
+// Isoterma inversa explicita
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool Kiselev :: ExplicitCe (const Real&, const Real&, Real&, Real&) const"
+bool
+Kiselev :: ExplicitCe (   const Real&     _qe
+                      ,   const Real&
+                      ,   Real&           _ce
+                      ,   Real&           _dcdq
+                      ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  K1 Ce = theta / ((1 + K2 theta) (1 - theta))
+
+const Real  theta (std::max(_qe, 0.0) / Qmax());
+
+    if (theta >= 1.0) {
+        _ce = _dcdq = std::numeric_limits<Real>::infinity();
+        return true;
+    }
+
+const Real  den ((1.0 + K2() * theta) * (1.0 - theta));
+const Real  dden (K2() * (1.0 - theta) - (1.0 + K2() * theta));
+
+    _ce   = theta * invK1 / den;
+    _dcdq = (den - theta * dden) * invK1Q / (den * den);
+
+    return true;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Kiselev :: CheckParameters (   std::span<const Real>   _par
+                           ,   IsoExceptionIndex&      _error
+                           ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Kiselev :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    invK1Q = invK1 / Value(0);
 
 }
 
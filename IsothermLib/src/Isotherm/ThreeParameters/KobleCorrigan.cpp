@@ -99,6 +99,7 @@ KobleCorrigan :: KobleCorrigan  (   const Real&     _qmax
 
     }
     
+    Prepare();
     setup = true;
 
 
@@ -139,4 +140,73 @@ auto    value    = *ptrValue * auxi / (1 + auxi * (*(ptrValue + 1)));
          return (value >= ZERO ? value : 0.0) ;
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real KobleCorrigan :: DQDC (const Real&, const Real&) const"
+Real
+KobleCorrigan :: DQDC (   const Real&     _ce
+                      ,   const Real&
+                      ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = A Ce^n / (1 + B Ce^n)
+
+auto    auxi = 1 + *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+
+    return prodAN * pow(_ce, expoN) / (auxi * auxi);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+KobleCorrigan :: CheckParameters (   std::span<const Real>   _par
+                                 ,   IsoExceptionIndex&      _error
+                                 ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+KobleCorrigan :: Prepare ()
+{
+
+    prodAN = Value(0) * Value(2);
+    expoN  = Value(2) - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -94,6 +94,7 @@ LangmuirFreundlich :: LangmuirFreundlich    (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -141,4 +142,78 @@ auto    value = auxiQ / auxiK;
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real LangmuirFreundlich :: DQDC (const Real&, const Real&) const"
+Real
+LangmuirFreundlich :: DQDC (   const Real&     _ce
+                           ,   const Real&
+                           ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce^K2 / (1 + K1 Ce^K2)
+
+auto    auxi = 1 + *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+
+    return prodQK * pow(_ce, expoK2) / (auxi * auxi);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+LangmuirFreundlich :: CheckParameters (   std::span<const Real>   _par
+                                      ,   IsoExceptionIndex&      _error
+                                      ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] < 0.0)  _error = BadK2LTZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+LangmuirFreundlich :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1) * Value(2);
+    expoK2 = Value(2) - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -87,6 +87,7 @@ MacMillanTeller :: MacMillanTeller  (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -130,4 +131,76 @@ auto    value = *ptrValue * auxi * auxi * auxi;
     
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real MacMillanTeller :: DQDC (const Real&, const Real&) const"
+Real
+MacMillanTeller :: DQDC (   const Real&     _ce
+                        ,   const Real&
+                        ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce < 0.0)  throw
+                IsoException (IST_LOC, className(), BadCeLTZero);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout << _isoExcept << "\n";
+
+  exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax (K1 / ln(K2 / Ce))^3
+
+    if (_ce <= 0.0) return std::numeric_limits<Real>::infinity();
+
+auto    auxiL = log(*(ptrValue + 2) / _ce);
+auto    auxi  = (*(ptrValue + 1)) / auxiL;
+
+    return prodQ * auxi * auxi * auxi / (_ce * auxiL);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+MacMillanTeller :: CheckParameters (   std::span<const Real>   _par
+                                   ,   IsoExceptionIndex&      _error
+                                   ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] < 0.0)  _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+MacMillanTeller :: Prepare ()
+{
+
+    prodQ = 3.0 * Value(0);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -99,6 +99,7 @@ RadkePrausnitsII :: RadkePrausnitsII    (   const Real&     _qmax
 
     };
 
+    Prepare();
 
 }
 
@@ -130,10 +131,80 @@ RadkePrausnitsII ::  Qe     (   const Real& _ce
 
 auto    ptrValue = std::begin(coeffValue);
 auto    auxi  = 1 + *(ptrValue + 1) * pow ( _ce, *(ptrValue + 2));
-auto    value = *ptrValue * *(ptrValue + 1) * _ce /auxi;
+auto    value = prodQK * _ce / auxi;
 
          return (value >= ZERO ? value : 0.0) ;
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real RadkePrausnitsII :: DQDC (const Real&, const Real&) const"
+Real
+RadkePrausnitsII :: DQDC (   const Real&     _ce
+                         ,   const Real&
+                         ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce / (1 + K1 Ce^K2)
+
+auto    auxi = *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+auto    deno = 1 + auxi;
+
+    return prodQK * (1 + compK2 * auxi) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+RadkePrausnitsII :: CheckParameters (   std::span<const Real>   _par
+                                    ,   IsoExceptionIndex&      _error
+                                    ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+RadkePrausnitsII :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1);
+    compK2 = 1.0 - Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -95,6 +95,8 @@ RadkePrausnitsIII :: RadkePrausnitsIII  (   const Real&     _qmax
         exit(EXIT_FAILURE);
     };
 
+    Prepare();
+
 }
 
 //==============================================================================
@@ -128,4 +130,72 @@ return (value >= ZERO ? value : 0.0) ;
         
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real RadkePrausnitsIII :: DQDC (const Real&, const Real&) const"
+Real
+RadkePrausnitsIII :: DQDC (   const Real&     _ce
+                          ,   const Real&
+                          ) const
+{
+
+    try {
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce^K2 / (1 + K1 Ce^(K2 - 1))
+
+auto    auxi = *(ptrValue + 1) * pow(_ce, expoK2);
+
+    return *ptrValue * auxi * (*(ptrValue + 2) + auxi) / ((1 + auxi) * (1 + auxi));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+RadkePrausnitsIII :: CheckParameters (   std::span<const Real>   _par
+                                     ,   IsoExceptionIndex&      _error
+                                     ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 1.0) _error = BadK2LEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+RadkePrausnitsIII :: Prepare ()
+{
+
+    expoK2 = Value(2) - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -103,6 +103,7 @@ RedlichPeterson :: RedlichPeterson  (   const Real&     _k1
 
     };
 
+    Prepare();
     setup = true;
 
 
@@ -146,4 +147,79 @@ auto    value = (*ptrValue * _ce) / (1 + *(ptrValue + 1) * (pow(_ce, *(ptrValue
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real RedlichPeterson :: DQDC (const Real&, const Real&) const"
+Real
+RedlichPeterson :: DQDC (   const Real&     _ce
+                        ,   const Real&
+                        ) const
+{
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = K1 Ce / (1 + K2 Ce^K3)
+
+auto    auxi = *(ptrValue + 1) * pow(_ce, *(ptrValue + 2));
+auto    deno = 1 + auxi;
+
+    return *ptrValue * (1 + compK3 * auxi) / (deno * deno);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+RedlichPeterson :: CheckParameters (   std::span<const Real>   _par
+                                   ,   IsoExceptionIndex&      _error
+                                   ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] <= 0.0) _error = BadK2LEZero;
+    else if (_par[2] <= 0.0) _error = BadK3LTZero;
+    else if (_par[2] >= 1.0) _error = BadK3GEOne;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+RedlichPeterson :: Prepare ()
+{
+
+    compK3 = 1.0 - Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
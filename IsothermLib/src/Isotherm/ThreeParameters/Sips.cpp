@@ -96,6 +96,7 @@ Sips :: Sips    (   const Real& _qmax
         exit(EXIT_FAILURE);
 
     }
+    Prepare();
     setup = true;
 
 
@@ -135,7 +136,7 @@ Sips ::  Qe     (   const Real&     _ce
 
 
 auto    ptrValue = std::begin(coeffValue);
-auto    auxi  = pow(*(ptrValue + 1) * _ce, 1.0 / *(ptrValue + 2));
+auto    auxi  = pow(*(ptrValue + 1) * _ce, invK2);
 auto    value = *ptrValue * (auxi / (1.0 + auxi));
 
 
@@ -144,4 +145,98 @@ auto    value = *ptrValue * (auxi / (1.0 + auxi));
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Sips :: Ce (const Real&, const Real&) const"
+Real
+Sips :: Ce (   const Real&     _qe
+           ,   const Real&     
+           ) const
+{
+
+    CheckQe(_qe, _qe < Qmax());
+
+//  qe = qmax a / (1 + a), a = (K1 Ce)^(1/K2)
+
+    return std::pow(_qe / (Qmax() - _qe), K2()) * invK1;
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Sips :: DQDC (const Real&, const Real&) const"
+Real
+Sips :: DQDC (   const Real&     _ce
+             ,   const Real&
+             ) const
+{
+
+        try {
+
+            if (!setup) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient);
+
+            if (_ce <= 0.0)  throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCeLEZero);
+
+        } catch (const IsoException& _isoExcept) {
+
+            std::cout   << _isoExcept
+                        << "\n";
+            exit(EXIT_FAILURE);
+        }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax a / (1 + a), a = (K1 Ce)^(1/K2)
+
+auto    auxi  = pow(*(ptrValue + 1) * _ce, invK2);
+
+    return prodQ * auxi / (_ce * (1.0 + auxi) * (1.0 + auxi));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Sips :: CheckParameters (   std::span<const Real>   _par
+                        ,   IsoExceptionIndex&      _error
+                        ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Sips :: Prepare ()
+{
+
+    invK1 = 1.0 / Value(1);
+    invK2 = 1.0 / Value(2);
+    prodQ = Value(0) * invK2;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -97,6 +97,7 @@ Toth :: Toth    (   const Real&     _qmax
         exit(EXIT_FAILURE);
 
     }
+    Prepare();
     setup = true;
 
 
@@ -129,11 +130,82 @@ Toth ::  Qe     (   const Real&     _ce
     }
 
 auto    ptrValue = std::begin(coeffValue);
-auto    auxi = pow((1. / *(ptrValue + 1)) + (pow (_ce, *(ptrValue + 2) )) , 1. / * (ptrValue + 2));
+auto    auxi = pow(invK1 + pow(_ce, *(ptrValue + 2)), invK2);
 auto    value = *ptrValue * _ce / auxi;
 
     return (value >= ZERO ? value : 0.0)  ;
 
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Toth :: DQDC (const Real&, const Real&) const"
+Real
+Toth :: DQDC (   const Real&     _ce
+             ,   const Real&
+             ) const
+{
+
+    try {
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                , BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax Ce / (1/K1 + Ce^K2)^(1/K2)
+
+auto    auxi = invK1 + pow(_ce, *(ptrValue + 2));
+
+    return prodQ * pow(auxi, expoD);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Toth :: CheckParameters (   std::span<const Real>   _par
+                        ,   IsoExceptionIndex&      _error
+                        ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Toth :: Prepare ()
+{
+
+    invK1 = 1.0 / Value(1);
+    invK2 = 1.0 / Value(2);
+    prodQ = Value(0) * invK1;
+    expoD = - invK2 - 1.0;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -98,12 +98,8 @@ Unilan :: Unilan    (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
-    
-auto    val = exp(_k2);
-        nume = _k1 * val;
-        deno = _k1 / val;
-        prod = 0.5 * _qmax / _k2;
 
 
 }
@@ -143,4 +139,73 @@ auto    value = prod * log ((1 + _ce * nume) / (1 + _ce * deno));
     
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Unilan :: DQDC (const Real&, const Real&) const"
+Real
+Unilan :: DQDC (   const Real&     _ce
+               ,   const Real&
+               ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce < 0.0)  throw
+                IsoException (IST_LOC, className(), BadCeLTZero);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+       exit(EXIT_FAILURE);;
+    }
+
+//  qe = qmax / (2 K2) ln((1 + K1 e^K2 Ce) / (1 + K1 e^-K2 Ce))
+
+    return prod * (nume / (1 + _ce * nume) - deno / (1 + _ce * deno));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Unilan :: CheckParameters (   std::span<const Real>   _par
+                          ,   IsoExceptionIndex&      _error
+                          ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Unilan :: Prepare ()
+{
+
+const Real  val (exp(Value(2)));
+
+    nume = Value(1) * val;
+    deno = Value(1) / val;
+    prod = 0.5 * Value(0) / Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -95,11 +95,8 @@ ValenzuelaMyers :: ValenzuelaMyers  (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
-
-    nume = exp(_k2);
-    deno = 1.0 / nume;
-    prod = 0.5 * _qmax / _k2;
 }
 
 //==============================================================================
@@ -138,4 +135,76 @@ auto    value = prod * log ((*(ptrValue + 1) + _ce * nume) / (*(ptrValue + 1) +
     return (value >= ZERO ? value : 0.0)  ;
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real ValenzuelaMyers :: DQDC (const Real&, const Real&) const"
+Real
+ValenzuelaMyers :: DQDC (   const Real&     _ce
+                        ,   const Real&
+                        ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax / (2 K2) ln((K1 + e^K2 Ce) / (K1 + e^-K2 Ce))
+
+    return prod * (nume / (*(ptrValue + 1) + _ce * nume) - deno / (*(ptrValue + 1) + _ce * deno));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+ValenzuelaMyers :: CheckParameters (   std::span<const Real>   _par
+                                   ,   IsoExceptionIndex&      _error
+                                   ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+ValenzuelaMyers :: Prepare ()
+{
+
+    nume = exp(Value(2));
+    deno = 1.0 / nume;
+    prod = 0.5 * Value(0) / Value(2);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
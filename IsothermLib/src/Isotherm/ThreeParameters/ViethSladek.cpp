@@ -71,6 +71,7 @@ ViethSladek :: ViethSladek  (   const Real&     _qmax
 
     };
 
+    Prepare();
     setup = true;
 
 }
@@ -108,11 +109,84 @@ ViethSladek ::  Qe  (   const Real& _ce
 
 auto    ptrValue = std::begin(coeffValue);
 
-auto    auxiq = ((*ptrValue) * (*(ptrValue + 1)) * _ce);
+auto    auxiq = prodQK * _ce;
 auto    auxik = (1 + ((*(ptrValue + 1)) * _ce));
 auto    value = ((*(ptrValue + 2)) * _ce) + auxiq / auxik;
 
     return (value >= ZERO ? value : 0.0)  ;
 }
 
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real ViethSladek :: DQDC (const Real&, const Real&) const"
+Real
+ViethSladek :: DQDC (   const Real&     _ce
+                    ,   const Real&
+                    ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = K2 Ce + qmax K1 Ce / (1 + K1 Ce)
+
+auto    auxik = 1 + (*(ptrValue + 1)) * _ce;
+
+    return (*(ptrValue + 2)) + prodQK / (auxik * auxik);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+ViethSladek :: CheckParameters (   std::span<const Real>   _par
+                               ,   IsoExceptionIndex&      _error
+                               ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[2] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+ViethSladek :: Prepare ()
+{
+
+    prodQK = Value(0) * Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
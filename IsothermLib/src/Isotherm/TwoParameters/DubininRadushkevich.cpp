@@ -98,6 +98,7 @@ DubininRadushkevich :: DubininRadushkevich  (   const Real&         _qmax
         exit(EXIT_FAILURE);
  }
 
+    Prepare();
     setup = true;
 
 }
@@ -152,4 +153,124 @@ auto    value       = *ptrValue * exp( - (*(ptrValue + 1) * eps * eps));
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real DubininRadushkevich :: Ce (const Real&, const Real&) const"
+Real
+DubininRadushkevich :: Ce (   const Real&     _qe
+                          ,   const Real&     _temp
+                          ) const
+{
+
+    CheckQe(_qe, _qe < Qmax());
+
+    try {
+
+        if (_temp <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  qe = qmax exp(- K1 eps^2), eps = R T ln(1 + 1/Ce)
+
+    return 1.0 / std::expm1(std::sqrt(std::log(Qmax() / _qe) * invK1) / (RGAS * _temp));
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real DubininRadushkevich :: DQDC (const Real&, const Real&) const"
+Real
+DubininRadushkevich :: DQDC (   const Real&     _ce
+                            ,   const Real&     _temp
+                            ) const
+{
+
+    try {
+
+        if (!setup) {
+            throw IsoException  (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+        }
+
+        if (_ce <= 0.0) {
+            throw IsoException  (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+        }
+
+        if (_temp <= 0.0) {
+            throw IsoException  (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax exp(- K1 eps^2), eps = R T ln(1 + 1/Ce)
+
+auto    eps     = RGAS * _temp * log(1.0 + (1.0 / _ce));
+auto    value   = *ptrValue * exp( - (*(ptrValue + 1) * eps * eps));
+
+    return prodKR * eps * _temp * value / (_ce * (1.0 + _ce));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+DubininRadushkevich :: CheckParameters (   std::span<const Real>   _par
+                                       ,   IsoExceptionIndex&      _error
+                                       ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+DubininRadushkevich :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    prodKR = 2.0 * Value(1) * RGAS;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
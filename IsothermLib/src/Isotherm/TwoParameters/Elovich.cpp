@@ -28,6 +28,7 @@
 // includes da lib IsothermLib
 //==============================================================================
 
+#include <algorithm>                // std::max
 #include <cmath>                    // exp
 #include <iostream>                 // std::cout
 
@@ -89,6 +90,7 @@ Elovich :: Elovich  (   const Real& _qmax
 
     }
 
+    Prepare();
     setup = true;
 
 }
@@ -124,9 +126,9 @@ Elovich ::  Qe (   const Real& _ce
     }
 
 
-const_cast<Real&>(auxiCe) = _ce * this->K1();
-auto fp    = std::bind(&Elovich::FQe, *this, _1);
-auto theta = NewtonRaphson (fp, 0.5);
+const Real  auxiCe (_ce * this->K1());
+auto fp    = [this, auxiCe](Real _theta) {return FQe(_theta, auxiCe);};
+auto theta = NewtonRaphson (fp, 0.5, classID());
 auto value =  theta * Qmax();
 
     return  (value >= ZERO ? value : 0.0);
@@ -134,12 +136,83 @@ auto value =  theta * Qmax();
 }
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  Elovich ::  FQe (const Real&) const"
+#define __FUNCT__ "Real  Elovich ::  FQe (const Real&, const Real&) const"
 Real
-Elovich ::  FQe (const Real& _theta) const
+Elovich ::  FQe (const Real& _theta, const Real& _auxiCe) const
 {
 
-    return _theta - auxiCe * exp (- _theta);
+    return _theta - _auxiCe * exp (- _theta);
+
+}
+
+
+//==============================================================================
+// Isoterma inversa explicita
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool Elovich :: ExplicitCe (const Real&, const Real&, Real&, Real&) const"
+bool
+Elovich :: ExplicitCe (   const Real&     _qe
+                      ,   const Real&
+                      ,   Real&           _ce
+                      ,   Real&           _dcdq
+                      ) const
+{
+
+    try {
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient);
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  theta = K1 Ce exp(- theta)  =>  Ce = theta exp(theta) / K1
+
+const Real  theta (std::max(_qe, 0.0) / Qmax());
+const Real  expo (std::exp(theta));
+
+    _ce   = theta * expo * invK1;
+    _dcdq = expo * (1.0 + theta) * invK1Q;
+
+    return true;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Elovich :: CheckParameters (   std::span<const Real>   _par
+                           ,   IsoExceptionIndex&      _error
+                           ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Elovich :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    invK1Q = invK1 / Value(0);
 
 }
 
@@ -89,7 +89,7 @@ Freundlich :: Freundlich    (   const Real&         _k1
 
     }
 
-    invK2 = 1.0 /  _k2;
+    Prepare();
     setup = true;
 
 
@@ -148,4 +148,96 @@ auto    value    = *ptrValue * expValue ;
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Freundlich :: Ce (const Real&, const Real&) const"
+Real
+Freundlich :: Ce (   const Real&     _qe
+                 ,   const Real&     
+                 ) const
+{
+
+    CheckQe(_qe, true);
+
+//  qe = K1 Ce^(1/K2)
+
+    return std::pow(_qe / K1(), K2());
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Freundlich :: DQDC (const Real&, const Real&) const"
+Real
+Freundlich :: DQDC (   const Real&     _ce
+                   ,   const Real&
+                   ) const
+{
+
+    try {
+
+        if (!setup) throw
+            IsoException    (   IST_LOC
+                            ,   className()
+                            ,   BadCoefficient
+                            );
+
+        if (_ce < 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                , BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+       
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = K1 Ce^(1/K2)
+
+    return *ptrValue * invK2 * pow(_ce, invK2 - 1.0);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Freundlich :: CheckParameters (   std::span<const Real>   _par
+                              ,   IsoExceptionIndex&      _error
+                              ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Freundlich :: Prepare ()
+{
+
+    invK2 = 1.0 / Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -89,6 +89,7 @@ Halsey :: Halsey    (   const Real& _k1
 
     }
 
+    Prepare();
     setup = true;
 
 }
@@ -120,7 +121,7 @@ Real    value;
                                 );
 
         std::feclearexcept(FE_ALL_EXCEPT);
-        value =  pow( *ptrValue / _ce, 1.0 / *(ptrValue + 1));
+        value =  pow(*ptrValue / _ce, invK2);
 
         if(std::fetestexcept(FE_OVERFLOW)) throw
                 IsoException    (   IST_LOC
@@ -142,4 +143,99 @@ Real    value;
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Halsey :: Ce (const Real&, const Real&) const"
+Real
+Halsey :: Ce (   const Real&     _qe
+             ,   const Real&     
+             ) const
+{
+
+    CheckQe(_qe, _qe > 0.0);
+
+//  qe = (K1 / Ce)^(1/K2)
+
+    return K1() / std::pow(_qe, K2());
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Halsey :: DQDC (const Real&, const Real&) const"
+Real
+Halsey :: DQDC (   const Real&     _ce
+               ,   const Real&
+               ) const
+{
+
+    try {
+
+        if (!setup) throw
+            IsoException    (   IST_LOC
+                            ,   className()
+                            ,   BadCoefficient
+                            );
+
+        if (_ce <= 0.0)  throw
+                IsoException    (  IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = (K1 / Ce)^(1/K2)
+
+auto    value = pow(*ptrValue / _ce, invK2);
+
+    return - value * invK2 / _ce;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Halsey :: CheckParameters (   std::span<const Real>   _par
+                          ,   IsoExceptionIndex&      _error
+                          ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Halsey :: Prepare ()
+{
+
+    invK2 = 1.0 / Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -168,4 +168,87 @@ auto value = sqrt((*ptrValue) / (*(ptrValue + 1) - logCe));
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real HarkinJura :: Ce (const Real&, const Real&) const"
+Real
+HarkinJura :: Ce (   const Real&     _qe
+                 ,   const Real&     
+                 ) const
+{
+
+    CheckQe(_qe, true);
+
+//  qe^2 = K1 / (K2 - log10(Ce))
+
+    return std::pow(10.0, K2() - K1() / (_qe * _qe));
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real HarkinJura :: DQDC (const Real&, const Real&) const"
+Real
+HarkinJura :: DQDC (   const Real&     _ce
+                   ,   const Real&
+                   ) const
+{
+
+    try {
+
+        if (!setup) throw
+            IsoException    (   IST_LOC
+                            ,   className()
+                            ,   BadCoefficient
+                            );
+       
+        if (_ce <= 0.0)  throw
+            IsoException    (  IST_LOC
+                            , className()
+                            , BadCeLEZero
+                            );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = sqrt(K1 / (K2 - log10(Ce)))
+
+auto    auxi  = *(ptrValue + 1) - log10(_ce);
+auto    value = sqrt(*ptrValue / auxi);
+
+    return value / (2.0 * auxi * _ce * log(10.0));
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+HarkinJura :: CheckParameters (   std::span<const Real>   _par
+                              ,   IsoExceptionIndex&      _error
+                              ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] < 0.0)  _error = BadK2LTZero;
+    else return true;
+
+    return false;
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
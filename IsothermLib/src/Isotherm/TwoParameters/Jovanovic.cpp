@@ -29,6 +29,7 @@
 //==============================================================================
 
 #include<cmath>             // exp
+#include <cmath>
 #include <iostream>         // std::cout
 
 //==============================================================================
@@ -90,6 +91,7 @@ Jovanovic :: Jovanovic  (   const Real&     _qmax
 
     }
 
+    Prepare();
     setup = true;
 
 }
@@ -134,4 +136,97 @@ auto    value    = *(ptrValue) * exp(- *(ptrValue + 1) * _ce) ;
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Jovanovic :: Ce (const Real&, const Real&) const"
+Real
+Jovanovic :: Ce (   const Real&     _qe
+                ,   const Real&     
+                ) const
+{
+
+    CheckQe(_qe, _qe > 0.0 && _qe <= Qmax());
+
+//  qe = qmax exp(- K1 Ce)
+
+    return std::log(Qmax() / _qe) * invK1;
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Jovanovic :: DQDC (const Real&, const Real&) const"
+Real
+Jovanovic :: DQDC (   const Real&     _ce
+                  ,   const Real&
+                  ) const
+{
+
+    try {
+
+        if (!setup) throw
+            IsoException    (   IST_LOC
+                            ,   className()
+                            ,   BadCoefficient
+                            );
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n"
+                    << std::flush;
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax exp(- K1 Ce)
+
+    return - prodQK * exp(- *(ptrValue + 1) * _ce);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Jovanovic :: CheckParameters (   std::span<const Real>   _par
+                             ,   IsoExceptionIndex&      _error
+                             ) const
+{
+
+    if      (_par[1] <= 0.0) _error = BadK1LEZero;
+    else if (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Jovanovic :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    prodQK = Value(0) * Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
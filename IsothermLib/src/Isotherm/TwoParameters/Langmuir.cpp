@@ -27,6 +27,7 @@
 // includes lib c++
 //==============================================================================
 
+#include <cmath>
 #include <iostream>
 
 //==============================================================================
@@ -87,6 +88,7 @@ Langmuir :: Langmuir    (   const Real&     _qmax
 exit(EXIT_FAILURE);
     }
 
+    Prepare();
     setup = true;
 
     }
@@ -131,4 +133,98 @@ auto    value       = *ptrValue * auxi / (1.0 + auxi);
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Langmuir :: Ce (const Real&, const Real&) const"
+Real
+Langmuir :: Ce (   const Real&     _qe
+               ,   const Real&     
+               ) const
+{
+
+    CheckQe(_qe, _qe < Qmax());
+
+//  qe = qmax K1 Ce / (1 + K1 Ce)
+
+    return _qe * invK1 / (Qmax() - _qe);
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Langmuir :: DQDC (const Real&, const Real&) const"
+Real
+Langmuir :: DQDC (   const Real&     _ce
+                 ,   const Real&
+                 ) const
+{
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_ce <= 0.0)  throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                , BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+auto    ptrValue = std::begin(coeffValue);
+
+//  qe = qmax K1 Ce / (1 + K1 Ce)
+
+auto    auxi = 1.0 + *(ptrValue + 1) * _ce;
+
+    return prodQK / (auxi * auxi);
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Langmuir :: CheckParameters (   std::span<const Real>   _par
+                            ,   IsoExceptionIndex&      _error
+                            ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadQmaxLEZero;
+    else if (_par[1] <= 0.0) _error = BadK1LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Langmuir :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(1);
+    prodQK = Value(0) * Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
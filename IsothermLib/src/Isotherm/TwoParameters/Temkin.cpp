@@ -95,6 +95,7 @@ Temkin :: Temkin    (   const Real&     _k1
             exit(EXIT_FAILURE);
     }
 
+    Prepare();
     setup = true;
 
 
@@ -148,10 +149,130 @@ auto    ptrValue = std::begin(coeffValue);
     }
 
 auto    auxi = log(_ce * (*ptrValue));
-auto    value =  (RGAS * _temp * auxi) / (*(ptrValue + 1));
+auto    value =  prodRK * _temp * auxi;
 
     return  (value >= ZERO ? value : 0.0);
 
 }
 
+//==============================================================================
+// Isoterma inversa
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Temkin :: Ce (const Real&, const Real&) const"
+Real
+Temkin :: Ce (   const Real&     _qe
+             ,   const Real&     _temp
+             ) const
+{
+
+    CheckQe(_qe, true);
+
+    try {
+
+        if (_temp <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  qe = R T ln(K1 Ce) / K2
+
+    return std::exp(_qe / (prodRK * _temp)) * invK1;
+
+}
+
+//==============================================================================
+// Derivada dQe/dCe
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Temkin :: DQDC (const Real&, const Real&) const"
+Real
+Temkin :: DQDC (   const Real&     _ce
+               ,   const Real&     _temp
+               ) const
+{
+
+auto    ptrValue = std::begin(coeffValue);
+
+        try {
+
+            if (!setup) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+
+            if (_ce <= 0)  throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCeLEZero
+                                    );
+
+            if (_temp <= 0)  throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadTempLEZero
+                                    );
+
+            if ((_ce * (*ptrValue)) <= 1)  throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadKCeK1LEOne
+                                    );
+
+        } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+   
+    }
+
+//  qe = R T ln(K1 Ce) / K2
+
+    return prodRK * _temp / _ce;
+
+}
+
+//==============================================================================
+// Verificacao dos coeficientes
+//==============================================================================
+
+bool
+Temkin :: CheckParameters (   std::span<const Real>   _par
+                          ,   IsoExceptionIndex&      _error
+                          ) const
+{
+
+    if      (_par[0] <= 0.0) _error = BadK1LEZero;
+    else if (_par[1] <= 0.0) _error = BadK2LEZero;
+    else return true;
+
+    return false;
+
+}
+
+//==============================================================================
+// Constantes derivadas dos coeficientes
+//==============================================================================
+
+void
+Temkin :: Prepare ()
+{
+
+    invK1  = 1.0 / Value(0);
+    prodRK = RGAS / Value(1);
+
+}
+
 IST_NAMESPACE_CLOSE
\ No newline at end of file
@@ -0,0 +1,405 @@
+//==============================================================================
+// Name        : Kinetics.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe base dos modelos cineticos de adsorcao
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Kinetics/Kinetics.h>
+#include <Misc/LinearSystem.h>
+#include <Misc/Parallel.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          LAMBDA0     = 1.0e-3;       // amortecimento inicial
+const Real          LAMBDAMAX   = 1.0e+16;      // amortecimento maximo
+const Real          LAMBDAFAC   = 10.0;         // fator de ajuste do amortecimento
+
+}
+
+//==============================================================================
+// Nomes dos coeficientes
+//==============================================================================
+
+std::string
+Kinetics :: CodeString (const UInt& _ncode) const
+{
+    return (std::begin(InfoKinetics()) + _ncode)->first;
+}
+
+std::string
+Kinetics :: NameString (const UInt& _ncode) const
+{
+    return (std::begin(InfoKinetics()) + _ncode)->second;
+}
+
+//==============================================================================
+// Verificacoes
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Kinetics :: CheckTime (std::span<const Real>) const"
+void
+Kinetics :: CheckTime (std::span<const Real> _t) const
+{
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        for (const auto& t : _t)
+            if (!(t >= 0.0)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTimeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Kinetics :: CheckBlock (const size_t&, const size_t&) const"
+void
+Kinetics :: CheckBlock  (   const size_t&   _nexpected
+                        ,   const size_t&   _nsize
+                        ) const
+{
+
+    try {
+
+        if (_nexpected != _nsize) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Acoplamento com o equilibrio
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Kinetics :: Equilibrium (const Isotherm&, const Real&, const Real&)"
+void
+Kinetics :: Equilibrium (   const Isotherm&     _iso
+                        ,   const Real&         _ce
+                        ,   const Real&         _temperature
+                        )
+{
+
+UInt    index (0);
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (!EquilibriumIndex(index)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    VecReal     coeff (coeffValue);
+
+        coeff[index] = _iso.Qe(_ce, _temperature);
+
+        if (!Valid(coeff)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadQmaxLEZero
+                                );
+
+        coeffValue          = coeff;
+        fixedCoeff[index]   = true;
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Kinetics :: Fix (const UInt&, const bool&)"
+void
+Kinetics :: Fix (   const UInt&     _i
+                ,   const bool&     _fixed
+                )
+{
+
+    try {
+
+        if (_i >= fixedCoeff.size()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    fixedCoeff[_i] = _fixed;
+
+}
+
+//==============================================================================
+// Ajuste por Levenberg-Marquardt
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Kinetics :: Fit (std::span<const Real>, std::span<const Real>, const UInt&, const Real&)"
+Real
+Kinetics :: Fit (   std::span<const Real>   _t
+                ,   std::span<const Real>   _q
+                ,   const UInt&             _itermax
+                ,   const Real&             _tole
+                )
+{
+
+IST_TRACE("Fit", "fit");
+
+const size_t    np (NumberConst());
+const size_t    n (_t.size());
+std::vector < size_t >  free;
+
+    for (size_t j = 0; j < np; ++j)
+        if (!fixedCoeff[j]) free.push_back(j);
+
+    CheckBlock(n, _q.size());
+    CheckTime(_t);
+
+    try {
+
+        if (n < free.size()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+const size_t    nf (free.size());
+VecReal         model(n), residual(n), jac(n * np);
+
+auto sumSquares = [&]() {
+
+        Qt(_t, model);
+
+    Real    sse (0.0);
+
+        for (size_t k = 0; k < n; ++k) {
+            residual[k] = _q[k] - model[k];
+            sse        += residual[k] * residual[k];
+        }
+
+        return sse;
+    };
+
+Real            sse (sumSquares());
+
+    if (nf == 0) return sse;
+
+Real            lambda (LAMBDA0);
+
+    for (UInt iter = 0; iter < _itermax; ++iter) {
+
+    IST_TRACE("FitIteration", "fit");
+
+//  Equacoes normais J^T J delta = J^T r nos coeficientes livres
+
+        Jacobian(_t, jac);
+
+    std::vector < VecReal >     jtj (nf, VecReal(nf, 0.0));
+    VecReal                     jtr (nf, 0.0);
+
+        for (size_t k = 0; k < n; ++k) {
+
+        const Real*     row (&jac[k * np]);
+
+            for (size_t a = 0; a < nf; ++a) {
+
+                jtr[a] += row[free[a]] * residual[k];
+
+                for (size_t b = 0; b <= a; ++b) jtj[a][b] += row[free[a]] * row[free[b]];
+            }
+        }
+
+        for (size_t a = 0; a < nf; ++a)
+            for (size_t b = 0; b < a; ++b) jtj[b][a] = jtj[a][b];
+
+//  Amortecimento de Marquardt, escalado pela diagonal de J^T J
+
+    const VecReal   coeffOld (coeffValue);
+    bool            accepted (false);
+    Real            stepNorm (0.0);
+
+        while (lambda < LAMBDAMAX) {
+
+        std::vector < VecReal >     a (jtj);
+        VecReal                     delta (jtr);
+
+            for (size_t d = 0; d < nf; ++d) a[d][d] += lambda * std::max(jtj[d][d], 1.0e-300);
+
+            if (GaussElimination(a, delta)) {
+
+            VecReal     trial (coeffOld);
+
+                stepNorm = 0.0;
+
+                for (size_t d = 0; d < nf; ++d) {
+                    trial[free[d]] += delta[d];
+                    stepNorm = std::max(stepNorm, std::fabs(delta[d]) / std::max(std::fabs(coeffOld[free[d]]), 1.0e-300));
+                }
+
+                if (Valid(trial)) {
+
+                    coeffValue = trial;
+
+                const Real  sseNew (sumSquares());
+
+                    if (sseNew <= sse) {
+
+                    const Real  decrease (sse - sseNew);
+
+                        sse      = sseNew;
+                        lambda   = std::max(lambda / LAMBDAFAC, 1.0e-12);
+                        accepted = true;
+
+                        if (decrease <= _tole * sse || stepNorm <= _tole) return sse;
+
+                        break;
+                    }
+
+                    coeffValue = coeffOld;
+                }
+            }
+
+            lambda *= LAMBDAFAC;
+        }
+
+//  Nenhum passo reduz a soma dos quadrados: minimo local
+
+        if (!accepted) {
+            sse = sumSquares();
+            break;
+        }
+    }
+
+    return sse;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Kinetics :: Fit (std::vector < std::unique_ptr < Kinetics > >&, const std::vector < VecReal >&, const std::vector < VecReal >&, VecReal&, const UInt&)"
+void
+Kinetics :: Fit (   std::vector < std::unique_ptr < Kinetics > >&   _models
+                ,   const std::vector < VecReal >&                  _t
+                ,   const std::vector < VecReal >&                  _q
+                ,   VecReal&                                        _sse
+                ,   const UInt&                                     _nthreads
+                )
+{
+
+    try {
+
+        if (_models.size() != _t.size() || _models.size() != _q.size()) throw
+                IsoException    (   IST_LOC
+                                ,   "Kinetics"
+                                ,   BadCompositionSize
+                                );
+
+        for (const auto& model : _models)
+            if (!model) throw
+                IsoException    (   IST_LOC
+                                ,   "Kinetics"
+                                ,   BadCoefficient
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    _sse.resize(_models.size());
+
+    ParallelFor (   _models.size()
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+                        for (size_t k = _ini; k < _fim; ++k) _sse[k] = _models[k]->Fit(_t[k], _q[k]);
+                    }
+                ,   _nthreads
+                );
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,103 @@
+//==============================================================================
+// Name        : PseudoSecondOrder.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Modelo cinetico de pseudo-segunda ordem (Ho e McKay)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Kinetics/PseudoSecondOrder.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Variaveis estaticas
+//==============================================================================
+
+VecPairString       detailsPseudoSecondOrder
+    {
+        PairString  ( "Qe"
+                    , "Quantidade adsorvida no equilibrio")
+    ,   PairString  ( "K2"
+                    , "Constante de velocidade de pseudo-segunda ordem")
+    };
+
+template<>
+VecPairString KineticsTemplate < PseudoSecondOrder >::infoKinetics = detailsPseudoSecondOrder;
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "PseudoSecondOrder :: PseudoSecondOrder (const Real&, const Real&)"
+PseudoSecondOrder :: PseudoSecondOrder (   const Real&     _qe
+                                       ,   const Real&     _k2
+                                       )
+                                       :   KineticsTemplate < PseudoSecondOrder > (VecReal({_qe, _k2}))
+{
+
+    try {
+
+        if (_qe <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadQmaxLEZero
+                                );
+
+        if (_k2 <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadK2LEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    setup = true;
+
+}
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+bool
+PseudoSecondOrder :: Valid (const VecReal& _coeff) const
+{
+
+    return _coeff[0] > 0.0 && _coeff[1] > 0.0;
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -11,14 +11,18 @@
 
 #include <Misc/NewtonRaphson.h>
 #include <Error/IsoException.h>
+#include <Misc/SolverStats.h>
+#include <Misc/Trace.h>
 
 
 #undef  __FUNCT__
-#define __FUNCT__ "Real  NewtonRaphson (std::function<Real(Real)> const Real&);"
+#define __FUNCT__ "Real  NewtonRaphson (std::function<Real(Real)> const Real&, const UInt&);"
 Real  NewtonRaphson     (       NRFunction      _func
                         ,       const Real&     _ce
+                        ,       [[maybe_unused]] const UInt& _id
                         ) {
  
+IST_TRACE("NewtonRaphson", "solver");
 
 const Real  TOLE(1e-06);
 const UInt  ITERMAX(100);
@@ -37,6 +41,9 @@ UInt    iter(0);
 bool    flag1(true),
         flag2(true);
 
+    {
+IST_STATS(ist::SolverStats::Probe probe (_id);)
+
     do {
 
             fx    = _func(ce_0);
@@ -51,6 +58,9 @@ bool    flag1(true),
 
             
     } while (!(flag1 || flag2));
+
+    IST_STATS(probe.iterations = iter; probe.evaluations = 2 * iter; probe.converged = !flag2;)
+    }
     
     try {
         
@@ -0,0 +1,390 @@
+//==============================================================================
+// Name        : SolverStats.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Contadores de chamadas, iteracoes, falhas e tempo dos
+//               metodos iterativos, por modelo
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Misc/SolverStats.h>
+#include <IO/ModelRegistry.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Areas de cada thread
+//==============================================================================
+
+namespace {
+
+//  Contadores de um modelo em uma thread. So a propria thread escreve; as
+//  operacoes atomicas relaxadas permitem que Snapshot leia sem bloquear a
+//  thread.
+struct Slot {
+
+    explicit Slot (const UInt& _id) : id(_id) {}
+
+    void Add (const SolverStats::Counters& _value) {
+        calls.fetch_add(_value.calls, std::memory_order_relaxed);
+        iterations.fetch_add(_value.iterations, std::memory_order_relaxed);
+        failures.fetch_add(_value.failures, std::memory_order_relaxed);
+        evaluations.fetch_add(_value.evaluations, std::memory_order_relaxed);
+        cycles.fetch_add(_value.cycles, std::memory_order_relaxed);
+        if (_value.maxIterations > maxIterations.load(std::memory_order_relaxed))
+            maxIterations.store(_value.maxIterations, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] SolverStats::Counters Load () const {
+
+    SolverStats::Counters   value;
+
+        value.calls         = calls.load(std::memory_order_relaxed);
+        value.iterations    = iterations.load(std::memory_order_relaxed);
+        value.maxIterations = maxIterations.load(std::memory_order_relaxed);
+        value.failures      = failures.load(std::memory_order_relaxed);
+        value.evaluations   = evaluations.load(std::memory_order_relaxed);
+        value.cycles        = cycles.load(std::memory_order_relaxed);
+
+        return value;
+    }
+
+    void Clear () {
+        calls.store(0, std::memory_order_relaxed);
+        iterations.store(0, std::memory_order_relaxed);
+        maxIterations.store(0, std::memory_order_relaxed);
+        failures.store(0, std::memory_order_relaxed);
+        evaluations.store(0, std::memory_order_relaxed);
+        cycles.store(0, std::memory_order_relaxed);
+    }
+
+const UInt                      id;
+std::atomic<std::uint64_t>      calls {0};
+std::atomic<std::uint64_t>      iterations {0};
+std::atomic<std::uint64_t>      maxIterations {0};
+std::atomic<std::uint64_t>      failures {0};
+std::atomic<std::uint64_t>      evaluations {0};
+std::atomic<std::uint64_t>      cycles {0};
+
+};
+
+struct Block;
+
+//  Areas das threads vivas e soma das areas das threads que terminaram.
+//  Nunca e destruida, para continuar valida nas destrutoras thread_local e
+//  na gravacao ao final do programa.
+struct Registry {
+std::mutex                      mutex;
+std::vector < Block* >          blocks;
+SolverStats::MapCounters        retired;
+std::atomic<bool>               timing {false};
+};
+
+Registry& Global ()
+{
+static Registry* registry (new Registry);
+
+    return *registry;
+}
+
+//  Area de uma thread. O mutex so protege a lista de modelos: e usado
+//  quando a thread encontra um modelo novo e quando outra thread percorre
+//  a lista.
+struct Block {
+
+    Block () {
+    std::lock_guard<std::mutex>     lock (Global().mutex);
+
+        Global().blocks.push_back(this);
+    }
+
+    ~Block () {
+    Registry&                       registry (Global());
+    std::lock_guard<std::mutex>     lock (registry.mutex);
+
+        for (const auto& slot : slots) registry.retired[slot->id] += slot->Load();
+
+        registry.blocks.erase(std::find(registry.blocks.begin(), registry.blocks.end(), this));
+    }
+
+    Slot& Find (const UInt& _id) {
+
+        if (last != nullptr && last->id == _id) return *last;
+
+        for (const auto& slot : slots) if (slot->id == _id) return *(last = slot.get());
+
+    std::lock_guard<std::mutex>     lock (mutex);
+
+        slots.push_back(std::make_unique<Slot>(_id));
+
+        return *(last = slots.back().get());
+    }
+
+std::mutex                              mutex;
+std::vector < std::unique_ptr<Slot> >   slots;
+Slot*                                   last = nullptr;
+
+};
+
+//  Gravacao em ISOTHERM_STATS_FILE ao final do programa
+void SaveAtExit ()
+{
+const char*     file (std::getenv("ISOTHERM_STATS_FILE"));
+
+    if (file == nullptr || *file == '\0') return;
+
+std::ofstream   out (file);
+
+    out << SolverStats::Json();
+}
+
+Block& ThreadBlock ()
+{
+static std::once_flag   once;
+thread_local Block      block;
+
+//  A tabela de modelos e criada antes de std::atexit, para ser destruida
+//  depois da gravacao, que usa os nomes dos modelos
+    std::call_once(once, []() {
+        [[maybe_unused]] const auto&    registry (ModelRegistry::Default());
+        std::atexit(SaveAtExit);
+    });
+
+    return block;
+}
+
+}   // namespace
+
+//==============================================================================
+// Counters
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "SolverStats::Counters& SolverStats::Counters::operator += (const Counters&)"
+SolverStats::Counters&
+SolverStats::Counters::operator += (const Counters& _value) {
+
+    calls           += _value.calls;
+    iterations      += _value.iterations;
+    failures        += _value.failures;
+    evaluations     += _value.evaluations;
+    cycles          += _value.cycles;
+    maxIterations    = std::max(maxIterations, _value.maxIterations);
+
+    return *this;
+}
+
+//==============================================================================
+// Registro
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void SolverStats::Timing (const bool&)"
+void
+SolverStats::Timing (const bool& _timing) {
+
+    Global().timing.store(_timing, std::memory_order_relaxed);
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool SolverStats::Timing ()"
+bool
+SolverStats::Timing () {
+
+    return Global().timing.load(std::memory_order_relaxed);
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void SolverStats::Record (const UInt&, const UInt&, const UInt&, const bool&, const std::uint64_t&)"
+void
+SolverStats::Record (   const UInt&             _id
+                    ,   const UInt&             _iter
+                    ,   const UInt&             _eval
+                    ,   const bool&             _converged
+                    ,   const std::uint64_t&    _cycles
+                    ) {
+
+Counters    value;
+
+    value.calls         = 1;
+    value.iterations    = _iter;
+    value.maxIterations = _iter;
+    value.failures      = _converged ? 0 : 1;
+    value.evaluations   = _eval;
+    value.cycles        = _cycles;
+
+    ThreadBlock().Find(_id).Add(value);
+}
+
+//==============================================================================
+// Consulta
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "SolverStats::MapCounters SolverStats::Snapshot ()"
+SolverStats::MapCounters
+SolverStats::Snapshot () {
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+MapCounters                     total (registry.retired);
+
+    for (Block* block : registry.blocks) {
+
+    std::lock_guard<std::mutex>     lockBlock (block->mutex);
+
+        for (const auto& slot : block->slots) total[slot->id] += slot->Load();
+    }
+
+    std::erase_if(total, [](const auto& _item) {return _item.second.calls == 0;});
+
+    return total;
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "SolverStats::Counters SolverStats::Get (const UInt&)"
+SolverStats::Counters
+SolverStats::Get (const UInt& _id) {
+
+const auto  total (Snapshot());
+const auto  it (total.find(_id));
+
+    return it != total.end() ? it->second : Counters();
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void SolverStats::Reset ()"
+void
+SolverStats::Reset () {
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+
+    registry.retired.clear();
+
+    for (Block* block : registry.blocks) {
+
+    std::lock_guard<std::mutex>     lockBlock (block->mutex);
+
+        for (const auto& slot : block->slots) slot->Clear();
+    }
+}
+
+//==============================================================================
+// Relatorios
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::string SolverStats::Name (const UInt&)"
+std::string
+SolverStats::Name (const UInt& _id) {
+
+    switch (_id) {
+        case ID::Isotherm           : return "Isotherm";
+        case ID::BatchEquilibrium   : return "BatchEquilibrium";
+        default                     : break;
+    }
+
+    for (const auto& entry : ModelRegistry::Default().Entries())
+        if (entry.id == _id) return entry.name;
+
+    return "ID " + std::to_string(_id);
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::string SolverStats::Text ()"
+std::string
+SolverStats::Text () {
+
+std::ostringstream  out;
+
+    out << std::left  << std::setw(28) << "Modelo"
+        << std::right << std::setw(12) << "Chamadas"
+                      << std::setw(14) << "Iteracoes"
+                      << std::setw(10) << "Media"
+                      << std::setw(8)  << "Maximo"
+                      << std::setw(10) << "Falhas"
+                      << std::setw(14) << "Avaliacoes"
+                      << std::setw(16) << "Ciclos"
+                      << "\n";
+
+    for (const auto& [id, value] : Snapshot()) {
+        out << std::left  << std::setw(28) << Name(id)
+            << std::right << std::setw(12) << value.calls
+                          << std::setw(14) << value.iterations
+                          << std::setw(10) << std::fixed << std::setprecision(2) << value.MeanIterations()
+                          << std::setw(8)  << value.maxIterations
+                          << std::setw(10) << value.failures
+                          << std::setw(14) << value.evaluations
+                          << std::setw(16) << value.cycles
+                          << "\n";
+    }
+
+    return out.str();
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::string SolverStats::Json ()"
+std::string
+SolverStats::Json () {
+
+std::ostringstream  out;
+const auto          total (Snapshot());
+size_t              n (0);
+
+    out << "{\"enabled\":" << (Enabled() ? "true" : "false")
+        << ",\"timing\":" << (Timing() ? "true" : "false")
+        << ",\"models\":[";
+
+    for (const auto& [id, value] : total) {
+        out << (n++ > 0 ? ",\n" : "\n")
+            << "{\"id\":" << id
+            << ",\"model\":\"" << Name(id) << "\""
+            << ",\"calls\":" << value.calls
+            << ",\"iterations\":" << value.iterations
+            << ",\"maxIterations\":" << value.maxIterations
+            << ",\"failures\":" << value.failures
+            << ",\"evaluations\":" << value.evaluations
+            << ",\"cycles\":" << value.cycles
+            << "}";
+    }
+
+    out << (n > 0 ? "\n]}\n" : "]}\n");
+
+    return out.str();
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,270 @@
+//==============================================================================
+// Name        : Sweep.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Avaliacao em paralelo de Qe em todas as combinacoes de
+//               grades de coeficientes, concentracoes e temperaturas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+//==============================================================================
+// includes POSIX
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/Sweep.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Sweep :: Sweep (const Isotherm&, const std::vector < VecReal >&, const VecReal&, const VecReal&)"
+Sweep :: Sweep  (   const Isotherm&                 _iso
+                ,   const std::vector < VecReal >&  _coef
+                ,   const VecReal&                  _ce
+                ,   const VecReal&                  _temperature
+                )
+                :   model (_iso.Clone())
+                ,   coef (_coef)
+                ,   ce (_ce)
+                ,   temperature (_temperature)
+{
+
+    try {
+
+        if (coef.size() != model->NumberConst()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+        if (ce.empty()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (temperature.empty()) temperature.push_back(0.0);
+
+    for (const auto& grid : coef) nset *= std::max<size_t>(grid.size(), 1);
+
+}
+
+//==============================================================================
+// Coeficientes
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Sweep :: Parameters (const size_t&, std::span<Real>) const"
+void
+Sweep :: Parameters (   const size_t&       _set
+                    ,   std::span<Real>     _par
+                    ) const
+{
+
+const VecReal&  base (model->Coefficients());
+size_t          set (_set);
+
+//  Indice de base mista, com o ultimo coeficiente variando mais rapido
+
+    for (size_t j = coef.size(); j-- > 0;) {
+
+        if (coef[j].empty()) {
+            _par[j] = base[j];
+            continue;
+        }
+
+        _par[j]  = coef[j][set % coef[j].size()];
+        set     /= coef[j].size();
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "VecReal Sweep :: Parameters (const size_t&) const"
+VecReal
+Sweep :: Parameters (const size_t& _set) const
+{
+
+VecReal     par (coef.size());
+
+    Parameters(_set, par);
+
+    return par;
+
+}
+
+//==============================================================================
+// Execucao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Sweep :: Run (std::span<Real>, ThreadPool&) const"
+void
+Sweep :: Run    (   std::span<Real>     _qe
+                ,   ThreadPool&         _pool
+                ) const
+{
+
+IST_TRACE("Sweep", "isotherm");
+
+const size_t    npto (NumberPoints());
+
+    try {
+
+        if (_qe.size() != npto) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Area de cada trabalhador, numa linha de cache propria
+
+struct alignas(64) Slot {
+    std::unique_ptr<Isotherm>   iso;
+    VecReal                     par;
+    size_t                      set = std::numeric_limits<size_t>::max();
+    bool                        valid = false;
+};
+
+std::vector < Slot >            slots (_pool.NumberWorkers());
+const size_t                    nce (ce.size());
+const size_t                    nrow (temperature.size() * nce);
+const size_t                    nblock ((npto + BLOCK - 1) / BLOCK);
+const std::span<const Real>     cespan (ce);
+
+    _pool.Run   (   nblock
+                ,   [&](const size_t& _k, const UInt& _w) {
+
+                    Slot&           slot (slots[_w]);
+                    const size_t    fim (std::min(npto, (_k + 1) * BLOCK));
+
+                        if (!slot.iso) {
+                            slot.iso = model->Clone();
+                            slot.par.resize(coef.size());
+                        }
+
+//  Trechos do bloco com conjunto de coeficientes e temperatura constantes
+
+                        for (size_t ini = _k * BLOCK; ini < fim;) {
+
+                        const size_t    set (ini / nrow);
+                        const size_t    t (ini % nrow / nce);
+                        const size_t    c (ini % nce);
+                        const size_t    len (std::min(fim - ini, nce - c));
+
+                            if (set != slot.set) {
+                                Parameters(set, slot.par);
+                                slot.valid = slot.iso->TrySetParameters(slot.par);
+                                slot.set   = set;
+                            }
+
+                            if (slot.valid)
+                                static_cast<const Isotherm&>(*slot.iso).Qe(cespan.subspan(c, len), _qe.subspan(ini, len), temperature[t]);
+                            else
+                                std::fill_n(_qe.begin() + ini, len, std::numeric_limits<Real>::quiet_NaN());
+
+                            ini += len;
+                        }
+                    }
+                );
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Sweep :: Run (const std::string&, ThreadPool&) const"
+void
+Sweep :: Run    (   const std::string&  _file
+                ,   ThreadPool&         _pool
+                ) const
+{
+
+const size_t    bytes (NumberPoints() * sizeof(Real));
+void*           addr (MAP_FAILED);
+
+    try {
+
+    const int       fd (::open(_file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+
+        if (fd < 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) == 0)
+            addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        ::close(fd);
+
+        if (addr == MAP_FAILED) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    Run(std::span<Real>(static_cast<Real*>(addr), NumberPoints()), _pool);
+
+    ::munmap(addr, bytes);
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,278 @@
+//==============================================================================
+// Name        : ThreadPool.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Conjunto de threads permanentes, com uma fila de tarefas por
+//               thread e roubo de trabalho entre as filas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Misc/Parallel.h>
+#include <Misc/ThreadPool.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Filas
+//==============================================================================
+
+//  Faixa [begin, end) de tarefas de um trabalhador. O dono retira do
+//  inicio, em ordem, e os outros roubam metade do final. Cada fila ocupa
+//  sua propria linha de cache.
+struct alignas(64) ThreadPool::Queue {
+std::mutex      mutex;
+size_t          begin = 0;
+size_t          end = 0;
+};
+
+namespace {
+
+//  true nas threads que estao executando tarefas de um lote
+thread_local bool   inside (false);
+
+}   // namespace
+
+//==============================================================================
+// Construtoras / Destrutora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ThreadPool :: ThreadPool (const UInt&)"
+ThreadPool :: ThreadPool (const UInt& _nthreads)
+{
+
+const UInt  nthreads (NumberThreads(_nthreads));
+
+    for (UInt w = 0; w < nthreads; ++w) queues.push_back(std::make_unique<Queue>());
+
+    threads.reserve(nthreads - 1);
+
+    for (UInt w = 1; w < nthreads; ++w) threads.emplace_back([this, w](){ Worker(w); });
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "ThreadPool :: ~ThreadPool ()"
+ThreadPool :: ~ThreadPool ()
+{
+
+    {
+    std::lock_guard<std::mutex>     lock (mutex);
+
+        stop = true;
+    }
+
+    start.notify_all();
+
+    for (auto& thr : threads) thr.join();
+
+}
+
+//==============================================================================
+// Execucao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void ThreadPool :: Run (const size_t&, const Task&)"
+void
+ThreadPool :: Run   (   const size_t&   _ntasks
+                    ,   const Task&     _task
+                    )
+{
+
+    if (_ntasks == 0) return;
+
+//  Lote dentro de uma tarefa, ou sem threads auxiliares: em serie
+
+    if (inside || threads.empty()) {
+        for (size_t k = 0; k < _ntasks; ++k) _task(k, 0);
+        return;
+    }
+
+std::lock_guard<std::mutex>     lockBatch (batch);
+const size_t                    nqueue (queues.size());
+const size_t                    nwork (std::min(nqueue, _ntasks));
+
+    for (size_t w = 0; w < nqueue; ++w) {
+
+    std::lock_guard<std::mutex>     lock (queues[w]->mutex);
+
+        queues[w]->begin = w < nwork ? _ntasks * w / nwork : _ntasks;
+        queues[w]->end   = w < nwork ? _ntasks * (w + 1) / nwork : _ntasks;
+    }
+
+    {
+    std::lock_guard<std::mutex>     lock (mutex);
+
+        task    = &_task;
+        error   = nullptr;
+        active  = UInt(threads.size());
+        ++generation;
+    }
+
+    start.notify_all();
+
+    inside = true;
+    Work(0);
+    inside = false;
+
+std::exception_ptr  failure;
+
+    {
+    std::unique_lock<std::mutex>    lock (mutex);
+
+        done.wait(lock, [this](){ return active == 0; });
+
+        task = nullptr;
+        std::swap(failure, error);
+    }
+
+    if (failure) std::rethrow_exception(failure);
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "ThreadPool& ThreadPool :: Default ()"
+ThreadPool&
+ThreadPool :: Default ()
+{
+
+static ThreadPool   pool;
+
+    return pool;
+
+}
+
+//==============================================================================
+// Funcoes auxiliares
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void ThreadPool :: Worker (const UInt&)"
+void
+ThreadPool :: Worker (const UInt& _w)
+{
+
+size_t      seen (0);
+
+    inside = true;
+
+    for (;;) {
+
+        {
+        std::unique_lock<std::mutex>    lock (mutex);
+
+            start.wait(lock, [this, seen](){ return stop || generation != seen; });
+
+            if (stop) return;
+
+            seen = generation;
+        }
+
+        Work(_w);
+
+        {
+        std::lock_guard<std::mutex>     lock (mutex);
+
+            if (--active == 0) done.notify_one();
+        }
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void ThreadPool :: Work (const UInt&)"
+void
+ThreadPool :: Work (const UInt& _w)
+{
+
+size_t      k (0);
+
+    while (Pop(_w, k)) {
+        try {
+            (*task)(k, _w);
+        } catch (...) {
+        std::lock_guard<std::mutex>     lock (mutex);
+
+            if (!error) error = std::current_exception();
+        }
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "bool ThreadPool :: Pop (const UInt&, size_t&)"
+bool
+ThreadPool :: Pop   (   const UInt&     _w
+                    ,   size_t&         _k
+                    )
+{
+
+Queue&          own (*queues[_w]);
+const size_t    nqueue (queues.size());
+
+    {
+    std::lock_guard<std::mutex>     lock (own.mutex);
+
+        if (own.begin < own.end) {
+            _k = own.begin++;
+            return true;
+        }
+    }
+
+//  Fila vazia: rouba a metade final da primeira fila com tarefas
+
+    for (size_t i = 1; i < nqueue; ++i) {
+
+    Queue&      victim (*queues[(_w + i) % nqueue]);
+    size_t      begin (0), end (0);
+
+        {
+        std::lock_guard<std::mutex>     lock (victim.mutex);
+
+            if (victim.begin >= victim.end) continue;
+
+            end           = victim.end;
+            begin         = end - (end - victim.begin + 1) / 2;
+            victim.end    = begin;
+        }
+
+    std::lock_guard<std::mutex>     lock (own.mutex);
+
+        own.begin = begin + 1;
+        own.end   = end;
+        _k        = begin;
+
+        return true;
+    }
+
+    return false;
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,360 @@
+//==============================================================================
+// Name        : Trace.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Zonas de rastreamento das etapas da biblioteca, gravadas no
+//               formato JSON do Chrome trace / Perfetto
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/Trace.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Areas de cada thread
+//==============================================================================
+
+namespace {
+
+//  Area circular de uma thread. Somente a propria thread escreve; count e
+//  publicado depois do evento.
+struct Buffer {
+
+    explicit Buffer (const UInt& _tid) : tid(_tid), events(Trace::CAPACITY) {}
+
+const UInt                      tid;
+std::vector < Trace::Event >    events;
+std::atomic<std::uint64_t>      count {0};
+
+};
+
+//  Todas as areas, em uso ou livres. Nunca e destruida, para continuar
+//  valida nas destrutoras thread_local e na gravacao ao final do programa.
+struct Registry {
+std::mutex                              mutex;
+std::vector < std::unique_ptr<Buffer> > buffers;
+std::vector < Buffer* >                 free;
+std::uint64_t                           epoch = 0;
+std::string                             file;
+};
+
+Registry& Global ()
+{
+static Registry* registry (new Registry);
+
+    return *registry;
+}
+
+//  Area da thread, devolvida a lista de livres quando a thread termina
+struct Holder {
+
+    ~Holder () {
+        if (buffer == nullptr) return;
+
+    std::lock_guard<std::mutex>     lock (Global().mutex);
+
+        Global().free.push_back(buffer);
+    }
+
+    Buffer& Get () {
+        if (buffer != nullptr) return *buffer;
+
+    Registry&                       registry (Global());
+    std::lock_guard<std::mutex>     lock (registry.mutex);
+
+        if (!registry.free.empty()) {
+            buffer = registry.free.back();
+            registry.free.pop_back();
+        }
+        else {
+            registry.buffers.push_back(std::make_unique<Buffer>(UInt(registry.buffers.size() + 1)));
+            buffer = registry.buffers.back().get();
+        }
+
+        return *buffer;
+    }
+
+Buffer*     buffer = nullptr;
+
+};
+
+thread_local Holder     holder;
+
+//  Grava o rastreamento em _file; false em erro de escrita
+bool Write (const std::string& _file)
+{
+std::ofstream   out (_file, std::ios::binary | std::ios::trunc);
+
+    out << Trace::Json();
+
+    return static_cast<bool>(out);
+}
+
+//  Gravacao ao final do programa. Chamada por atexit: um erro e apenas
+//  informado, pois exit nao pode ser chamada de novo
+#undef  __FUNCT__
+#define __FUNCT__ "void SaveAtExit ()"
+void SaveAtExit ()
+{
+std::string     file;
+
+    {
+    std::lock_guard<std::mutex>     lock (Global().mutex);
+
+        file = Global().file;
+    }
+
+    if (!file.empty() && !Write(file))
+        std::cout   << IsoException(IST_LOC, "Trace", BadFile, file)
+                    << "\n";
+}
+
+//  ISOTHERM_TRACE liga o rastreamento na carga da biblioteca
+bool FromEnvironment ()
+{
+const char*     file (std::getenv("ISOTHERM_TRACE"));
+
+    if (file == nullptr || *file == '\0') return false;
+
+    Global().file  = file;
+    Global().epoch = Trace::Now();
+
+    std::atexit(SaveAtExit);
+
+    return true;
+}
+
+//  Microssegundos com tres casas, a partir de ns
+void Micro (std::string& _out, const std::uint64_t& _ns)
+{
+char        buffer[32];
+const auto  res (std::to_chars(buffer, buffer + sizeof(buffer), _ns / 1000));
+
+    _out.append(buffer, res.ptr);
+    _out += '.';
+
+const std::uint64_t     frac (_ns % 1000);
+
+    _out += char('0' + frac / 100);
+    _out += char('0' + frac / 10 % 10);
+    _out += char('0' + frac % 10);
+}
+
+}   // namespace
+
+std::atomic<bool> Trace::enabled (FromEnvironment());
+
+//==============================================================================
+// Controle
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Trace :: Start (const std::string&)"
+void
+Trace :: Start (const std::string& _file)
+{
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+
+    if (registry.epoch == 0) registry.epoch = Now();
+
+    if (!_file.empty()) {
+        if (registry.file.empty()) std::atexit(SaveAtExit);
+        registry.file = _file;
+    }
+
+    enabled.store(true, std::memory_order_relaxed);
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Trace :: Stop ()"
+void
+Trace :: Stop ()
+{
+
+    enabled.store(false, std::memory_order_relaxed);
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Trace :: Clear ()"
+void
+Trace :: Clear ()
+{
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+
+    for (const auto& buffer : registry.buffers) buffer->count.store(0, std::memory_order_relaxed);
+
+    registry.epoch = Now();
+
+}
+
+//==============================================================================
+// Registro
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Trace :: Record (const char*, const char*, const std::uint64_t&, const std::uint64_t&)"
+void
+Trace :: Record (   const char*             _name
+                ,   const char*             _category
+                ,   const std::uint64_t&    _start
+                ,   const std::uint64_t&    _end
+                )
+{
+
+Buffer&             buffer (holder.Get());
+const std::uint64_t n (buffer.count.load(std::memory_order_relaxed));
+
+    buffer.events[n % CAPACITY] = {_name, _category, _start, _end - _start};
+    buffer.count.store(n + 1, std::memory_order_release);
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "size_t Trace :: NumberEvents ()"
+size_t
+Trace :: NumberEvents ()
+{
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+size_t                          n (0);
+
+    for (const auto& buffer : registry.buffers) n += std::min<std::uint64_t>(buffer->count.load(std::memory_order_acquire), CAPACITY);
+
+    return n;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "size_t Trace :: Dropped ()"
+size_t
+Trace :: Dropped ()
+{
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+size_t                          n (0);
+
+    for (const auto& buffer : registry.buffers) {
+    const std::uint64_t     count (buffer->count.load(std::memory_order_acquire));
+        if (count > CAPACITY) n += count - CAPACITY;
+    }
+
+    return n;
+
+}
+
+//==============================================================================
+// Gravacao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "std::string Trace :: Json ()"
+std::string
+Trace :: Json ()
+{
+
+Registry&                       registry (Global());
+std::lock_guard<std::mutex>     lock (registry.mutex);
+std::string                     out ("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+bool                            first (true);
+
+    for (const auto& buffer : registry.buffers) {
+
+    const std::uint64_t     count (buffer->count.load(std::memory_order_acquire));
+    const std::string       tid (std::to_string(buffer->tid));
+
+        if (count == 0) continue;
+
+        out += first ? "\n" : ",\n";
+        out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":\"thread " + tid + "\"}}";
+        first = false;
+
+        for (std::uint64_t k = count > CAPACITY ? count - CAPACITY : 0; k < count; ++k) {
+
+        const Event&    event (buffer->events[k % CAPACITY]);
+
+            out += ",\n{\"name\":\"";
+            out += event.name;
+            out += "\",\"cat\":\"";
+            out += event.category;
+            out += "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + tid + ",\"ts\":";
+            Micro(out, event.start > registry.epoch ? event.start - registry.epoch : 0);
+            out += ",\"dur\":";
+            Micro(out, event.duration);
+            out += "}";
+        }
+    }
+
+    out += first ? "]}\n" : "\n]}\n";
+
+    return out;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Trace :: Save (const std::string&)"
+void
+Trace :: Save (const std::string& _file)
+{
+
+    try {
+
+        if (!Write(_file)) throw
+                IsoException    (   IST_LOC
+                                ,   "Trace"
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
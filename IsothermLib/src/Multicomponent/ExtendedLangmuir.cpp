@@ -0,0 +1,117 @@
+//==============================================================================
+// Name        : ExtendedLangmuir.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Langmuir estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Multicomponent/ExtendedLangmuir.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ExtendedLangmuir :: ExtendedLangmuir (const std::vector<Langmuir>&)"
+ExtendedLangmuir :: ExtendedLangmuir    (   const std::vector < Langmuir >&     _component
+                                        )
+                                        :   component(_component)
+{
+
+    CheckComponents(_component.size());
+
+    try {
+
+        for (const auto& iso : _component) {
+
+            if (iso.Qmax() <= 0.0 || iso.K1() <= 0.0) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    nComponents = _component.size();
+    qmaxK1.resize(nComponents);
+    coeffK1.resize(nComponents);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        coeffK1[i] = _component[i].K1();
+        qmaxK1[i]  = _component[i].Qmax() * coeffK1[i];
+    }
+
+}
+
+//==============================================================================
+// Avaliacao vetorizada
+//==============================================================================
+
+void
+ExtendedLangmuir :: Evaluate    (   const Real* const*      _ce
+                                ,   Real* const*            _qe
+                                ,   Real*                   _den
+                                ,   const size_t&           _npto
+                                ,   const Real&
+                                ) const
+{
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0;
+
+    for (size_t j = 0; j < nComponents; ++j) {
+
+    const Real          kj (coeffK1[j]);
+    const Real* const   ce (_ce[j]);
+
+        for (size_t k = 0; k < _npto; ++k) _den[k] += kj * ce[k];
+    }
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0 / _den[k];
+
+    for (size_t i = 0; i < nComponents; ++i) {
+
+    const Real          qk (qmaxK1[i]);
+    const Real* const   ce (_ce[i]);
+    Real* const         qe (_qe[i]);
+
+        for (size_t k = 0; k < _npto; ++k) qe[k] = qk * ce[k] * _den[k];
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,121 @@
+//==============================================================================
+// Name        : ExtendedRedlichPeterson.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Redlich-Peterson estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Multicomponent/ExtendedRedlichPeterson.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ExtendedRedlichPeterson :: ExtendedRedlichPeterson (const std::vector<RedlichPeterson>&)"
+ExtendedRedlichPeterson :: ExtendedRedlichPeterson    (   const std::vector < RedlichPeterson >&     _component
+                                                      )
+                                                      :   component(_component)
+{
+
+    CheckComponents(_component.size());
+
+    try {
+
+        for (const auto& iso : _component) {
+
+            if (iso.K1() <= 0.0 || iso.K2() <= 0.0 || iso.K3() <= 0.0) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    nComponents = _component.size();
+    coeffK1.resize(nComponents);
+    coeffK2.resize(nComponents);
+    coeffK3.resize(nComponents);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        coeffK1[i] = _component[i].K1();
+        coeffK2[i] = _component[i].K2();
+        coeffK3[i] = _component[i].K3();
+    }
+
+}
+
+//==============================================================================
+// Avaliacao vetorizada
+//==============================================================================
+
+void
+ExtendedRedlichPeterson :: Evaluate    (   const Real* const*      _ce
+                                       ,   Real* const*            _qe
+                                       ,   Real*                   _den
+                                       ,   const size_t&           _npto
+                                       ,   const Real&
+                                       ) const
+{
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0;
+
+    for (size_t j = 0; j < nComponents; ++j) {
+
+    const Real          kj (coeffK2[j]);
+    const Real          bj (coeffK3[j]);
+    const Real* const   ce (_ce[j]);
+
+        for (size_t k = 0; k < _npto; ++k) _den[k] += kj * pow(ce[k], bj);
+    }
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0 / _den[k];
+
+    for (size_t i = 0; i < nComponents; ++i) {
+
+    const Real          ki (coeffK1[i]);
+    const Real* const   ce (_ce[i]);
+    Real* const         qe (_qe[i]);
+
+        for (size_t k = 0; k < _npto; ++k) qe[k] = ki * ce[k] * _den[k];
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
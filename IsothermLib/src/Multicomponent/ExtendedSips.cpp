@@ -0,0 +1,126 @@
+//==============================================================================
+// Name        : ExtendedSips.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Sips estendida
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Multicomponent/ExtendedSips.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ExtendedSips :: ExtendedSips (const std::vector<Sips>&)"
+ExtendedSips :: ExtendedSips    (   const std::vector < Sips >&     _component
+                                )
+                                :   component(_component)
+{
+
+    CheckComponents(_component.size());
+
+    try {
+
+        for (const auto& iso : _component) {
+
+            if (iso.Qmax() <= 0.0 || iso.K1() <= 0.0 || iso.K2() <= 0.0) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    nComponents = _component.size();
+    qmax.resize(nComponents);
+    coeffK1.resize(nComponents);
+    invK2.resize(nComponents);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        qmax[i]    = _component[i].Qmax();
+        coeffK1[i] = _component[i].K1();
+        invK2[i]   = 1.0 / _component[i].K2();
+    }
+
+}
+
+//==============================================================================
+// Avaliacao vetorizada
+//==============================================================================
+
+void
+ExtendedSips :: Evaluate    (   const Real* const*      _ce
+                            ,   Real* const*            _qe
+                            ,   Real*                   _den
+                            ,   const size_t&           _npto
+                            ,   const Real&
+                            ) const
+{
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0;
+
+//  Os termos (K_1 C)^(1/K_2) sao guardados temporariamente em _qe
+
+    for (size_t j = 0; j < nComponents; ++j) {
+
+    const Real          kj (coeffK1[j]);
+    const Real          nj (invK2[j]);
+    const Real* const   ce (_ce[j]);
+    Real* const         qe (_qe[j]);
+
+        for (size_t k = 0; k < _npto; ++k) {
+            qe[k]    = pow(kj * ce[k], nj);
+            _den[k] += qe[k];
+        }
+    }
+
+    for (size_t k = 0; k < _npto; ++k) _den[k] = 1.0 / _den[k];
+
+    for (size_t i = 0; i < nComponents; ++i) {
+
+    const Real          qm (qmax[i]);
+    Real* const         qe (_qe[i]);
+
+        for (size_t k = 0; k < _npto; ++k) qe[k] = qm * qe[k] * _den[k];
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,674 @@
+//==============================================================================
+// Name        : IAST.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Teoria da solucao adsorvida ideal (IAST) para isotermas
+//               de componentes puros quaisquer
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/GaussLegendre.h>
+#include <Misc/Parallel.h>
+#include <Multicomponent/IAST.h>
+#include <Isotherm/OneParameter/Henry.h>
+#include <Isotherm/TwoParameters/Freundlich.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+#include <Isotherm/ThreeParameters/Sips.h>
+#include <Isotherm/ThreeParameters/Toth.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          TOLE    = 1.0e-12;      // tolerancia relativa
+const UInt          ITERMAX = 100;          // numero maximo de iteracoes
+const Real          MAXSTEP = 2.0;          // passo maximo em ln(C)
+
+//  Serie da isoterma de Toth: sum_{j>=0} u^j / (1 + j t)
+
+Real TothSeries (   const Real&     _u
+                ,   const Real&     _t
+                )
+{
+
+Real    sum (0.0);
+Real    uj (1.0);
+
+    for (UInt j = 0; j < ITERMAX; ++j) {
+        sum += uj / (1.0 + j * _t);
+        uj  *= _u;
+        if (uj < TOLE * TOLE) break;
+    }
+
+    return sum;
+
+}
+
+}
+
+//==============================================================================
+// Componente puro
+//==============================================================================
+
+IAST :: PureComponent :: PureComponent  (   const PureComponent&    _other
+                                        )
+                                        :   kind(_other.kind)
+                                        ,   isotherm(_other.isotherm ? _other.isotherm->Clone() : nullptr)
+                                        ,   table(_other.table)
+{
+    std::copy(std::begin(_other.par), std::end(_other.par), std::begin(par));
+}
+
+IAST :: PureComponent&
+IAST :: PureComponent :: operator = (   const PureComponent&    _other
+                                    )
+{
+
+    if (this != &_other) {
+        kind = _other.kind;
+        std::copy(std::begin(_other.par), std::end(_other.par), std::begin(par));
+        isotherm = _other.isotherm ? _other.isotherm->Clone() : nullptr;
+        table    = _other.table;
+    }
+
+    return *this;
+
+}
+
+IAST :: Workspace :: Workspace  (   const IAST&     _iast
+                                )
+                                :   isotherm(_iast.nComponents)
+                                ,   c0(_iast.nComponents)
+                                ,   q0(_iast.nComponents)
+{
+
+    for (size_t i = 0; i < _iast.nComponents; ++i) isotherm[i] = _iast.component[i].isotherm.get();
+
+}
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "IAST :: IAST (const std::vector<const Isotherm*>&)"
+IAST :: IAST    (   const std::vector < const Isotherm* >&  _component
+                )
+                :   component(_component.size())
+{
+
+    CheckComponents(_component.size());
+
+    try {
+
+        for (const auto& iso : _component) {
+
+            if (iso == nullptr || iso->NumberConst() == 0) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    nComponents = _component.size();
+
+    for (size_t i = 0; i < nComponents; ++i) {
+
+    const Isotherm&     iso (*_component[i]);
+    PureComponent&      comp (component[i]);
+
+        comp.isotherm = iso.Clone();
+
+//  Os modelos com forma fechada sao identificados pelo ID. Como Isotherm e
+//  base virtual, o acesso as constantes exige dynamic_cast.
+
+        switch (iso.classID()) {
+
+            case ID::Henry: {
+            const auto  ptr (dynamic_cast<const Henry*>(&iso));
+                comp.kind   = HenryForm;
+                comp.par[0] = ptr->K1();
+                break;
+            }
+
+            case ID::Langmuir: {
+            const auto  ptr (dynamic_cast<const Langmuir*>(&iso));
+                comp.kind   = LangmuirForm;
+                comp.par[0] = ptr->Qmax();
+                comp.par[1] = ptr->K1();
+                break;
+            }
+
+            case ID::Freundlich: {
+            const auto  ptr (dynamic_cast<const Freundlich*>(&iso));
+                comp.kind   = FreundlichForm;
+                comp.par[0] = ptr->K1();
+                comp.par[1] = ptr->K2();
+                break;
+            }
+
+            case ID::Sips: {
+            const auto  ptr (dynamic_cast<const Sips*>(&iso));
+                comp.kind   = SipsForm;
+                comp.par[0] = ptr->Qmax();
+                comp.par[1] = ptr->K1();
+                comp.par[2] = ptr->K2();
+                break;
+            }
+
+            case ID::Toth: {
+            const auto  ptr (dynamic_cast<const Toth*>(&iso));
+                comp.kind   = TothForm;
+                comp.par[0] = ptr->Qmax();
+                comp.par[1] = ptr->K1();
+                comp.par[2] = ptr->K2();
+                comp.par[3] = std::pow(0.5, 1.0 / comp.par[2])
+                            * TothSeries(0.5, comp.par[2]); // psi / Qmax para u = 1/2
+                break;
+            }
+
+            default:
+                comp.kind   = QuadratureForm;
+                break;
+        }
+
+        try {
+
+            if  (   comp.kind != QuadratureForm
+                &&  std::any_of (   comp.par
+                                ,   comp.par + iso.NumberConst()
+                                ,   [](const Real& _par){return _par <= 0.0;})
+                ) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCoefficient
+                                    );
+
+        } catch (const IsoException& _isoExcept) {
+
+            std::cout   << _isoExcept
+                        << "\n";
+            exit(EXIT_FAILURE);
+        }
+    }
+
+}
+
+//==============================================================================
+// Pressao de espalhamento reduzida
+//==============================================================================
+
+Real
+IAST :: Psi     (   const UInt&         _i
+                ,   const Isotherm&     _iso
+                ,   const Real&         _c
+                ,   const Real&         _temp
+                ) const
+{
+
+const Real* const   par (component[_i].par);
+
+    if (_c <= 0.0) return 0.0;
+
+    switch (component[_i].kind) {
+
+        case HenryForm:
+            return par[0] * _c;
+
+        case LangmuirForm:
+            return par[0] * std::log1p(par[1] * _c);
+
+        case FreundlichForm:
+            return par[0] * par[1] * std::pow(_c, 1.0 / par[1]);
+
+        case SipsForm:
+            return par[0] * par[2] * std::log1p(std::pow(par[1] * _c, 1.0 / par[2]));
+
+        case TothForm: {
+
+//  Com u = theta^t, psi / Qmax = theta sum_{j>=0} u^j / (1 + j t). Para u > 1/2
+//  integra-se 1 / (1 - w^t) em [theta_0, theta], separando a singularidade
+//  logaritmica 1 / (t (1 - w)) em w = 1.
+
+        const Real  t (par[2]);
+        const Real  bct (par[1] * std::pow(_c, t));
+        const Real  u (bct / (1.0 + bct));
+
+            if (u <= 0.5) return par[0] * std::pow(u, 1.0 / t) * TothSeries(u, t);
+
+        const Real  theta (std::pow(u, 1.0 / t));
+        const Real  omtheta (- std::expm1(std::log1p(- 1.0 / (1.0 + bct)) / t));
+        const Real  theta0 (std::pow(0.5, 1.0 / t));
+        const Real  omtheta0 (1.0 - theta0);
+        const Real  wmid (std::sqrt(theta0 * theta));
+        Real        sum (par[3] + std::log(omtheta0 / omtheta) / t);
+
+        const auto  g ([t](const Real& _w) {
+                            return - 1.0 / std::expm1(t * std::log(_w)) - 1.0 / (t * (1.0 - _w));
+                        });
+
+            sum += GaussLegendre8(g, theta0, wmid) + GaussLegendre8(g, wmid, theta);
+
+            return par[0] * sum;
+        }
+
+        default:
+            break;
+    }
+
+const auto&     table (component[_i].table);
+
+    if (table && table->Temperature() == _temp) return table->Psi(_c);
+
+    return SpreadingPressureTable::Quadrature(_iso, _c, _temp);
+
+}
+
+//==============================================================================
+// Quantidade adsorvida do componente puro
+//==============================================================================
+
+Real
+IAST :: Loading     (   const UInt&         _i
+                    ,   const Isotherm&     _iso
+                    ,   const Real&         _c
+                    ,   const Real&         _temp
+                    ) const
+{
+
+const Real* const   par (component[_i].par);
+
+    switch (component[_i].kind) {
+
+        case HenryForm:
+            return par[0] * _c;
+
+        case LangmuirForm:
+            return par[0] * par[1] * _c / (1.0 + par[1] * _c);
+
+        case FreundlichForm:
+            return par[0] * std::pow(_c, 1.0 / par[1]);
+
+        case SipsForm: {
+
+        const Real  x (std::pow(par[1] * _c, 1.0 / par[2]));
+
+            return par[0] * x / (1.0 + x);
+        }
+
+        case TothForm:
+            return par[0] * _c / std::pow(1.0 / par[1] + std::pow(_c, par[2]), 1.0 / par[2]);
+
+        default:
+            break;
+    }
+
+const auto&     table (component[_i].table);
+
+    if (table && table->Temperature() == _temp) return table->Qe(_c);
+
+    return _iso.Qe(_c, _temp);
+
+}
+
+//==============================================================================
+// Concentracao do componente puro com pressao de espalhamento _psi
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real IAST :: InversePsi (const UInt&, const Isotherm&, const Real&, const Real&, const Real&) const"
+Real
+IAST :: InversePsi  (   const UInt&         _i
+                    ,   const Isotherm&     _iso
+                    ,   const Real&         _psi
+                    ,   const Real&         _guess
+                    ,   const Real&         _temp
+                    ) const
+{
+
+const Real* const   par (component[_i].par);
+
+    switch (component[_i].kind) {
+
+        case HenryForm:
+            return _psi / par[0];
+
+        case LangmuirForm:
+            return std::expm1(_psi / par[0]) / par[1];
+
+        case FreundlichForm:
+            return std::pow(_psi / (par[0] * par[1]), par[1]);
+
+        case SipsForm:
+            return std::pow(std::expm1(_psi / (par[0] * par[2])), par[2]) / par[1];
+
+        default:
+            break;
+    }
+
+const auto&     table (component[_i].table);
+
+    if (table && table->Temperature() == _temp) return table->Ce(_psi);
+
+//  Newton em s = ln(C), com d psi / d s = q(C)
+
+Real    s (std::log(_guess > 0.0 ? _guess : 1.0));
+
+    try {
+
+        for (UInt iter = 0; iter < ITERMAX; ++iter) {
+
+        const Real  c (std::exp(s));
+        const Real  g (Psi(_i, _iso, c, _temp) - _psi);
+
+            if (std::fabs(g) <= TOLE * _psi) return c;
+
+        const Real  q (Loading(_i, _iso, c, _temp));
+        const Real  ds (q > 0.0 ? std::clamp(g / q, - MAXSTEP, MAXSTEP)
+                                : (g > 0.0 ? MAXSTEP : - MAXSTEP));
+
+            s -= ds;
+
+            if (std::fabs(ds) <= TOLE * std::max(1.0, std::fabs(s))) return std::exp(s);
+        }
+
+        throw   IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Solucao para uma composicao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void IAST :: Solve (const Real*, Real*, const Real&, Workspace&) const"
+void
+IAST :: Solve   (   const Real*     _ce
+                ,   Real*           _qe
+                ,   const Real&     _temp
+                ,   Workspace&      _ws
+                ) const
+{
+
+Real    ctot (0.0);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        ctot  += _ce[i];
+        _qe[i] = 0.0;
+    }
+
+    if (ctot <= 0.0) return;
+
+//  Intervalo que contem a raiz: f(lo) >= 0 e f(hi) <= 0
+
+Real    lo (0.0);
+Real    hi (0.0);
+Real    psi (0.0);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+
+        if (_ce[i] <= 0.0) continue;
+
+    const Real  psiTot (Psi(i, *_ws.isotherm[i], ctot, _temp));
+
+        lo   = std::max(lo, Psi(i, *_ws.isotherm[i], _ce[i], _temp));
+        hi   = std::max(hi, psiTot);
+        psi += _ce[i] * psiTot / ctot;
+        _ws.c0[i] = ctot;
+    }
+
+    psi = std::clamp(psi, lo, hi);
+
+//  Newton em psi: f(psi) = sum_i C_i / C_i^0(psi) - 1,
+//  df / dpsi = - sum_i C_i / (C_i^0 q_i^0)
+
+UInt    iter (0);
+
+    for (; iter < ITERMAX; ++iter) {
+
+    Real    f (- 1.0);
+    Real    df (0.0);
+
+        for (size_t i = 0; i < nComponents; ++i) {
+
+            if (_ce[i] <= 0.0) continue;
+
+        const Isotherm&     iso (*_ws.isotherm[i]);
+
+            _ws.c0[i] = InversePsi(i, iso, psi, _ws.c0[i], _temp);
+            _ws.q0[i] = Loading(i, iso, _ws.c0[i], _temp);
+
+            f  += _ce[i] / _ws.c0[i];
+            df -= _ce[i] / (_ws.c0[i] * _ws.q0[i]);
+        }
+
+        if (std::fabs(f) <= TOLE) break;
+
+        (f > 0.0 ? lo : hi) = psi;
+
+        if (hi - lo <= TOLE * hi) break;
+
+    Real    next (psi - f / df);
+
+        if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+
+        psi = next;
+    }
+
+    try {
+
+        if (iter == ITERMAX) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Com tabelas, q_i^0 vem da derivada da spline; a quantidade adsorvida final
+//  usa a isoterma original.
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        if (_ce[i] > 0.0 && component[i].table) _ws.q0[i] = _ws.isotherm[i]->Qe(_ws.c0[i], _temp);
+    }
+
+//  Fracao na fase adsorvida x_i = C_i / C_i^0 e 1 / q_T = sum_i x_i / q_i^0
+
+Real    invQT (0.0);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        if (_ce[i] > 0.0) invQT += _ce[i] / (_ws.c0[i] * _ws.q0[i]);
+    }
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        if (_ce[i] > 0.0) _qe[i] = _ce[i] / (_ws.c0[i] * invQT);
+    }
+
+}
+
+//==============================================================================
+// Avaliacao vetorizada
+//==============================================================================
+
+void
+IAST :: Evaluate    (   const Real* const*      _ce
+                    ,   Real* const*            _qe
+                    ,   Real*
+                    ,   const size_t&           _npto
+                    ,   const Real&             _temp
+                    ) const
+{
+
+    ParallelFor (   _npto
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+
+                    Workspace   ws (*this);
+                    VecReal     ce (nComponents);
+                    VecReal     qe (nComponents);
+
+                        for (size_t k = _ini; k < _fim; ++k) {
+
+                            for (size_t i = 0; i < nComponents; ++i) ce[i] = _ce[i][k];
+
+                            Solve(ce.data(), qe.data(), _temp, ws);
+
+                            for (size_t i = 0; i < nComponents; ++i) _qe[i][k] = qe[i];
+                        }
+                    }
+                ,   nThreads
+                );
+
+}
+
+//==============================================================================
+// Tabelas da pressao de espalhamento
+//==============================================================================
+
+void
+IAST :: Tabulate    (   const Real&     _cmin
+                    ,   const Real&     _cmax
+                    ,   const Real&     _tole
+                    ,   const Real&     _temp
+                    )
+{
+
+    for (auto& comp : component) {
+
+        if (comp.kind != QuadratureForm) continue;
+
+        comp.table = std::make_shared<const SpreadingPressureTable> (   *comp.isotherm
+                                                                    ,   _cmin
+                                                                    ,   _cmax
+                                                                    ,   _tole
+                                                                    ,   _temp
+                                                                    );
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void IAST :: Table (const UInt&, const SpreadingPressureTable&)"
+void
+IAST :: Table   (   const UInt&                     _i
+                ,   const SpreadingPressureTable&   _table
+                )
+{
+
+    try {
+
+        if (_i >= nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+        if (_table.NumberNodes() == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    component[_i].table = std::make_shared<const SpreadingPressureTable>(_table);
+
+}
+
+//==============================================================================
+// Pressao de espalhamento de um componente puro
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real IAST :: SpreadingPressure (const UInt&, const Real&, const Real&) const"
+Real
+IAST :: SpreadingPressure   (   const UInt&     _i
+                            ,   const Real&     _c0
+                            ,   const Real&     _temp
+                            ) const
+{
+
+    try {
+
+        if (_i >= nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+        if (_c0 < 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return Psi(_i, *component[_i].isotherm, _c0, _temp);
+
+}
+
+IST_NAMESPACE_CLOSE
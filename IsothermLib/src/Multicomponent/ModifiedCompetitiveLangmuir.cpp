@@ -0,0 +1,83 @@
+//==============================================================================
+// Name        : ModifiedCompetitiveLangmuir.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe com as equacoes da isoterma de Langmuir competitiva modificada
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Multicomponent/ModifiedCompetitiveLangmuir.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "ModifiedCompetitiveLangmuir :: ModifiedCompetitiveLangmuir (const std::vector<Langmuir>&, const VecReal&)"
+ModifiedCompetitiveLangmuir :: ModifiedCompetitiveLangmuir  (   const std::vector < Langmuir >&     _component
+                                                            ,   const VecReal&                      _eta
+                                                            )
+                                                            :   ExtendedLangmuir(_component)
+                                                            ,   eta(_eta)
+{
+
+    try {
+
+        if (_eta.size() != nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+        for (const auto& val : _eta) {
+
+            if (val <= 0.0) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadEtaLEZero
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        coeffK1[i] /= _eta[i];
+        qmaxK1[i]  /= _eta[i];
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,217 @@
+//==============================================================================
+// Name        : Multicomponent.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Classe base das isotermas multicomponentes competitivas
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Multicomponent/Multicomponent.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Verificacao do numero de componentes
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Multicomponent :: CheckComponents (const size_t&) const"
+void
+Multicomponent :: CheckComponents (const size_t& _ncomp) const
+{
+
+    try {
+
+        if (_ncomp == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Quantidade adsorvida para uma unica composicao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "VecReal Multicomponent :: Qe (const VecReal&, const Real&) const"
+VecReal
+Multicomponent :: Qe    (   const VecReal&      _ce
+                        ,   const Real&         _temp
+                        ) const
+{
+
+    try {
+
+        if (nComponents == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_ce.size() != nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+        if (std::any_of(_ce.begin(), _ce.end(), [](const Real& _c){return _c < 0.0;})) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+VecReal                 qe(nComponents);
+std::vector<const Real*> ptrCe(nComponents);
+std::vector<Real*>      ptrQe(nComponents);
+Real                    den;
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        ptrCe[i] = &_ce[i];
+        ptrQe[i] = &qe[i];
+    }
+
+    Evaluate(ptrCe.data(), ptrQe.data(), &den, 1, _temp);
+
+    return qe;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real Multicomponent :: Qe (const UInt&, const VecReal&, const Real&) const"
+Real
+Multicomponent :: Qe    (   const UInt&         _i
+                        ,   const VecReal&      _ce
+                        ,   const Real&         _temp
+                        ) const
+{
+
+    try {
+
+        if (_i >= nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return Qe(_ce, _temp)[_i];
+
+}
+
+//==============================================================================
+// Quantidade adsorvida para um conjunto de composicoes (layout SoA)
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Multicomponent :: Qe (const VecVecReal&, VecVecReal&, const Real&) const"
+void
+Multicomponent :: Qe    (   const VecVecReal&   _ce
+                        ,   VecVecReal&         _qe
+                        ,   const Real&         _temp
+                        ) const
+{
+
+const size_t    npto (_ce.empty() ? 0 : _ce[0].size());
+
+    try {
+
+        if (nComponents == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_ce.size() != nComponents) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+        for (const auto& ce : _ce) {
+
+            if (ce.size() != npto) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCompositionSize
+                                    );
+
+            if (std::any_of(ce.begin(), ce.end(), [](const Real& _c){return _c < 0.0;})) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadCeLTZero
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+std::vector<const Real*> ptrCe(nComponents);
+std::vector<Real*>      ptrQe(nComponents);
+VecReal                 den(npto);
+
+    _qe.resize(nComponents);
+
+    for (size_t i = 0; i < nComponents; ++i) {
+        _qe[i].resize(npto);
+        ptrCe[i] = _ce[i].data();
+        ptrQe[i] = _qe[i].data();
+    }
+
+    if (npto > 0) Evaluate(ptrCe.data(), ptrQe.data(), den.data(), npto, _temp);
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,567 @@
+//==============================================================================
+// Name        : SpreadingPressureTable.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Tabela da pressao de espalhamento reduzida de um componente
+//               puro e da sua inversa
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+//==============================================================================
+// includes POSIX
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/GaussLegendre.h>
+#include <Multicomponent/SpreadingPressureTable.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+namespace {
+
+const char          MAGIC[8] = {'I', 'S', 'T', 'S', 'P', 'T', '0', '1'};
+const UInt          NINIT    = 16;          // intervalos iniciais em ln(c)
+const UInt          MAXDEPTH = 24;          // profundidade maxima de subdivisao
+const UInt          NPANEL   = 60;          // maximo de paineis da quadratura
+const Real          TAIL     = 1.0e-6;      // painel relativo que encerra a quadratura
+const Real          RATIO    = 0.25;        // razao entre paineis consecutivos
+
+//  Spline cubica de Hermite no intervalo [x0, x0 + h] e sua derivada
+
+inline Real Hermite (   const Real&     _t
+                    ,   const Real&     _h
+                    ,   const Real&     _y0
+                    ,   const Real&     _d0
+                    ,   const Real&     _y1
+                    ,   const Real&     _d1
+                    )
+{
+
+const Real  t2 (_t * _t);
+const Real  t3 (t2 * _t);
+
+    return  (2.0 * t3 - 3.0 * t2 + 1.0) * _y0
+        +   (t3 - 2.0 * t2 + _t) * _h * _d0
+        +   (- 2.0 * t3 + 3.0 * t2) * _y1
+        +   (t3 - t2) * _h * _d1;
+
+}
+
+inline Real HermiteDerivative   (   const Real&     _t
+                                ,   const Real&     _h
+                                ,   const Real&     _y0
+                                ,   const Real&     _d0
+                                ,   const Real&     _y1
+                                ,   const Real&     _d1
+                                )
+{
+
+const Real  t2 (_t * _t);
+
+    return  (   (6.0 * t2 - 6.0 * _t) * (_y0 - _y1) / _h
+            +   (3.0 * t2 - 4.0 * _t + 1.0) * _d0
+            +   (3.0 * t2 - 2.0 * _t) * _d1
+            );
+
+}
+
+//  Criterio de monotonicidade de Fritsch-Carlson
+
+inline bool Monotone    (   const Real&     _alpha
+                        ,   const Real&     _beta
+                        )
+{
+    return _alpha > 0.0 && _beta > 0.0 && _alpha * _alpha + _beta * _beta <= 9.0;
+}
+
+}
+
+//==============================================================================
+// Quadratura da pressao de espalhamento
+//==============================================================================
+
+Real
+SpreadingPressureTable :: Quadrature    (   const Isotherm&     _iso
+                                        ,   const Real&         _c
+                                        ,   const Real&         _temp
+                                        )
+{
+
+    if (_c <= 0.0) return 0.0;
+
+//  Paineis geometricos [C RATIO^(p+1), C RATIO^p] em ln(c). Abaixo do ultimo
+//  painel a cauda e extrapolada como serie geometrica, o que e exato quando
+//  q(c) segue uma lei de potencia para c pequeno.
+
+const Real  lnRatio (std::log(RATIO));
+const auto  q ([&](const Real& _s) {return _iso.Qe(std::exp(_s), _temp);});
+Real        sb (std::log(_c));
+Real        sum (0.0);
+Real        last (0.0);
+
+    for (UInt p = 0; p < NPANEL; ++p) {
+
+    const Real  panel (GaussLegendre8(q, sb + lnRatio, sb));
+
+        sum += panel;
+        sb  += lnRatio;
+
+        if (p > 0 && panel < TAIL * sum) {
+
+        const Real  ratio (panel / last);
+
+            if (ratio < 1.0) sum += panel * ratio / (1.0 - ratio);
+            break;
+        }
+
+        last = panel;
+    }
+
+    return sum;
+
+}
+
+//==============================================================================
+// Construtora
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "SpreadingPressureTable :: SpreadingPressureTable (const Isotherm&, const Real&, const Real&, const Real&, const Real&)"
+SpreadingPressureTable :: SpreadingPressureTable    (   const Isotherm&     _iso
+                                                    ,   const Real&         _cmin
+                                                    ,   const Real&         _cmax
+                                                    ,   const Real&         _tole
+                                                    ,   const Real&         _temp
+                                                    )
+{
+
+    try {
+
+        if (_cmin <= 0.0 || _cmax <= _cmin || _tole <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+VecReal     s;
+VecReal     psi;
+VecReal     q;
+const Real  smin (std::log(_cmin));
+const Real  ds ((std::log(_cmax) - smin) / NINIT);
+
+    s.push_back(smin);
+    psi.push_back(Quadrature(_iso, _cmin, _temp));
+    q.push_back(_iso.Qe(_cmin, _temp));
+
+    for (UInt k = 1; k <= NINIT; ++k) {
+
+    const Real  sa (s.back());
+    const Real  psia (psi.back());
+    const Real  qa (q.back());
+    const Real  sb (k < NINIT ? smin + k * ds : std::log(_cmax));
+
+        Refine  (   _iso, _temp, _tole
+                ,   sa, psia, qa
+                ,   sb, _iso.Qe(std::exp(sb), _temp)
+                ,   0
+                ,   s, psi, q
+                );
+    }
+
+//  Monta o bloco contiguo no formato do arquivo
+
+const size_t    npto (s.size());
+const size_t    nreal (3 * npto);
+const size_t    nbucket (npto - 1);
+const size_t    bytes (sizeof(Header) + nreal * sizeof(Real) + 2 * nbucket * sizeof(std::uint32_t));
+auto            buffer (std::make_shared<VecReal>((bytes + sizeof(Real) - 1) / sizeof(Real), 0.0));
+char* const     base (reinterpret_cast<char*>(buffer->data()));
+Header          head;
+
+    std::memcpy(head.magic, MAGIC, sizeof(MAGIC));
+    head.npto        = npto;
+    head.temperature = _temp;
+    head.tolerance   = _tole;
+    head.cmin        = _cmin;
+    head.cmax        = _cmax;
+
+    std::memcpy(base, &head, sizeof(Header));
+
+Real* const             ptrS (reinterpret_cast<Real*>(base + sizeof(Header)));
+Real* const             ptrPsi (ptrS + npto);
+Real* const             ptrQ (ptrPsi + npto);
+std::uint32_t* const    ptrBS (reinterpret_cast<std::uint32_t*>(ptrQ + npto));
+std::uint32_t* const    ptrBP (ptrBS + nbucket);
+
+    std::copy(s.begin(), s.end(), ptrS);
+    std::copy(psi.begin(), psi.end(), ptrPsi);
+    std::copy(q.begin(), q.end(), ptrQ);
+
+//  Baldes uniformes: balde b aponta para o intervalo que contem x_0 + b dx
+
+    for (const auto& [node, bucket] : {std::pair(ptrS, ptrBS), std::pair(ptrPsi, ptrBP)}) {
+
+    const Real  dx ((node[npto - 1] - node[0]) / nbucket);
+    size_t      k (0);
+
+        for (size_t b = 0; b < nbucket; ++b) {
+
+        const Real  x (node[0] + b * dx);
+
+            while (k + 2 < npto && node[k + 1] <= x) ++k;
+            bucket[b] = static_cast<std::uint32_t>(k);
+        }
+    }
+
+    Attach(std::shared_ptr<const void>(buffer, buffer->data()), bytes);
+
+}
+
+//==============================================================================
+// Subdivisao com controle de erro
+//==============================================================================
+
+void
+SpreadingPressureTable :: Refine    (   const Isotherm&     _iso
+                                    ,   const Real&         _temp
+                                    ,   const Real&         _tole
+                                    ,   const Real&         _sa
+                                    ,   const Real&         _psia
+                                    ,   const Real&         _qa
+                                    ,   const Real&         _sb
+                                    ,   const Real&         _qb
+                                    ,   const UInt&         _depth
+                                    ,   VecReal&            _s
+                                    ,   VecReal&            _psi
+                                    ,   VecReal&            _q
+                                    ) const
+{
+
+const auto  q ([&](const Real& _x) {return _iso.Qe(std::exp(_x), _temp);});
+const Real  h (_sb - _sa);
+const Real  sm (0.5 * (_sa + _sb));
+const Real  psim (_psia + GaussLegendre8(q, _sa, sm));
+const Real  psib (psim + GaussLegendre8(q, sm, _sb));
+const Real  dpsi (psib - _psia);
+
+bool        accept (_depth >= MAXDEPTH);
+
+    if (!accept && dpsi > 0.0) {
+
+    const Real  alpha (_qa * h / dpsi);
+    const Real  beta (_qb * h / dpsi);
+
+        if (Monotone(alpha, beta) && Monotone(1.0 / alpha, 1.0 / beta)) {
+
+        const Real  errPsi (std::fabs(Hermite(0.5, h, _psia, _qa, psib, _qb) - psim));
+        const Real  tm ((psim - _psia) / dpsi);
+        const Real  errS (std::fabs(Hermite(tm, dpsi, _sa, 1.0 / _qa, _sb, 1.0 / _qb) - sm));
+
+            accept = errPsi <= _tole * psim && errS <= _tole;
+        }
+    }
+
+    if (accept) {
+        _s.push_back(_sb);
+        _psi.push_back(psib);
+        _q.push_back(_qb);
+        return;
+    }
+
+const Real  qm (q(sm));
+
+    Refine(_iso, _temp, _tole, _sa, _psia, _qa, sm, qm, _depth + 1, _s, _psi, _q);
+
+const Real  psimRefined (_psi.back());
+
+    Refine(_iso, _temp, _tole, sm, psimRefined, qm, _sb, _qb, _depth + 1, _s, _psi, _q);
+
+}
+
+//==============================================================================
+// Associa os ponteiros ao bloco de dados
+//==============================================================================
+
+void
+SpreadingPressureTable :: Attach    (   const std::shared_ptr<const void>&  _storage
+                                    ,   const size_t&                       _nbytes
+                                    )
+{
+
+const char* const   base (static_cast<const char*>(_storage.get()));
+
+    storage   = _storage;
+    nbytes    = _nbytes;
+    header    = reinterpret_cast<const Header*>(base);
+
+const size_t        npto (header->npto);
+
+    nodeS     = reinterpret_cast<const Real*>(base + sizeof(Header));
+    nodePsi   = nodeS + npto;
+    nodeQ     = nodePsi + npto;
+    bucketS   = reinterpret_cast<const std::uint32_t*>(nodeQ + npto);
+    bucketPsi = bucketS + (npto - 1);
+    invDs     = (npto - 1) / (nodeS[npto - 1] - nodeS[0]);
+    invDpsi   = (npto - 1) / (nodePsi[npto - 1] - nodePsi[0]);
+
+}
+
+//==============================================================================
+// Localizacao dos intervalos
+//==============================================================================
+
+size_t
+SpreadingPressureTable :: IntervalS (const Real& _s) const
+{
+
+const size_t    npto (header->npto);
+size_t          k (bucketS[std::min<size_t>(npto - 2, static_cast<size_t>((_s - nodeS[0]) * invDs))]);
+
+    while (k + 2 < npto && nodeS[k + 1] <= _s) ++k;
+
+    return k;
+
+}
+
+size_t
+SpreadingPressureTable :: IntervalPsi (const Real& _psi) const
+{
+
+const size_t    npto (header->npto);
+size_t          k (bucketPsi[std::min<size_t>(npto - 2, static_cast<size_t>((_psi - nodePsi[0]) * invDpsi))]);
+
+    while (k + 2 < npto && nodePsi[k + 1] <= _psi) ++k;
+
+    return k;
+
+}
+
+//==============================================================================
+// Consultas
+//==============================================================================
+
+Real
+SpreadingPressureTable :: Psi (const Real& _c) const
+{
+
+    if (_c <= 0.0) return 0.0;
+
+const size_t    npto (header->npto);
+const Real      s (std::log(_c));
+
+//  Abaixo da tabela: lei de potencia psi = psi_0 (c / c_min)^a, a = q_0 / psi_0
+
+    if (s < nodeS[0]) return nodePsi[0] * std::exp(nodeQ[0] / nodePsi[0] * (s - nodeS[0]));
+
+//  Acima da tabela: q constante
+
+    if (s >= nodeS[npto - 1]) return nodePsi[npto - 1] + nodeQ[npto - 1] * (s - nodeS[npto - 1]);
+
+const size_t    k (IntervalS(s));
+const Real      h (nodeS[k + 1] - nodeS[k]);
+
+    return Hermite  (   (s - nodeS[k]) / h, h
+                    ,   nodePsi[k], nodeQ[k]
+                    ,   nodePsi[k + 1], nodeQ[k + 1]
+                    );
+
+}
+
+Real
+SpreadingPressureTable :: Qe (const Real& _c) const
+{
+
+    if (_c <= 0.0) return 0.0;
+
+const size_t    npto (header->npto);
+const Real      s (std::log(_c));
+
+    if (s < nodeS[0]) return nodeQ[0] * std::exp(nodeQ[0] / nodePsi[0] * (s - nodeS[0]));
+
+    if (s >= nodeS[npto - 1]) return nodeQ[npto - 1];
+
+const size_t    k (IntervalS(s));
+const Real      h (nodeS[k + 1] - nodeS[k]);
+
+    return HermiteDerivative    (   (s - nodeS[k]) / h, h
+                                ,   nodePsi[k], nodeQ[k]
+                                ,   nodePsi[k + 1], nodeQ[k + 1]
+                                );
+
+}
+
+Real
+SpreadingPressureTable :: Ce (const Real& _psi) const
+{
+
+    if (_psi <= 0.0) return 0.0;
+
+const size_t    npto (header->npto);
+
+    if (_psi < nodePsi[0]) return std::exp(nodeS[0] + nodePsi[0] / nodeQ[0] * std::log(_psi / nodePsi[0]));
+
+    if (_psi >= nodePsi[npto - 1]) return std::exp(nodeS[npto - 1] + (_psi - nodePsi[npto - 1]) / nodeQ[npto - 1]);
+
+const size_t    k (IntervalPsi(_psi));
+const Real      h (nodePsi[k + 1] - nodePsi[k]);
+
+    return std::exp(Hermite (   (_psi - nodePsi[k]) / h, h
+                            ,   nodeS[k], 1.0 / nodeQ[k]
+                            ,   nodeS[k + 1], 1.0 / nodeQ[k + 1]
+                            ));
+
+}
+
+//==============================================================================
+// Arquivo binario
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void SpreadingPressureTable :: Save (const std::string&) const"
+void
+SpreadingPressureTable :: Save (const std::string& _file) const
+{
+
+    try {
+
+        if (header == nullptr) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+    std::ofstream   out (_file, std::ios::binary | std::ios::trunc);
+
+        out.write(static_cast<const char*>(storage.get()), static_cast<std::streamsize>(nbytes));
+
+        if (!out) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "SpreadingPressureTable SpreadingPressureTable :: Load (const std::string&)"
+SpreadingPressureTable
+SpreadingPressureTable :: Load (const std::string& _file)
+{
+
+SpreadingPressureTable  table;
+void*                   addr (MAP_FAILED);
+size_t                  bytes (0);
+
+    try {
+
+    const int       fd (::open(_file.c_str(), O_RDONLY));
+    struct stat     info;
+
+        if (fd < 0) throw
+                IsoException    (   IST_LOC
+                                ,   table.className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+        if (::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(Header)) {
+            bytes = static_cast<size_t>(info.st_size);
+            addr  = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        }
+
+        ::close(fd);
+
+        if (addr == MAP_FAILED) throw
+                IsoException    (   IST_LOC
+                                ,   table.className()
+                                ,   BadFile
+                                ,   _file
+                                );
+
+    const Header*   head (static_cast<const Header*>(addr));
+    const size_t    npto (head->npto);
+
+        if  (   std::memcmp(head->magic, MAGIC, sizeof(MAGIC)) != 0
+            ||  npto < 2
+            ||  bytes < sizeof(Header) + 3 * npto * sizeof(Real) + 2 * (npto - 1) * sizeof(std::uint32_t)
+            ) {
+            ::munmap(addr, bytes);
+            throw   IsoException    (   IST_LOC
+                                    ,   table.className()
+                                    ,   BadFile
+                                    ,   _file
+                                    );
+        }
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    table.Attach    (   std::shared_ptr<const void> (   addr
+                                                    ,   [bytes](const void* _addr) {
+                                                            ::munmap(const_cast<void*>(_addr), bytes);
+                                                        })
+                    ,   bytes
+                    );
+
+    return table;
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,273 @@
+//==============================================================================
+// Name        : BatchEquilibrium.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Equilibrio de adsorcao em batelada (ensaio de jarro)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/Parallel.h>
+#include <Misc/RootFinding.h>
+#include <Misc/Trace.h>
+#include <Process/BatchEquilibrium.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          TOLE    = 1.0e-13;      // tolerancia relativa
+const UInt          ITERMAX = 200;          // numero maximo de iteracoes
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+BatchEquilibrium :: BatchEquilibrium    (   const Isotherm&     _iso
+                                        ,   const Real&         _temp
+                                        )
+                                        :   isotherm(_iso.Clone())
+                                        ,   temperature(_temp)
+{
+}
+
+BatchEquilibrium :: BatchEquilibrium    (   const BatchEquilibrium&     _other
+                                        )
+                                        :   isotherm(_other.isotherm ? _other.isotherm->Clone() : nullptr)
+                                        ,   temperature(_other.temperature)
+{
+}
+
+BatchEquilibrium&
+BatchEquilibrium :: operator = (const BatchEquilibrium& _other)
+{
+
+    if (this == &_other) return *this;
+
+    isotherm    = _other.isotherm ? _other.isotherm->Clone() : nullptr;
+    temperature = _other.temperature;
+
+    return *this;
+
+}
+
+//==============================================================================
+// Equilibrio
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void BatchEquilibrium :: Point (const Isotherm&, const Real&, const Real&, const Real&, Real&, Real&) const"
+void
+BatchEquilibrium :: Point   (   const Isotherm&     _iso
+                            ,   const Real&         _c0
+                            ,   const Real&         _volume
+                            ,   const Real&         _mass
+                            ,   Real&               _ce
+                            ,   Real&               _qe
+                            ) const
+{
+
+    try {
+
+        if (_c0 < 0.0 || _volume <= 0.0 || _mass <= 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (_c0 == 0.0) {
+        _ce = _qe = 0.0;
+        return;
+    }
+
+const Real  ratio (_volume / _mass);            // V / m
+const Real  qmax (_c0 * ratio);                 // todo o soluto adsorvido
+Real        ce, dcdq;
+bool        ok;
+
+    if (_iso.ExplicitCe(0.5 * qmax, temperature, ce, dcdq)) {
+
+//  Raiz em qe: Ce(qe) - (C0 - qe m / V) = 0
+
+    Real    q (0.5 * qmax);
+
+        ok = BracketedNewton    (   [&](const Real& _q, Real& _f, Real& _df) {
+                                    //  ExplicitCe ja foi aceita pelo modelo acima: o resultado e sempre true
+                                        static_cast<void>(_iso.ExplicitCe(_q, temperature, ce, dcdq));
+                                        _f  = ce - (_c0 - _q / ratio);
+                                        _df = dcdq + 1.0 / ratio;
+                                    }
+                                ,   0.0
+                                ,   qmax
+                                ,   q
+                                ,   TOLE * qmax
+                                ,   ITERMAX
+                                ,   ID::BatchEquilibrium
+                                );
+
+        _qe = q;
+        _ce = std::max(_c0 - q / ratio, 0.0);
+    }
+    else {
+
+//  Raiz em Ce: Qe(Ce) - (C0 - Ce) V / m = 0
+
+    Real    c (0.5 * _c0);
+
+        ok = BracketedNewton    (   [&](const Real& _c, Real& _f, Real& _df) {
+                                        _f  = _iso.Qe(_c, temperature) - (_c0 - _c) * ratio;
+                                        _df = _iso.DQDC(_c, temperature) + ratio;
+                                    }
+                                ,   0.0
+                                ,   _c0
+                                ,   c
+                                ,   TOLE * _c0
+                                ,   ITERMAX
+                                ,   ID::BatchEquilibrium
+                                );
+
+        _ce = c;
+        _qe = (_c0 - c) * ratio;
+    }
+
+    try {
+
+        if (!ok) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "Real BatchEquilibrium :: Ce (const Real&, const Real&, const Real&) const"
+Real
+BatchEquilibrium :: Ce  (   const Real&     _c0
+                        ,   const Real&     _volume
+                        ,   const Real&     _mass
+                        ) const
+{
+
+    try {
+
+        if (!isotherm) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+Real    ce, qe;
+
+    Point(*isotherm, _c0, _volume, _mass, ce, qe);
+
+    return ce;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void BatchEquilibrium :: Solve (std::span<const Real>, std::span<const Real>, std::span<const Real>, std::span<Real>, std::span<Real>, const UInt&) const"
+void
+BatchEquilibrium :: Solve   (   std::span<const Real>   _c0
+                            ,   std::span<const Real>   _volume
+                            ,   std::span<const Real>   _mass
+                            ,   std::span<Real>         _ce
+                            ,   std::span<Real>         _qe
+                            ,   const UInt&             _nthreads
+                            ) const
+{
+
+IST_TRACE("BatchEquilibrium", "process");
+
+const size_t    npto (_c0.size());
+
+    try {
+
+        if (!isotherm) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if  (   _volume.size() != npto
+            ||  _mass.size() != npto
+            ||  _ce.size() != npto
+            ||  _qe.size() != npto
+            ) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    ParallelFor (   npto
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+
+                        for (size_t k = _ini; k < _fim; ++k)
+                            Point(*isotherm, _c0[k], _volume[k], _mass[k], _ce[k], _qe[k]);
+                    }
+                ,   _nthreads
+                );
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,308 @@
+//==============================================================================
+// Name        : Breakthrough.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Simulador da curva de ruptura de um leito fixo com
+//               dispersao axial e forca motriz linear (LDF)
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/Parallel.h>
+#include <Misc/Trace.h>
+#include <Process/Breakthrough.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          TOLE    = 1.0e-10;      // tolerancia relativa do Newton
+const UInt          ITERMAX = 50;           // numero maximo de iteracoes
+const Real          CFLOOR  = 1.0e-12;      // menor concentracao relativa avaliada
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Breakthrough :: Breakthrough (const Isotherm&, const Real&, const Real&, const Real&, const Real&, const Real&, const UInt&, const Real&)"
+Breakthrough :: Breakthrough    (   const Isotherm&     _iso
+                                ,   const Real&         _length
+                                ,   const Real&         _velocity
+                                ,   const Real&         _dispersion
+                                ,   const Real&         _phaseRatio
+                                ,   const Real&         _kldf
+                                ,   const UInt&         _ncells
+                                ,   const Real&         _temp
+                                )
+                                :   isotherm(_iso.Clone())
+                                ,   length(_length)
+                                ,   velocity(_velocity)
+                                ,   dispersion(_dispersion)
+                                ,   phaseRatio(_phaseRatio)
+                                ,   kldf(_kldf)
+                                ,   ncells(_ncells)
+                                ,   temperature(_temp)
+{
+
+    try {
+
+        if  (   _length <= 0.0
+            ||  _velocity <= 0.0
+            ||  _dispersion < 0.0
+            ||  _phaseRatio < 0.0
+            ||  _kldf <= 0.0
+            ||  _ncells < 2
+            ) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+Breakthrough :: Breakthrough    (   const Breakthrough&     _other
+                                )
+                                :   isotherm(_other.isotherm ? _other.isotherm->Clone() : nullptr)
+                                ,   length(_other.length)
+                                ,   velocity(_other.velocity)
+                                ,   dispersion(_other.dispersion)
+                                ,   phaseRatio(_other.phaseRatio)
+                                ,   kldf(_other.kldf)
+                                ,   ncells(_other.ncells)
+                                ,   temperature(_other.temperature)
+                                ,   time(_other.time)
+                                ,   outlet(_other.outlet)
+                                ,   conc(_other.conc)
+                                ,   load(_other.load)
+{
+}
+
+Breakthrough&
+Breakthrough :: operator = (const Breakthrough& _other)
+{
+
+    if (this == &_other) return *this;
+
+    isotherm    = _other.isotherm ? _other.isotherm->Clone() : nullptr;
+    length      = _other.length;
+    velocity    = _other.velocity;
+    dispersion  = _other.dispersion;
+    phaseRatio  = _other.phaseRatio;
+    kldf        = _other.kldf;
+    ncells      = _other.ncells;
+    temperature = _other.temperature;
+    time        = _other.time;
+    outlet      = _other.outlet;
+    conc        = _other.conc;
+    load        = _other.load;
+
+    return *this;
+
+}
+
+//==============================================================================
+// Simulacao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Breakthrough :: Run (const Real&, const Real&, const UInt&)"
+void
+Breakthrough :: Run     (   const Real&     _cfeed
+                        ,   const Real&     _dt
+                        ,   const UInt&     _nsteps
+                        )
+{
+
+IST_TRACE("Breakthrough", "process");
+
+    try {
+
+        if (!isotherm) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_cfeed <= 0.0 || _dt <= 0.0 || _nsteps == 0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+const size_t    n (ncells);
+const Real      dz (length / n);
+const Real      a (dispersion / (dz * dz));
+const Real      b (velocity / dz);
+const Real      invDt (1.0 / _dt);
+const Real      relax (1.0 / (1.0 + _dt * kldf));     // 1 / (1 + dt k)
+const Real      fk (phaseRatio * kldf * relax);
+const Real      cfloor (CFLOOR * _cfeed);
+
+//  Jacobiana tridiagonal: sub e super diagonais constantes
+
+const Real      lower (- (b + a));
+const Real      upper (- a);
+
+VecReal         cOld(n, 0.0);
+VecReal         ceff(n);
+VecReal         qs(n);
+VecReal         dqs(n);
+VecReal         res(n);
+VecReal         diag(n);
+VecReal         cp(n);
+
+    conc.assign(n, 0.0);
+    load.assign(n, 0.0);
+    time.resize(_nsteps);
+    outlet.resize(_nsteps);
+
+    for (UInt step = 0; step < _nsteps; ++step) {
+
+        std::copy(conc.begin(), conc.end(), cOld.begin());
+
+    UInt    iter (0);
+    Real    delta (0.0);
+
+        for (; iter < ITERMAX; ++iter) {
+
+            for (size_t i = 0; i < n; ++i) ceff[i] = std::max(conc[i], cfloor);
+
+            isotherm->Qe(ceff, qs, temperature);
+            isotherm->DQDC(ceff, dqs, temperature);
+
+//  Residuo R = (c - c^n) / dt - L c - F k (q^n - q*(c)) / (1 + dt k)
+
+            for (size_t i = 0; i < n; ++i) {
+
+            const Real  west (i > 0 ? conc[i - 1] : _cfeed);
+            const Real  east (i + 1 < n ? conc[i + 1] : conc[i]);
+            const Real  conv (b * (west - conc[i]));
+            const Real  disp (i > 0 ? a * (east - 2.0 * conc[i] + west)
+                                    : a * (east - conc[i]));
+
+                res[i]  = (conc[i] - cOld[i]) * invDt - conv - disp + fk * (qs[i] - load[i]);
+                diag[i] = invDt + b + (i > 0 && i + 1 < n ? 2.0 : 1.0) * a + fk * dqs[i];
+            }
+
+//  Algoritmo de Thomas para J dc = - R
+
+            cp[0]   = upper / diag[0];
+            res[0]  = - res[0] / diag[0];
+
+            for (size_t i = 1; i < n; ++i) {
+
+            const Real  m (1.0 / (diag[i] - lower * cp[i - 1]));
+
+                cp[i]  = upper * m;
+                res[i] = (- res[i] - lower * res[i - 1]) * m;
+            }
+
+            for (size_t i = n - 1; i-- > 0;) res[i] -= cp[i] * res[i + 1];
+
+            delta = 0.0;
+
+            for (size_t i = 0; i < n; ++i) {
+                conc[i] += res[i];
+                qs[i]   += dqs[i] * res[i];             // q*(c) linearizado
+                delta    = std::max(delta, std::fabs(res[i]));
+            }
+
+            if (delta <= TOLE * _cfeed) break;
+        }
+
+        try {
+
+            if (iter == ITERMAX) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   ConvergenceProblem
+                                    );
+
+        } catch (const IsoException& _isoExcept) {
+
+            std::cout   << _isoExcept
+                        << "\n";
+            exit(EXIT_FAILURE);
+        }
+
+//  q^{n+1} = (q^n + dt k q*(c^{n+1})) / (1 + dt k)
+
+        for (size_t i = 0; i < n; ++i) load[i] = (load[i] + _dt * kldf * qs[i]) * relax;
+
+        time[step]   = (step + 1) * _dt;
+        outlet[step] = conc[n - 1];
+    }
+
+}
+
+//==============================================================================
+// Varredura de parametros
+//==============================================================================
+
+void
+Breakthrough :: Sweep   (   std::vector < Breakthrough >&   _cases
+                        ,   const Real&                     _cfeed
+                        ,   const Real&                     _dt
+                        ,   const UInt&                     _nsteps
+                        ,   const UInt&                     _nthreads
+                        )
+{
+
+    ParallelFor (   _cases.size()
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+                        for (size_t k = _ini; k < _fim; ++k) _cases[k].Run(_cfeed, _dt, _nsteps);
+                    }
+                ,   _nthreads
+                );
+
+}
+
+IST_NAMESPACE_CLOSE
@@ -0,0 +1,406 @@
+//==============================================================================
+// Name        : Chromatography.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Coluna cromatografica pelo modelo de equilibrio-dispersivo
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/Parallel.h>
+#include <Misc/Trace.h>
+#include <Process/Chromatography.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          TOLE    = 1.0e-12;      // tolerancia relativa da inversao
+const UInt          ITERMAX = 100;          // numero maximo de iteracoes
+const Real          CFLOOR  = 1.0e-14;      // menor concentracao relativa avaliada
+
+//  Limitador de Koren em funcao das diferencas a montante e a jusante
+
+inline Real Koren (const Real& _up, const Real& _down)
+{
+
+    if (_up * _down <= 0.0) return 0.0;
+
+const Real  r (_down / _up);
+
+    return std::max(0.0, std::min({2.0 * r, (1.0 + 2.0 * r) / 3.0, 2.0}));
+
+}
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "Chromatography :: Chromatography (const Isotherm&, const Real&, const Real&, const Real&, const Real&, const UInt&, const Real&)"
+Chromatography :: Chromatography    (   const Isotherm&     _iso
+                                    ,   const Real&         _length
+                                    ,   const Real&         _velocity
+                                    ,   const Real&         _dispersion
+                                    ,   const Real&         _phaseRatio
+                                    ,   const UInt&         _ncells
+                                    ,   const Real&         _temp
+                                    )
+                                    :   isotherm(_iso.Clone())
+                                    ,   length(_length)
+                                    ,   velocity(_velocity)
+                                    ,   dispersion(_dispersion)
+                                    ,   phaseRatio(_phaseRatio)
+                                    ,   ncells(_ncells)
+                                    ,   temperature(_temp)
+{
+
+    try {
+
+        if  (   _length <= 0.0
+            ||  _velocity <= 0.0
+            ||  _dispersion < 0.0
+            ||  _phaseRatio < 0.0
+            ||  _ncells < 2
+            ) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+Chromatography :: Chromatography    (   const Chromatography&   _other
+                                    )
+                                    :   isotherm(_other.isotherm ? _other.isotherm->Clone() : nullptr)
+                                    ,   length(_other.length)
+                                    ,   velocity(_other.velocity)
+                                    ,   dispersion(_other.dispersion)
+                                    ,   phaseRatio(_other.phaseRatio)
+                                    ,   ncells(_other.ncells)
+                                    ,   temperature(_other.temperature)
+                                    ,   time(_other.time)
+                                    ,   outlet(_other.outlet)
+                                    ,   conc(_other.conc)
+{
+}
+
+Chromatography&
+Chromatography :: operator = (const Chromatography& _other)
+{
+
+    if (this == &_other) return *this;
+
+    isotherm    = _other.isotherm ? _other.isotherm->Clone() : nullptr;
+    length      = _other.length;
+    velocity    = _other.velocity;
+    dispersion  = _other.dispersion;
+    phaseRatio  = _other.phaseRatio;
+    ncells      = _other.ncells;
+    temperature = _other.temperature;
+    time        = _other.time;
+    outlet      = _other.outlet;
+    conc        = _other.conc;
+
+    return *this;
+
+}
+
+//==============================================================================
+// Alimentacao
+//==============================================================================
+
+Real
+Chromatography :: Feed  (   const Schedule&     _schedule
+                        ,   const Real&         _t
+                        )
+{
+
+Real    cin (0.0);
+
+    for (const auto& inj : _schedule)
+        if (_t >= inj.start && _t < inj.start + inj.width) cin += inj.concentration;
+
+    return cin;
+
+}
+
+//==============================================================================
+// Discretizacao espacial
+//==============================================================================
+
+void
+Chromatography :: Rate  (   const VecReal&      _c
+                        ,   const Real&         _cin
+                        ,   VecReal&            _dndt
+                        ) const
+{
+
+const size_t    n (ncells);
+const Real      dz (length / n);
+const Real      a (dispersion / dz);
+Real            fluxWest (velocity * _cin);     // Danckwerts: fluxo total u c_in
+
+    for (size_t i = 0; i < n; ++i) {
+
+    const Real  west (i > 0 ? _c[i - 1] : _cin);
+    const Real  east (i + 1 < n ? _c[i + 1] : _c[i]);
+    const Real  up (_c[i] - west);
+    const Real  face (_c[i] + 0.5 * Koren(up, east - _c[i]) * up);
+    const Real  fluxEast (velocity * face - (i + 1 < n ? a * (east - _c[i]) : 0.0));
+
+        _dndt[i] = (fluxWest - fluxEast) / dz;
+        fluxWest = fluxEast;
+    }
+
+}
+
+//==============================================================================
+// Recuperacao de c a partir de n = c + F Qe(c)
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Chromatography :: Invert (const VecReal&, const Real&, VecReal&)"
+void
+Chromatography :: Invert    (   const VecReal&      _ntot
+                            ,   const Real&         _cref
+                            ,   VecReal&            _c
+                            )
+{
+
+const size_t    n (ncells);
+const Real      cfloor (CFLOOR * _cref);
+
+    for (size_t i = 0; i < n; ++i) {
+        lower[i] = 0.0;
+        upper[i] = std::max(_ntot[i], 0.0);
+        _c[i]    = std::clamp(_c[i], 0.0, upper[i]);
+    }
+
+UInt    iter (0);
+
+    for (; iter < ITERMAX; ++iter) {
+
+        for (size_t i = 0; i < n; ++i) ceff[i] = std::max(_c[i], cfloor);
+
+        isotherm->Qe(ceff, qs, temperature);
+        isotherm->DQDC(ceff, dqs, temperature);
+
+    Real    delta (0.0);
+
+        for (size_t i = 0; i < n; ++i) {
+
+            if (upper[i] <= 0.0) {
+                _c[i] = 0.0;
+                continue;
+            }
+
+        const Real  res (_c[i] + phaseRatio * qs[i] - _ntot[i]);
+
+            if (res > 0.0) upper[i] = _c[i];
+            else lower[i] = _c[i];
+
+        Real    cnew (_c[i] - res / (1.0 + phaseRatio * dqs[i]));
+
+            if (!(cnew >= lower[i] && cnew <= upper[i])) cnew = 0.5 * (lower[i] + upper[i]);
+
+            delta = std::max(delta, std::fabs(cnew - _c[i]));
+            _c[i] = cnew;
+        }
+
+        if (delta <= TOLE * _cref) break;
+    }
+
+    try {
+
+        if (iter == ITERMAX) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Simulacao
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Chromatography :: Run (const Schedule&, const Real&, const Real&)"
+void
+Chromatography :: Run   (   const Schedule&     _schedule
+                        ,   const Real&         _tend
+                        ,   const Real&         _cfl
+                        )
+{
+
+IST_TRACE("Chromatography", "process");
+
+Real    cref (0.0);
+
+    for (const auto& inj : _schedule) cref = std::max(cref, inj.concentration);
+
+    try {
+
+        if (!isotherm) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (_schedule.empty() || cref <= 0.0 || _tend <= 0.0 || _cfl <= 0.0 || _cfl > 1.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+        for (const auto& inj : _schedule)
+            if (inj.start < 0.0 || inj.width <= 0.0 || inj.concentration < 0.0) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+//  Passo limitado por conveccao e difusao explicitas (dc/dn <= 1)
+
+const size_t    n (ncells);
+const Real      dz (length / n);
+const Real      dtmax (_cfl / (velocity / dz + 2.0 * dispersion / (dz * dz)));
+const size_t    nsteps (size_t(std::ceil(_tend / dtmax)));
+const Real      dt (_tend / nsteps);
+
+VecReal         ntot(n, 0.0);
+VecReal         nstage(n);
+VecReal         cstage(n);
+VecReal         rate(n);
+
+    ceff.resize(n);
+    qs.resize(n);
+    dqs.resize(n);
+    lower.resize(n);
+    upper.resize(n);
+
+    conc.assign(n, 0.0);
+    time.resize(nsteps);
+    outlet.resize(nsteps);
+
+    for (size_t step = 0; step < nsteps; ++step) {
+
+    const Real  t (step * dt);
+
+//  Runge-Kutta SSP de terceira ordem (Shu-Osher)
+
+        Rate(conc, Feed(_schedule, t), rate);
+        for (size_t i = 0; i < n; ++i) nstage[i] = ntot[i] + dt * rate[i];
+        cstage = conc;
+        Invert(nstage, cref, cstage);
+
+        Rate(cstage, Feed(_schedule, t + dt), rate);
+        for (size_t i = 0; i < n; ++i) nstage[i] = 0.75 * ntot[i] + 0.25 * (nstage[i] + dt * rate[i]);
+        Invert(nstage, cref, cstage);
+
+        Rate(cstage, Feed(_schedule, t + 0.5 * dt), rate);
+        for (size_t i = 0; i < n; ++i) ntot[i] = (ntot[i] + 2.0 * (nstage[i] + dt * rate[i])) / 3.0;
+        conc = cstage;
+        Invert(ntot, cref, conc);
+
+        time[step]   = t + dt;
+        outlet[step] = conc[n - 1];
+    }
+
+}
+
+//==============================================================================
+// Varredura de cronogramas
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void Chromatography :: Sweep (std::vector < Chromatography >&, const std::vector < Schedule >&, const Real&, const Real&, const UInt&)"
+void
+Chromatography :: Sweep (   std::vector < Chromatography >&     _cases
+                        ,   const std::vector < Schedule >&     _schedules
+                        ,   const Real&                         _tend
+                        ,   const Real&                         _cfl
+                        ,   const UInt&                         _nthreads
+                        )
+{
+
+    try {
+
+        if (_cases.size() != _schedules.size()) throw
+                IsoException    (   IST_LOC
+                                ,   "Chromatography"
+                                ,   BadCompositionSize
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    ParallelFor (   _cases.size()
+                ,   [&](const size_t& _ini, const size_t& _fim) {
+                        for (size_t k = _ini; k < _fim; ++k) _cases[k].Run(_schedules[k], _tend, _cfl);
+                    }
+                ,   _nthreads
+                );
+
+}
+
+IST_NAMESPACE_CLOSE
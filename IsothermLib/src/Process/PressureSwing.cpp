@@ -0,0 +1,553 @@
+//==============================================================================
+// Name        : PressureSwing.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Ciclo de adsorcao com modulacao de pressao (PSA, Skarstrom)
+//               com aceleracao do estado estacionario ciclico
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <numeric>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Misc/LinearSystem.h>
+#include <Misc/Trace.h>
+#include <Multicomponent/IAST.h>
+#include <Process/PressureSwing.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Constantes do metodo
+//==============================================================================
+
+namespace {
+
+const Real          CFL     = 0.5;          // numero de Courant
+const Real          REGUL   = 1.0e-10;      // regularizacao dos minimos quadrados
+const Real          RGAS    = 8.31446261815324; // constante dos gases [J/(mol K)]
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+PressureSwing :: PressureSwing  (   const Multicomponent&   _mix
+                                ,   const Bed&              _bed
+                                ,   const Cycle&            _cycle
+                                ,   const UInt&             _ncells
+                                )
+                                :   mixture(_mix.Clone())
+                                ,   bed(_bed)
+                                ,   cycle(_cycle)
+                                ,   ncells(_ncells)
+                                ,   ncomp(_mix.NumberComponents())
+{
+
+//  O leito ja avalia todas as celulas em bloco: a IAST roda em uma thread
+
+    if (auto iast = dynamic_cast<IAST*>(mixture.get())) iast->Threads(1);
+
+    Check();
+
+}
+
+PressureSwing :: PressureSwing  (   const std::vector < const Isotherm* >&  _pure
+                                ,   const Bed&                              _bed
+                                ,   const Cycle&                            _cycle
+                                ,   const UInt&                             _ncells
+                                )
+                                :   PressureSwing(IAST(_pure), _bed, _cycle, _ncells)
+{
+}
+
+PressureSwing :: PressureSwing  (   const PressureSwing&    _other
+                                )
+                                :   mixture(_other.mixture ? _other.mixture->Clone() : nullptr)
+                                ,   bed(_other.bed)
+                                ,   cycle(_other.cycle)
+                                ,   ncells(_other.ncells)
+                                ,   ncomp(_other.ncomp)
+                                ,   qref(_other.qref)
+                                ,   residuals(_other.residuals)
+                                ,   yBed(_other.yBed)
+                                ,   qBed(_other.qBed)
+                                ,   feedIn(_other.feedIn)
+                                ,   productOut(_other.productOut)
+                                ,   purgeIn(_other.purgeIn)
+                                ,   wasteOut(_other.wasteOut)
+{
+}
+
+PressureSwing&
+PressureSwing :: operator = (const PressureSwing& _other)
+{
+
+    if (this == &_other) return *this;
+
+    mixture     = _other.mixture ? _other.mixture->Clone() : nullptr;
+    bed         = _other.bed;
+    cycle       = _other.cycle;
+    ncells      = _other.ncells;
+    ncomp       = _other.ncomp;
+    qref        = _other.qref;
+    residuals   = _other.residuals;
+    yBed        = _other.yBed;
+    qBed        = _other.qBed;
+    feedIn      = _other.feedIn;
+    productOut  = _other.productOut;
+    purgeIn     = _other.purgeIn;
+    wasteOut    = _other.wasteOut;
+
+    return *this;
+
+}
+
+//==============================================================================
+// Verificacao dos dados
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void PressureSwing :: Check () const"
+void
+PressureSwing :: Check () const
+{
+
+    try {
+
+        if (!mixture) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (bed.kldf.size() != ncomp || cycle.yFeed.size() != ncomp) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadNumberComponents
+                                );
+
+    const Real  ysum (std::accumulate(cycle.yFeed.begin(), cycle.yFeed.end(), 0.0));
+
+        if  (   bed.length <= 0.0
+            ||  bed.voidage <= 0.0
+            ||  bed.voidage >= 1.0
+            ||  bed.density <= 0.0
+            ||  bed.temperature <= 0.0
+            ||  *std::min_element(bed.kldf.begin(), bed.kldf.end()) <= 0.0
+            ||  cycle.pLow <= 0.0
+            ||  cycle.pHigh <= cycle.pLow
+            ||  *std::min_element(cycle.yFeed.begin(), cycle.yFeed.end()) < 0.0
+            ||  std::fabs(ysum - 1.0) > 1.0e-8
+            ||  cycle.vFeed <= 0.0
+            ||  cycle.vPurge < 0.0
+            ||  cycle.tPress <= 0.0
+            ||  cycle.tAds <= 0.0
+            ||  cycle.tBlow <= 0.0
+            ||  cycle.tPurge < 0.0
+            ||  ncells < 2
+            ) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Etapas do ciclo
+//==============================================================================
+
+void
+PressureSwing :: Step   (   const StepKind&     _kind
+                        ,   const Real&         _duration
+                        ,   const VecReal&      _yPurge
+                        )
+{
+
+const size_t    n (ncells);
+const Real      rt (RGAS * bed.temperature);
+const Real      phase (bed.density / bed.voidage);
+const Real      dz (bed.length / n);
+
+//  Pressao linear no tempo nas etapas de pressurizacao e despressurizacao
+
+const Real      p0 (_kind == Pressurization || _kind == Purge ? cycle.pLow : cycle.pHigh);
+const Real      p1 (_kind == Pressurization || _kind == Adsorption ? cycle.pHigh : cycle.pLow);
+const Real      dcdt ((p1 - p0) / (_duration * rt));
+
+VecReal         vel(n + 1);
+VecReal         source(n);
+VecVecReal      dq(ncomp, VecReal(n));
+VecVecReal      flux(ncomp, VecReal(n + 1));
+
+//  Velocidade nas faces pelo balanco molar total; a adsorcao parte da
+//  alimentacao e as demais etapas da extremidade de produto
+
+auto velocity = [&](const Real& _conc) {
+
+        if (_kind == Adsorption) {
+            vel[0] = cycle.vFeed;
+            for (size_t j = 0; j < n; ++j) vel[j + 1] = vel[j] - dz * (dcdt + source[j]) / _conc;
+        }
+        else {
+            vel[n] = _kind == Purge ? - cycle.vPurge : 0.0;
+            for (size_t j = n; j-- > 0;) vel[j] = vel[j + 1] + dz * (dcdt + source[j]) / _conc;
+        }
+    };
+
+Real            t (0.0);
+
+    while (t < _duration * (1.0 - 1.0e-12)) {
+
+    const Real  p (p0 + (p1 - p0) * t / _duration);
+    const Real  conc (p / rt);
+
+        for (size_t i = 0; i < ncomp; ++i)
+            for (size_t j = 0; j < n; ++j) pPartial[i][j] = yBed[i][j] * p;
+
+        mixture->Qe(pPartial, qStar, bed.temperature);
+
+//  Passo de tempo a partir da taxa LDF inicial
+
+        for (size_t j = 0; j < n; ++j) {
+            source[j] = 0.0;
+            for (size_t i = 0; i < ncomp; ++i) source[j] += phase * bed.kldf[i] * (qStar[i][j] - qBed[i][j]);
+        }
+
+        velocity(conc);
+
+//  Passo limitado pela conveccao e pela troca com o solido: a inclinacao
+//  secante q*/c limita dq*/dc em isotermas favoraveis
+
+    Real        dt (_duration - t);
+
+        for (const auto& v : vel)
+            if (v != 0.0) dt = std::min(dt, CFL * dz / std::fabs(v));
+
+        for (size_t i = 0; i < ncomp; ++i)
+            for (size_t j = 0; j < n; ++j)
+                if (qStar[i][j] > 0.0)
+                    dt = std::min(dt, CFL * conc * yBed[i][j] / (phase * bed.kldf[i] * qStar[i][j]));
+
+//  LDF integrado exatamente no passo; a velocidade usa a mesma variacao
+
+        for (size_t j = 0; j < n; ++j) source[j] = 0.0;
+
+        for (size_t i = 0; i < ncomp; ++i) {
+
+        const Real  decay (1.0 - std::exp(- bed.kldf[i] * dt));
+
+            for (size_t j = 0; j < n; ++j) {
+                dq[i][j]   = (qStar[i][j] - qBed[i][j]) * decay;
+                source[j] += phase * dq[i][j] / dt;
+            }
+        }
+
+        velocity(conc);
+
+//  Fluxos upwind por componente. Fora da purga, o refluxo pela extremidade
+//  de produto tem a composicao da ultima celula
+
+        for (size_t i = 0; i < ncomp; ++i) {
+
+            flux[i][0] = vel[0] * conc * (vel[0] > 0.0 ? cycle.yFeed[i] : yBed[i][0]);
+
+            for (size_t f = 1; f < n; ++f)
+                flux[i][f] = vel[f] * conc * (vel[f] > 0.0 ? yBed[i][f - 1] : yBed[i][f]);
+
+            flux[i][n] = vel[n] * conc * (vel[n] < 0.0 && _kind == Purge ? _yPurge[i] : yBed[i][n - 1]);
+        }
+
+//  Balanco por componente e novas fracoes molares
+
+        for (size_t j = 0; j < n; ++j) {
+
+        Real    total (0.0);
+
+            for (size_t i = 0; i < ncomp; ++i) {
+
+            const Real  c (conc * yBed[i][j] - dt * (flux[i][j + 1] - flux[i][j]) / dz - phase * dq[i][j]);
+
+                yBed[i][j]  = std::max(c, 0.0);
+                qBed[i][j] += dq[i][j];
+                total      += yBed[i][j];
+            }
+
+            for (size_t i = 0; i < ncomp; ++i) yBed[i][j] = total > 0.0 ? yBed[i][j] / total : cycle.yFeed[i];
+        }
+
+//  Mols que cruzam as extremidades
+
+        for (size_t i = 0; i < ncomp; ++i) {
+
+            if (vel[0] > 0.0) feedIn[i] += dt * flux[i][0];
+            else wasteOut[i] -= dt * flux[i][0];
+
+            if (vel[n] > 0.0) productOut[i] += dt * flux[i][n];
+            else purgeIn[i] -= dt * flux[i][n];
+        }
+
+        t += dt;
+    }
+
+}
+
+//==============================================================================
+// Mapa de um ciclo
+//==============================================================================
+
+void
+PressureSwing :: CycleMap (VecReal& _x)
+{
+
+const size_t    n (ncells);
+
+    for (size_t i = 0; i < ncomp; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            yBed[i][j] = _x[i * n + j];
+            qBed[i][j] = _x[(ncomp + i) * n + j] * qref;
+        }
+
+    std::fill(feedIn.begin(), feedIn.end(), 0.0);
+    std::fill(productOut.begin(), productOut.end(), 0.0);
+    std::fill(purgeIn.begin(), purgeIn.end(), 0.0);
+    std::fill(wasteOut.begin(), wasteOut.end(), 0.0);
+
+    Step(Pressurization, cycle.tPress, cycle.yFeed);
+    Step(Adsorption, cycle.tAds, cycle.yFeed);
+
+//  A purga usa a composicao media do produto da adsorcao
+
+const Real      product (std::accumulate(productOut.begin(), productOut.end(), 0.0));
+VecReal         yPurge (cycle.yFeed);
+
+    if (product > 0.0)
+        for (size_t i = 0; i < ncomp; ++i) yPurge[i] = productOut[i] / product;
+
+    Step(Blowdown, cycle.tBlow, yPurge);
+
+    if (cycle.tPurge > 0.0) Step(Purge, cycle.tPurge, yPurge);
+
+    for (size_t i = 0; i < ncomp; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            _x[i * n + j]           = yBed[i][j];
+            _x[(ncomp + i) * n + j] = qBed[i][j] / qref;
+        }
+
+}
+
+//==============================================================================
+// Estado estacionario ciclico
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "UInt PressureSwing :: Solve (const UInt&, const Real&, const UInt&)"
+UInt
+PressureSwing :: Solve  (   const UInt&     _maxCycles
+                        ,   const Real&     _tole
+                        ,   const UInt&     _memory
+                        )
+{
+
+IST_TRACE("PressureSwing", "process");
+
+    Check();
+
+const size_t    n (ncells);
+const size_t    nvar (2 * ncomp * n);
+
+    yBed.assign(ncomp, VecReal(n));
+    qBed.assign(ncomp, VecReal(n));
+    pPartial.assign(ncomp, VecReal(n));
+    qStar.assign(ncomp, VecReal(n));
+    feedIn.assign(ncomp, 0.0);
+    productOut.assign(ncomp, 0.0);
+    purgeIn.assign(ncomp, 0.0);
+    wasteOut.assign(ncomp, 0.0);
+    residuals.clear();
+
+//  Leito inicial em equilibrio com a alimentacao a pressao baixa
+
+VecReal         pfeed (cycle.yFeed);
+
+    for (auto& p : pfeed) p *= cycle.pHigh;
+
+const VecReal   qhigh (mixture->Qe(pfeed, bed.temperature));
+
+    qref = std::max(*std::max_element(qhigh.begin(), qhigh.end()), 1.0e-30);
+
+    for (auto& p : pfeed) p *= cycle.pLow / cycle.pHigh;
+
+const VecReal   qlow (mixture->Qe(pfeed, bed.temperature));
+VecReal         x(nvar);
+
+    for (size_t i = 0; i < ncomp; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            x[i * n + j]           = cycle.yFeed[i];
+            x[(ncomp + i) * n + j] = qlow[i] / qref;
+        }
+
+//  Aceleracao de Anderson: x_{k+1} = g_k - dG gamma, com gamma que minimiza
+//  |f_k - dF gamma|, f = G(x) - x
+
+std::deque<VecReal>     dF;
+std::deque<VecReal>     dG;
+VecReal                 g(nvar), f(nvar), fOld, gOld;
+
+    for (UInt iter = 1; iter <= _maxCycles; ++iter) {
+
+        g = x;
+        CycleMap(g);
+
+    Real    res (0.0);
+
+        for (size_t k = 0; k < nvar; ++k) {
+            f[k] = g[k] - x[k];
+            res  = std::max(res, std::fabs(f[k]));
+        }
+
+        residuals.push_back(res);
+
+        if (res <= _tole) return iter;
+
+        if (_memory == 0) {
+            x = g;
+            continue;
+        }
+
+        if (!fOld.empty()) {
+
+        VecReal     df(nvar), dg(nvar);
+
+            for (size_t k = 0; k < nvar; ++k) {
+                df[k] = f[k] - fOld[k];
+                dg[k] = g[k] - gOld[k];
+            }
+
+            dF.push_back(df);
+            dG.push_back(dg);
+
+            if (dF.size() > _memory) {
+                dF.pop_front();
+                dG.pop_front();
+            }
+        }
+
+        fOld = f;
+        gOld = g;
+        x    = g;
+
+        if (dF.empty()) continue;
+
+    const size_t    m (dF.size());
+    VecVecReal      a(m, VecReal(m));
+    VecReal         b(m);
+    Real            trace (0.0);
+
+        for (size_t r = 0; r < m; ++r) {
+            b[r] = std::inner_product(dF[r].begin(), dF[r].end(), f.begin(), 0.0);
+            for (size_t c = 0; c <= r; ++c)
+                a[r][c] = a[c][r] = std::inner_product(dF[r].begin(), dF[r].end(), dF[c].begin(), 0.0);
+            trace += a[r][r];
+        }
+
+        for (size_t r = 0; r < m; ++r) a[r][r] += REGUL * trace;
+
+//  Sistema singular: mantem o passo de ponto fixo x = g e reinicia o historico
+
+        if (!GaussElimination(a, b)) {
+            dF.clear();
+            dG.clear();
+            continue;
+        }
+
+        for (size_t r = 0; r < m; ++r)
+            for (size_t k = 0; k < nvar; ++k) x[k] -= b[r] * dG[r][k];
+
+//  Projecao: fracoes molares normalizadas e cargas nao negativas
+
+        for (size_t j = 0; j < n; ++j) {
+
+        Real    total (0.0);
+
+            for (size_t i = 0; i < ncomp; ++i) total += (x[i * n + j] = std::max(x[i * n + j], 0.0));
+            for (size_t i = 0; i < ncomp; ++i) x[i * n + j] = total > 0.0 ? x[i * n + j] / total : cycle.yFeed[i];
+            for (size_t i = 0; i < ncomp; ++i) x[(ncomp + i) * n + j] = std::max(x[(ncomp + i) * n + j], 0.0);
+        }
+    }
+
+    try {
+
+        throw   IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Desempenho do ciclo
+//==============================================================================
+
+Real
+PressureSwing :: Purity (const UInt& _i) const
+{
+
+const Real  total (std::accumulate(productOut.begin(), productOut.end(), 0.0));
+
+    return total > 0.0 ? productOut.at(_i) / total : 0.0;
+
+}
+
+Real
+PressureSwing :: Recovery (const UInt& _i) const
+{
+
+    return feedIn.at(_i) > 0.0 ? (productOut.at(_i) - purgeIn.at(_i)) / feedIn.at(_i) : 0.0;
+
+}
+
+IST_NAMESPACE_CLOSE
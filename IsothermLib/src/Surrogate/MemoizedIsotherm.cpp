@@ -0,0 +1,357 @@
+//==============================================================================
+// Name        : MemoizedIsotherm.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Isoterma que memoriza os valores de Qe de outra isoterma
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <bit>
+#include <iostream>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Surrogate/MemoizedIsotherm.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Variaveis estaticas
+//==============================================================================
+
+VecPairString       detailsMemoizedIsotherm
+    {
+        PairString  ( "Budget"
+                    , "Limite de memoria em bytes")
+    ,   PairString  ( "Shards"
+                    , "Numero de particoes da memoria")
+    };
+
+template<>
+VecPairString IsothermTemplate < MemoizedIsotherm >::infoIsotherm = detailsMemoizedIsotherm;
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+namespace {
+
+//  Memoria estimada de um valor: Entry (Ce, T e Qe) no no da lista, com dois
+//  ponteiros, e chave, iterador, ponteiro e hash no no do indice, mais o
+//  ponteiro do balde
+
+const size_t        ENTRYBYTES  =   3 * sizeof(Real) + 2 * sizeof(void*)
+                                +   2 * sizeof(Real) + 2 * sizeof(void*) + sizeof(size_t)
+                                +   sizeof(void*);
+
+//  Mistura de bits de splitmix64
+
+inline std::uint64_t Mix (std::uint64_t _x)
+{
+
+    _x ^= _x >> 30;
+    _x *= 0xbf58476d1ce4e5b9ULL;
+    _x ^= _x >> 27;
+    _x *= 0x94d049bb133111ebULL;
+    _x ^= _x >> 31;
+
+    return _x;
+
+}
+
+}
+
+//==============================================================================
+// Chave da memoria
+//==============================================================================
+
+bool
+MemoizedIsotherm :: Key :: operator == (const Key& _other) const
+{
+
+    return  std::bit_cast<std::uint64_t>(ce) == std::bit_cast<std::uint64_t>(_other.ce)
+        &&  std::bit_cast<std::uint64_t>(temperature) == std::bit_cast<std::uint64_t>(_other.temperature);
+
+}
+
+size_t
+MemoizedIsotherm :: KeyHash :: operator () (const Key& _key) const
+{
+
+    return Mix(std::bit_cast<std::uint64_t>(_key.ce) ^ Mix(std::bit_cast<std::uint64_t>(_key.temperature)));
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "MemoizedIsotherm :: MemoizedIsotherm (const Isotherm&, const size_t&, const UInt&)"
+MemoizedIsotherm :: MemoizedIsotherm    (   const Isotherm&     _iso
+                                        ,   const size_t&       _budget
+                                        ,   const UInt&         _nshard
+                                        )
+{
+
+    try {
+
+        if (_nshard == 0 || _budget / _nshard < ENTRYBYTES) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadParameter
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    coeffValue = {static_cast<Real>(_budget), static_cast<Real>(_nshard)};
+    capacity   = _budget / (_nshard * ENTRYBYTES);
+
+    model = _iso.Clone();
+    shards.resize(_nshard);
+
+    for (auto& shard : shards) shard = std::make_unique<Shard>();
+
+    setup = true;
+
+}
+
+MemoizedIsotherm :: MemoizedIsotherm (const MemoizedIsotherm& _other)
+                                    :   Isotherm(_other)
+                                    ,   IsothermTemplate < MemoizedIsotherm > (_other)
+{
+
+    Copy(_other);
+
+}
+
+MemoizedIsotherm&
+MemoizedIsotherm :: operator = (const MemoizedIsotherm& _other)
+{
+
+    if (this == &_other) return *this;
+
+    Isotherm::operator = (_other);
+    Copy(_other);
+
+    return *this;
+
+}
+
+void
+MemoizedIsotherm :: Copy (const MemoizedIsotherm& _other)
+{
+
+    capacity = _other.capacity;
+    model    = _other.model ? _other.model->Clone() : nullptr;
+
+    shards.clear();
+    shards.resize(_other.shards.size());
+
+    for (auto& shard : shards) shard = std::make_unique<Shard>();
+
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+
+}
+
+//==============================================================================
+// Verificacoes
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void MemoizedIsotherm :: Check () const"
+void
+MemoizedIsotherm :: Check () const
+{
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+MemoizedIsotherm::Shard&
+MemoizedIsotherm :: Locate (const Key& _key) const
+{
+
+    Check();
+
+//  Particao pelos bits altos do hash; os baixos escolhem o balde do indice
+
+    return *shards[(KeyHash()(_key) >> 32) % shards.size()];
+
+}
+
+//==============================================================================
+// Consultas
+//==============================================================================
+
+Real
+MemoizedIsotherm :: Qe  (   const Real&     _c
+                        ,   const Real&     _temp
+                        ) const
+{
+
+const Key                       key {_c, _temp};
+Shard&                          shard (Locate(key));
+
+    {
+    std::lock_guard < std::mutex >  lock (shard.mutex);
+
+        if (const auto it = shard.index.find(key); it != shard.index.end()) {
+
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            hits.fetch_add(1, std::memory_order_relaxed);
+
+            return it->second->qe;
+        }
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+
+//  O modelo e avaliado sem a trava; outra thread pode ter gravado o mesmo
+//  valor nesse intervalo
+
+const Real                      qe (model->Qe(_c, _temp));
+std::lock_guard < std::mutex >  lock (shard.mutex);
+
+    if (shard.index.contains(key)) return qe;
+
+    shard.lru.push_front(Entry {key, qe});
+    shard.index.emplace(key, shard.lru.begin());
+
+    if (shard.lru.size() > capacity) {
+        shard.index.erase(shard.lru.back().key);
+        shard.lru.pop_back();
+    }
+
+    return qe;
+
+}
+
+Real
+MemoizedIsotherm :: DQDC    (   const Real&     _c
+                            ,   const Real&     _temp
+                            ) const
+{
+
+    Check();
+
+    return model->DQDC(_c, _temp);
+
+}
+
+Real
+MemoizedIsotherm :: Ce  (   const Real&     _qe
+                        ,   const Real&     _temp
+                        ) const
+{
+
+    Check();
+
+    return model->Ce(_qe, _temp);
+
+}
+
+bool
+MemoizedIsotherm :: ExplicitCe  (   const Real&     _qe
+                                ,   const Real&     _temp
+                                ,   Real&           _ce
+                                ,   Real&           _dcdq
+                                ) const
+{
+
+    Check();
+
+    return model->ExplicitCe(_qe, _temp, _ce, _dcdq);
+
+}
+
+//==============================================================================
+// Acesso aos dados da memoria
+//==============================================================================
+
+size_t
+MemoizedIsotherm :: Size () const
+{
+
+size_t  size (0);
+
+    for (const auto& shard : shards) {
+
+    std::lock_guard < std::mutex >  lock (shard->mutex);
+
+        size += shard->lru.size();
+    }
+
+    return size;
+
+}
+
+void
+MemoizedIsotherm :: Clear ()
+{
+
+    for (auto& shard : shards) {
+
+    std::lock_guard < std::mutex >  lock (shard->mutex);
+
+        shard->index.clear();
+        shard->lru.clear();
+    }
+
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+
+}
+
+const Isotherm&
+MemoizedIsotherm :: Model () const
+{
+
+    Check();
+
+    return *model;
+
+}
+
+IST_NAMESPACE_CLOSE
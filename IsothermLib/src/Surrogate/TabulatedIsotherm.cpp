@@ -0,0 +1,714 @@
+//==============================================================================
+// Name        : TabulatedIsotherm.cpp
+// Author      : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Isoterma tabelada com controle de erro, substituta de modelos
+//               de avaliacao cara
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// includes lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numbers>
+
+//==============================================================================
+// includes da lib IsothermLib
+//==============================================================================
+
+#include <Error/IsoException.h>
+#include <Surrogate/TabulatedIsotherm.h>
+
+IST_NAMESPACE_OPEN
+
+//==============================================================================
+// Variaveis estaticas
+//==============================================================================
+
+VecPairString       detailsTabulatedIsotherm
+    {
+        PairString  ( "Cmin"
+                    , "Menor concentracao tabelada")
+    ,   PairString  ( "Cmax"
+                    , "Maior concentracao tabelada")
+    ,   PairString  ( "Tmin"
+                    , "Menor temperatura tabelada")
+    ,   PairString  ( "Tmax"
+                    , "Maior temperatura tabelada")
+    ,   PairString  ( "Tole"
+                    , "Tolerancia do erro relativo em Qe")
+    };
+
+template<>
+VecPairString IsothermTemplate < TabulatedIsotherm >::infoIsotherm = detailsTabulatedIsotherm;
+
+//==============================================================================
+// Constantes
+//==============================================================================
+
+namespace {
+
+const UInt          NINIT    = 16;          // intervalos iniciais em ln(c)
+const UInt          MAXDEPTH = 30;          // profundidade maxima de subdivisao
+const UInt          NTINIT   = 3;           // nos de temperatura iniciais
+const UInt          NTMAX    = 65;          // maximo de nos de temperatura
+const size_t        BLOCK    = 64;          // pontos por bloco na avaliacao em bloco
+
+//  Spline cubica de Hermite no intervalo [x0, x0 + h] e sua derivada
+
+inline Real Hermite (   const Real&     _t
+                    ,   const Real&     _h
+                    ,   const Real&     _y0
+                    ,   const Real&     _d0
+                    ,   const Real&     _y1
+                    ,   const Real&     _d1
+                    )
+{
+
+const Real  t2 (_t * _t);
+const Real  t3 (t2 * _t);
+
+    return  (2.0 * t3 - 3.0 * t2 + 1.0) * _y0
+        +   (t3 - 2.0 * t2 + _t) * _h * _d0
+        +   (- 2.0 * t3 + 3.0 * t2) * _y1
+        +   (t3 - t2) * _h * _d1;
+
+}
+
+inline Real HermiteDerivative   (   const Real&     _t
+                                ,   const Real&     _h
+                                ,   const Real&     _y0
+                                ,   const Real&     _d0
+                                ,   const Real&     _y1
+                                ,   const Real&     _d1
+                                )
+{
+
+const Real  t2 (_t * _t);
+
+    return  (   (6.0 * t2 - 6.0 * _t) * (_y0 - _y1) / _h
+            +   (3.0 * t2 - 4.0 * _t + 1.0) * _d0
+            +   (3.0 * t2 - 2.0 * _t) * _d1
+            );
+
+}
+
+}
+
+//==============================================================================
+// Construtoras
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "TabulatedIsotherm :: TabulatedIsotherm (const Isotherm&, const Real&, const Real&, const Real&, const Real&)"
+TabulatedIsotherm :: TabulatedIsotherm  (   const Isotherm&     _iso
+                                        ,   const Real&         _cmin
+                                        ,   const Real&         _cmax
+                                        ,   const Real&         _tole
+                                        ,   const Real&         _temp
+                                        )
+{
+
+    try {
+
+        if (!(_cmin > 0.0) || !(_cmax > _cmin) || !(_tole > 0.0)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    coeffValue = {_cmin, _cmax, _temp, _temp, _tole};
+    errorBound = Build(_iso, 1);
+
+    try {
+
+        if (!(errorBound <= _tole)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    setup = true;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "TabulatedIsotherm :: TabulatedIsotherm (const Isotherm&, const Real&, const Real&, const Real&, const Real&, const Real&)"
+TabulatedIsotherm :: TabulatedIsotherm  (   const Isotherm&     _iso
+                                        ,   const Real&         _cmin
+                                        ,   const Real&         _cmax
+                                        ,   const Real&         _tmin
+                                        ,   const Real&         _tmax
+                                        ,   const Real&         _tole
+                                        )
+{
+
+    try {
+
+        if (!(_cmin > 0.0) || !(_cmax > _cmin) || !(_tole > 0.0)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+        if (!(_tmin > 0.0) || !(_tmax > _tmin)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadTempLEZero
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    coeffValue = {_cmin, _cmax, _tmin, _tmax, _tole};
+
+//  Nos de Chebyshev-Lobatto aninhados: 3, 5, 9, ... ate atingir a tolerancia
+
+    for (UInt nt = NTINIT; nt <= NTMAX; nt = 2 * nt - 1) {
+        errorBound = Build(_iso, nt);
+        if (errorBound <= _tole) break;
+    }
+
+    try {
+
+        if (!(errorBound <= _tole)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   ConvergenceProblem
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    setup = true;
+
+}
+
+//==============================================================================
+// Construcao da tabela
+//==============================================================================
+
+Real
+TabulatedIsotherm :: Build  (   const Isotherm&     _iso
+                            ,   const UInt&         _nt
+                            )
+{
+
+//  Nos de temperatura e pesos baricentricos de Chebyshev-Lobatto
+
+    nodeT.assign(_nt, Tmin());
+    baryT.assign(_nt, 1.0);
+
+    for (UInt j = 0; j < _nt && _nt > 1; ++j) {
+        nodeT[j] = 0.5 * (Tmin() + Tmax()) - 0.5 * (Tmax() - Tmin()) * std::cos(std::numbers::pi * j / (_nt - 1));
+        baryT[j] = (j % 2 == 0 ? 1.0 : - 1.0) * (j == 0 || j == _nt - 1 ? 0.5 : 1.0);
+    }
+
+VecReal                     s;
+std::vector < VecReal >     u (_nt);
+std::vector < VecReal >     d (_nt);
+VecReal                     ua, da;
+const Real                  smin (std::log(Cmin()));
+const Real                  ds ((std::log(Cmax()) - smin) / NINIT);
+
+    Sample(_iso, smin, ua, da);
+
+    s.push_back(smin);
+
+    for (UInt j = 0; j < _nt; ++j) {
+        u[j].push_back(ua[j]);
+        d[j].push_back(da[j]);
+    }
+
+    for (UInt k = 1; k <= NINIT; ++k) {
+
+    const Real  sa (s.back());
+    const Real  sb (k < NINIT ? smin + k * ds : std::log(Cmax()));
+    VecReal     ub, db;
+
+        for (UInt j = 0; j < _nt; ++j) {
+            ua[j] = u[j].back();
+            da[j] = d[j].back();
+        }
+
+        Sample(_iso, sb, ub, db);
+        Refine(_iso, sa, ua, da, sb, ub, db, 0, s, u, d);
+    }
+
+//  Tabela contigua por temperatura e baldes uniformes em s: o balde b aponta
+//  para o intervalo que contem s_0 + b ds
+
+const size_t    npto (s.size());
+const size_t    nbucket (npto - 1);
+
+    nodeS = s;
+    nodeU.resize(_nt * npto);
+    nodeD.resize(_nt * npto);
+
+    for (UInt j = 0; j < _nt; ++j) {
+        std::copy(u[j].begin(), u[j].end(), nodeU.begin() + j * npto);
+        std::copy(d[j].begin(), d[j].end(), nodeD.begin() + j * npto);
+    }
+
+    bucket.resize(nbucket);
+    invDs = nbucket / (nodeS[npto - 1] - nodeS[0]);
+
+    for (size_t b = 0, k = 0; b < nbucket; ++b) {
+
+    const Real  x (nodeS[0] + b / invDs);
+
+        while (k + 2 < npto && nodeS[k + 1] <= x) ++k;
+        bucket[b] = static_cast<std::uint32_t>(k);
+    }
+
+//  Erro medido em t = 1/3 de cada intervalo, nos nos de temperatura e entre
+//  eles
+
+VecReal     temps (nodeT);
+Real        w[NTMAX];
+Real        err (0.0);
+
+    for (UInt j = 0; j + 1 < _nt; ++j)
+        temps.push_back(0.5 * (Tmin() + Tmax()) - 0.5 * (Tmax() - Tmin()) * std::cos(std::numbers::pi * (j + 0.5) / (_nt - 1)));
+
+    for (const auto& temp : temps) {
+
+        Weights(temp, w);
+
+        for (size_t k = 0; k + 1 < npto; ++k) {
+
+        const Real  sk (nodeS[k] + (nodeS[k + 1] - nodeS[k]) / 3.0);
+        Real        uk, dk;
+
+            Interpolate(sk, w, uk, dk);
+            err = std::max(err, std::fabs(uk - std::log(_iso.Qe(std::exp(sk), temp))));
+        }
+    }
+
+    return err;
+
+}
+
+#undef  __FUNCT__
+#define __FUNCT__ "void TabulatedIsotherm :: Sample (const Isotherm&, const Real&, VecReal&, VecReal&) const"
+void
+TabulatedIsotherm :: Sample (   const Isotherm&     _iso
+                            ,   const Real&         _s
+                            ,   VecReal&            _u
+                            ,   VecReal&            _d
+                            ) const
+{
+
+const Real  c (std::exp(_s));
+
+    _u.resize(nodeT.size());
+    _d.resize(nodeT.size());
+
+    for (size_t j = 0; j < nodeT.size(); ++j) {
+
+    const Real  q (_iso.Qe(c, nodeT[j]));
+
+        try {
+
+            if (!(q > 0.0) || !std::isfinite(q)) throw
+                    IsoException    (   IST_LOC
+                                    ,   className()
+                                    ,   BadRange
+                                    );
+
+        } catch (const IsoException& _isoExcept) {
+
+            std::cout   << _isoExcept
+                        << "\n";
+            exit(EXIT_FAILURE);
+        }
+
+        _u[j] = std::log(q);
+        _d[j] = c * _iso.DQDC(c, nodeT[j]) / q;
+    }
+
+}
+
+//==============================================================================
+// Subdivisao com controle de erro
+//==============================================================================
+
+void
+TabulatedIsotherm :: Refine (   const Isotherm&     _iso
+                            ,   const Real&         _sa
+                            ,   const VecReal&      _ua
+                            ,   const VecReal&      _da
+                            ,   const Real&         _sb
+                            ,   const VecReal&      _ub
+                            ,   const VecReal&      _db
+                            ,   const UInt&         _depth
+                            ,   VecReal&            _s
+                            ,   std::vector < VecReal >&    _u
+                            ,   std::vector < VecReal >&    _d
+                            ) const
+{
+
+const Real  h (_sb - _sa);
+const Real  sm (0.5 * (_sa + _sb));
+VecReal     um, dm;
+bool        accept (_depth >= MAXDEPTH);
+
+    Sample(_iso, sm, um, dm);
+
+    if (!accept) {
+
+    VecReal     uq, dq;
+
+        accept = true;
+
+        for (const auto& t : {0.25, 0.5, 0.75}) {
+
+            if (t == 0.5) {
+                uq = um;
+            }
+            else {
+                Sample(_iso, _sa + t * h, uq, dq);
+            }
+
+            for (size_t j = 0; j < nodeT.size() && accept; ++j)
+                accept = std::fabs(Hermite(t, h, _ua[j], _da[j], _ub[j], _db[j]) - uq[j]) <= Tolerance();
+
+            if (!accept) break;
+        }
+    }
+
+    if (accept) {
+
+        _s.push_back(_sb);
+
+        for (size_t j = 0; j < nodeT.size(); ++j) {
+            _u[j].push_back(_ub[j]);
+            _d[j].push_back(_db[j]);
+        }
+
+        return;
+    }
+
+    Refine(_iso, _sa, _ua, _da, sm, um, dm, _depth + 1, _s, _u, _d);
+    Refine(_iso, sm, um, dm, _sb, _ub, _db, _depth + 1, _s, _u, _d);
+
+}
+
+//==============================================================================
+// Interpolacao
+//==============================================================================
+
+void
+TabulatedIsotherm :: Weights    (   const Real&     _temp
+                                ,   Real*           _w
+                                ) const
+{
+
+const size_t    nt (nodeT.size());
+
+    if (nt == 1) {
+        _w[0] = 1.0;
+        return;
+    }
+
+Real    sum (0.0);
+
+    for (size_t j = 0; j < nt; ++j) {
+
+        if (_temp == nodeT[j]) {
+            std::fill(_w, _w + nt, 0.0);
+            _w[j] = 1.0;
+            return;
+        }
+
+        _w[j] = baryT[j] / (_temp - nodeT[j]);
+        sum  += _w[j];
+    }
+
+    for (size_t j = 0; j < nt; ++j) _w[j] /= sum;
+
+}
+
+size_t
+TabulatedIsotherm :: Interval (const Real& _s) const
+{
+
+const size_t    npto (nodeS.size());
+size_t          k (bucket[std::min<size_t>(npto - 2, static_cast<size_t>(std::max(0.0, _s - nodeS[0]) * invDs))]);
+
+    while (k + 2 < npto && nodeS[k + 1] <= _s) ++k;
+
+    return k;
+
+}
+
+void
+TabulatedIsotherm :: Interpolate    (   const Real&     _s
+                                    ,   const Real*     _w
+                                    ,   Real&           _u
+                                    ,   Real&           _d
+                                    ) const
+{
+
+//  Fora da tabela a spline e prolongada pela reta tangente no extremo
+
+const size_t    npto (nodeS.size());
+const Real      sc (std::clamp(_s, nodeS[0], nodeS[npto - 1]));
+const size_t    k (Interval(sc));
+const Real      h (nodeS[k + 1] - nodeS[k]);
+const Real      t ((sc - nodeS[k]) / h);
+
+    _u = 0.0;
+    _d = 0.0;
+
+    for (size_t j = 0; j < nodeT.size(); ++j) {
+
+    const Real* u (&nodeU[j * npto + k]);
+    const Real* d (&nodeD[j * npto + k]);
+
+        _u += _w[j] * Hermite(t, h, u[0], d[0], u[1], d[1]);
+        _d += _w[j] * HermiteDerivative(t, h, u[0], d[0], u[1], d[1]);
+    }
+
+    _u += _d * (_s - sc);
+
+}
+
+//==============================================================================
+// Verificacoes
+//==============================================================================
+
+#undef  __FUNCT__
+#define __FUNCT__ "void TabulatedIsotherm :: Check (const Real&, const Real&) const"
+void
+TabulatedIsotherm :: Check  (   const Real&     _c
+                            ,   const Real&     _temp
+                            ) const
+{
+
+    try {
+
+        if (!setup) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCoefficient
+                                );
+
+        if (!(_c >= 0.0)) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadCeLTZero
+                                );
+
+//  Com uma so temperatura, 0 indica a temperatura nao informada
+
+        if (nodeT.size() > 1 ? !(_temp >= Tmin() && _temp <= Tmax()) : _temp != 0.0 && _temp != Tmin()) throw
+                IsoException    (   IST_LOC
+                                ,   className()
+                                ,   BadRange
+                                );
+
+    } catch (const IsoException& _isoExcept) {
+
+        std::cout   << _isoExcept
+                    << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+//==============================================================================
+// Consultas
+//==============================================================================
+
+Real
+TabulatedIsotherm :: Qe (   const Real&     _c
+                        ,   const Real&     _temp
+                        ) const
+{
+
+    Check(_c, _temp);
+
+    if (_c == 0.0) return 0.0;
+
+Real        w[NTMAX];
+Real        u, d;
+
+    Weights(_temp, w);
+    Interpolate(std::log(_c), w, u, d);
+
+    return std::exp(u);
+
+}
+
+Real
+TabulatedIsotherm :: DQDC   (   const Real&     _c
+                            ,   const Real&     _temp
+                            ) const
+{
+
+    Check(_c, _temp);
+
+Real        w[NTMAX];
+Real        u, d;
+
+    Weights(_temp, w);
+
+//  Em C = 0 vale a lei de potencia Qe = Qe(Cmin) (C / Cmin)^d
+
+    if (_c == 0.0) {
+
+        Interpolate(nodeS[0], w, u, d);
+
+        if (d > 1.0) return 0.0;
+        if (d < 1.0) return std::numeric_limits<Real>::infinity();
+
+        return std::exp(u - nodeS[0]);
+    }
+
+    Interpolate(std::log(_c), w, u, d);
+
+    return std::exp(u) * d / _c;
+
+}
+
+//==============================================================================
+// Consultas em bloco
+//==============================================================================
+
+void
+TabulatedIsotherm :: Qe (   std::span<const Real>   _ce
+                        ,   std::span<Real>         _qe
+                        ,   const Real&             _temperature
+                        ) const
+{
+
+    Block(_ce, _qe, _temperature, false);
+
+}
+
+void
+TabulatedIsotherm :: DQDC   (   std::span<const Real>   _ce
+                            ,   std::span<Real>         _dqdc
+                            ,   const Real&             _temperature
+                            ) const
+{
+
+    Block(_ce, _dqdc, _temperature, true);
+
+}
+
+void
+TabulatedIsotherm :: Block  (   std::span<const Real>   _ce
+                            ,   std::span<Real>         _out
+                            ,   const Real&             _temperature
+                            ,   const bool&             _derivative
+                            ) const
+{
+
+    CheckBlock(_ce.size(), _out.size());
+    Check(0.0, _temperature);
+
+    for (const auto& c : _ce)
+        if (!(c >= 0.0)) Check(c, _temperature);
+
+const size_t    npto (nodeS.size());
+const size_t    nt (nodeT.size());
+Real            w[NTMAX];
+
+    Weights(_temperature, w);
+
+//  Por bloco: localizacao dos intervalos e, em seguida, avaliacao das splines
+//  em lacos sem desvios sobre os pontos do bloco
+
+size_t      index[BLOCK];
+Real        t[BLOCK], h[BLOCK], ex[BLOCK], u[BLOCK], d[BLOCK];
+
+    for (size_t ini = 0; ini < _ce.size(); ini += BLOCK) {
+
+    const size_t    n (std::min(BLOCK, _ce.size() - ini));
+
+        for (size_t i = 0; i < n; ++i) {
+
+        const Real      s (std::log(_ce[ini + i]));
+        const Real      sc (std::clamp(s, nodeS[0], nodeS[npto - 1]));
+        const size_t    k (Interval(sc));
+
+            index[i] = k;
+            h[i]     = nodeS[k + 1] - nodeS[k];
+            t[i]     = (sc - nodeS[k]) / h[i];
+            ex[i]    = s - sc;
+            u[i]     = 0.0;
+            d[i]     = 0.0;
+        }
+
+        for (size_t j = 0; j < nt; ++j) {
+
+        const Real* uj (&nodeU[j * npto]);
+        const Real* dj (&nodeD[j * npto]);
+        const Real  wj (w[j]);
+
+            for (size_t i = 0; i < n; ++i) {
+
+            const size_t    k (index[i]);
+
+                u[i] += wj * Hermite(t[i], h[i], uj[k], dj[k], uj[k + 1], dj[k + 1]);
+                d[i] += wj * HermiteDerivative(t[i], h[i], uj[k], dj[k], uj[k + 1], dj[k + 1]);
+            }
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+
+        const Real  c (_ce[ini + i]);
+        const Real  q (c > 0.0 ? std::exp(u[i] + d[i] * ex[i]) : 0.0);
+
+            if (!_derivative)   _out[ini + i] = q;
+            else if (c > 0.0)   _out[ini + i] = q * d[i] / c;
+            else                _out[ini + i] = DQDC(c, _temperature);
+        }
+    }
+
+}
+
+IST_NAMESPACE_CLOSE
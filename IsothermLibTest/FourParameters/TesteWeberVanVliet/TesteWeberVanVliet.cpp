@@ -31,6 +31,12 @@
 #include <Isotherm/FourParameters/WeberVanVliet.h>                 // ist::WeberVanVliet
 
 
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <vector>                       // std::vector
+
 //==============================================================================
 // include da googletest
 //==============================================================================
@@ -127,6 +133,27 @@ std::unique_ptr<ist::Isotherm>  iso1c = iso1.Clone();
 
 }    
 
+TEST_F(TestSuit, Bloco) {
+
+//  Qe e DQDC em bloco chamadas no proprio modelo, pelo laco de IsothermTemplate
+
+const size_t            NPTO (100);
+std::vector<Real>       ce (NPTO), qe (NPTO), dqdc (NPTO);
+
+    for (size_t k = 0; k < NPTO; ++k) ce[k] = CE * (0.5 + static_cast<Real>(k) / NPTO);
+
+    isotherm_2.Qe(ce, qe, 0.0);
+    isotherm_2.DQDC(ce, dqdc, 0.0);
+
+    for (size_t k = 0; k < NPTO; ++k) {
+        EXPECT_DOUBLE_EQ(qe[k], isotherm_2.Qe(ce[k]));
+        EXPECT_DOUBLE_EQ(dqdc[k], isotherm_2.DQDC(ce[k], 0.0));
+    }
+
+    EXPECT_DEATH(isotherm_2.Qe(ce, std::span<Real>(qe).first(NPTO - 1), 0.0);, "");
+
+}
+
 TEST_F(TestSuit, DeathTest) {
     
     EXPECT_DEATH(TestIsotherm( - K1, K2, K3, K4);, ""); 
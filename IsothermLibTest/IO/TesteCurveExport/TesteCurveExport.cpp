@@ -0,0 +1,313 @@
+//==============================================================================
+// Name        : TesteCurveExport.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe CurveExport
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Langmuir.h>               // ist::Langmuir
+#include <IO/CurveExport.h>                                 // ist::CurveExport
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::CurveExport TestExport;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 68.1867;
+const Real              K1          = 5.42910;
+const Real              CMIN        = 1.0e-4;
+const Real              CMAX        = 1.0e2;
+const size_t            NPTS        = 20000;
+
+public:
+
+    ist::Langmuir           langmuir    = ist::Langmuir(QMAX, K1);
+
+    TestExport              curve_1;
+    TestExport              curve_2     = TestExport(NPTS, CMIN, CMAX);
+    TestExport              curve_3     = TestExport(NPTS, CMIN, CMAX, TestExport::Grid::Log);
+
+    std::filesystem::path   file        = std::filesystem::temp_directory_path() / "TesteCurveExport.dat";
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+
+//  Conteudo binario do arquivo
+    ist::VecReal Read (const size_t& _skip) const {
+
+    std::ifstream   in (file, std::ios::binary);
+    std::string     bytes ((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ist::VecReal    values ((bytes.size() - _skip) / sizeof(Real));
+
+        std::memcpy(values.data(), bytes.data() + _skip, values.size() * sizeof(Real));
+
+        return values;
+    }
+
+};
+
+TEST_F(TestSuit, Malha) {
+
+    EXPECT_EQ(curve_1.NumberPoints(), 0);
+    EXPECT_EQ(curve_2.NumberPoints(), NPTS);
+
+    EXPECT_EQ(curve_2.Ce().front(), CMIN);
+    EXPECT_EQ(curve_2.Ce().back(), CMAX);
+    EXPECT_EQ(curve_3.Ce().front(), CMIN);
+    EXPECT_EQ(curve_3.Ce().back(), CMAX);
+
+//  Passo constante em Ce e em ln(Ce)
+const Real  dx ((CMAX - CMIN) / (NPTS - 1));
+const Real  dl (std::log(CMAX / CMIN) / (NPTS - 1));
+
+    for (const size_t k : {1UL, NPTS / 2, NPTS - 2}) {
+        EXPECT_NEAR(curve_2.Ce()[k] - curve_2.Ce()[k - 1], dx, 1.0e-9 * dx);
+        EXPECT_NEAR(std::log(curve_3.Ce()[k] / curve_3.Ce()[k - 1]), dl, 1.0e-6 * dl);
+    }
+
+}
+
+TEST_F(TestSuit, Texto) {
+
+    curve_3.Write(langmuir, file.string());
+
+std::ifstream   in (file);
+std::string     line;
+size_t          k (0);
+
+    while (std::getline(in, line)) {
+
+    std::istringstream  sline (line);
+    Real                x, y;
+
+        sline >> x >> y;
+
+        ASSERT_LT(k, NPTS);
+        EXPECT_EQ(x, curve_3.Ce()[k]);
+        EXPECT_EQ(y, langmuir.Qe(curve_3.Ce()[k]));
+        ++k;
+    }
+
+    EXPECT_EQ(k, NPTS);
+
+}
+
+TEST_F(TestSuit, Binario) {
+
+    curve_2.Write   (   langmuir
+                    ,   file.string()
+                    ,   [](const Real& _q, const Real& _c) {return _c / _q;}
+                    ,   [](const Real& _q, const Real&) {return std::log(_q);}
+                    ,   TestExport::Format::Binary
+                    );
+
+const ist::VecReal  values (Read(0));
+
+    ASSERT_EQ(values.size(), 2 * NPTS);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+
+    const Real  c (curve_2.Ce()[k]);
+    const Real  q (langmuir.Qe(c));
+
+        EXPECT_EQ(values[2 * k], c / q);
+        EXPECT_EQ(values[2 * k + 1], std::log(q));
+    }
+
+}
+
+TEST_F(TestSuit, Colunas) {
+
+    curve_3.Write(langmuir, file.string(), TestExport::Format::Columnar);
+
+std::ifstream       in (file, std::ios::binary);
+TestExport::Header  head;
+
+    in.read(reinterpret_cast<char*>(&head), sizeof(head));
+
+    EXPECT_EQ(std::string(head.magic, 8), "ISTCRV01");
+    EXPECT_EQ(head.npto, NPTS);
+    EXPECT_EQ(head.ncol, 2);
+
+const ist::VecReal  values (Read(sizeof(TestExport::Header)));
+
+    ASSERT_EQ(values.size(), 2 * NPTS);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+        EXPECT_EQ(values[k], curve_3.Ce()[k]);
+        EXPECT_EQ(values[NPTS + k], langmuir.Qe(curve_3.Ce()[k]));
+    }
+
+}
+
+TEST_F(TestSuit, Familia) {
+
+//  Tres curvas: coluna Ce e uma coluna por curva
+
+const std::vector<ist::Langmuir>        models {{QMAX, K1}, {QMAX, 2.0 * K1}, {2.0 * QMAX, K1}};
+std::vector<TestExport::Curve>          curves;
+ist::ThreadPool                         pool (3);
+
+    for (size_t j = 0; j < models.size(); ++j) curves.push_back({&models[j], 0.0, "L" + std::to_string(j)});
+
+    curve_3.Write(curves, file.string(), TestExport::Format::Columnar, pool);
+
+std::ifstream       in (file, std::ios::binary);
+TestExport::Header  head;
+
+    in.read(reinterpret_cast<char*>(&head), sizeof(head));
+
+    EXPECT_EQ(head.npto, NPTS);
+    EXPECT_EQ(head.ncol, 4);
+
+const ist::VecReal  values (Read(sizeof(TestExport::Header)));
+
+    ASSERT_EQ(values.size(), 4 * NPTS);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+        EXPECT_EQ(values[k], curve_3.Ce()[k]);
+        for (size_t j = 0; j < models.size(); ++j)
+            EXPECT_EQ(values[(j + 1) * NPTS + k], models[j].Qe(curve_3.Ce()[k]));
+    }
+
+//  Binario: linhas de 4 valores, com escala no eixo y
+
+    curve_2.Write(curves, file.string(), [](const Real& _q, const Real& _c) {return _q / _c;}, TestExport::Format::Binary, pool);
+
+const ist::VecReal  rows (Read(0));
+
+    ASSERT_EQ(rows.size(), 4 * NPTS);
+
+    for (size_t k = 0; k < NPTS; k += 101) {
+        EXPECT_EQ(rows[4 * k], curve_2.Ce()[k]);
+        EXPECT_EQ(rows[4 * k + 3], models[2].Qe(curve_2.Ce()[k]) / curve_2.Ce()[k]);
+    }
+
+//  Texto: cabecalho com os nomes
+
+    TestExport(11, 0.1, 1.1).Write(curves, file.string());
+
+std::ifstream   text (file);
+std::string     line;
+size_t          nline (0);
+
+    std::getline(text, line);
+
+    EXPECT_EQ(line, "#Ce\tL0\tL1\tL2");
+
+    while (std::getline(text, line)) {
+
+    std::istringstream  row (line);
+    Real                x, y[3];
+
+        row >> x >> y[0] >> y[1] >> y[2];
+
+        for (size_t j = 0; j < models.size(); ++j) EXPECT_EQ(y[j], models[j].Qe(x));
+        ++nline;
+    }
+
+    EXPECT_EQ(nline, 11);
+
+}
+
+TEST_F(TestSuit, Arquivos) {
+
+//  Um arquivo por curva, _prefix + nome
+
+const std::vector<ist::Langmuir>        models {{QMAX, K1}, {QMAX, 2.0 * K1}};
+const std::string                       prefix ((std::filesystem::temp_directory_path() / "TesteCurveExport_").string());
+std::vector<TestExport::Curve>          curves;
+
+    for (size_t j = 0; j < models.size(); ++j) curves.push_back({&models[j], 0.0, std::to_string(j) + ".dat"});
+
+    curve_2.WriteFiles(curves, prefix, TestExport::Format::Columnar);
+
+    for (size_t j = 0; j < models.size(); ++j) {
+
+    const std::filesystem::path     name (prefix + curves[j].name);
+
+        std::filesystem::rename(name, file);
+
+    const ist::VecReal  values (Read(sizeof(TestExport::Header)));
+
+        ASSERT_EQ(values.size(), 2 * NPTS);
+
+        for (size_t k = 0; k < NPTS; k += 97) EXPECT_EQ(values[NPTS + k], models[j].Qe(curve_2.Ce()[k]));
+    }
+
+}
+
+TEST_F(TestSuit, PlotGraph) {
+
+ist::FunctionEscala     eixoX ([](const Real&, const Real& _c) {return _c;});
+ist::FunctionEscala     eixoY ([](const Real& _q, const Real&) {return _q;});
+
+    langmuir.PlotGraph(file.string(), eixoX, eixoY, 11, 0.1, 1.1);
+
+std::ifstream   in (file);
+Real            x, y;
+size_t          k (0);
+
+    while (in >> x >> y) {
+        EXPECT_NEAR(x, 0.1 * (k + 1), 1.0e-15);
+        EXPECT_EQ(y, langmuir.Qe(x));
+        ++k;
+    }
+
+    EXPECT_EQ(k, 11);
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestExport(1, CMIN, CMAX);, "");
+    EXPECT_DEATH(TestExport(NPTS, CMAX, CMIN);, "");
+    EXPECT_DEATH(TestExport(NPTS, 0.0, CMAX, TestExport::Grid::Log);, "");
+    EXPECT_DEATH(curve_1.Write(langmuir, file.string());, "");
+    EXPECT_DEATH(curve_2.Write(langmuir, "/dir/inexistente/curva.dat");, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,190 @@
+//==============================================================================
+// Name        : TesteDataset.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Dataset
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <IO/Dataset.h>                                     // ist::Dataset
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::Dataset TestDataset;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+//  Serie, Ce (mg/L), T (C), qe (mg/g), peso; series e temperaturas fora de
+//  ordem, com comentario, linha vazia e final de linha CRLF
+
+const std::string       CSV         =   "serie,ce,temp,qe,peso\n"
+                                        "# ensaio 1\n"
+                                        "2, 1.5, 25, 10.0, 1\r\n"
+                                        "1, 0.5, 35, 4.0, 2\n"
+                                        "\n"
+                                        "1, 1.0, 25, 7.5, 1\n"
+                                        "2, 2.5, 25, 12.0, 0.5\n"
+                                        "1, 2.0, 25, +9.0, 1\n"
+                                        "1, 0.25, 35, 2.0e0, 1";
+
+public:
+
+    TestDataset             data_1;
+    TestDataset::Layout     layout;
+
+    std::filesystem::path   file        = std::filesystem::temp_directory_path() / "TesteDataset.csv";
+
+    void SetUp() override {
+
+        layout.skip                 = 1;
+        layout.series.index         = 0;
+        layout.ce                   = {1, 1.0e-3, 0.0};
+        layout.temperature          = {2, 1.0, 273.15};
+        layout.qe.index             = 3;
+        layout.weight.index         = 4;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+
+};
+
+TEST_F(TestSuit, Leitura) {
+
+    EXPECT_EQ(data_1.NumberPoints(), 0);
+
+    data_1 = TestDataset::Parse(CSV, layout);
+
+    ASSERT_EQ(data_1.NumberPoints(), 6);
+
+//  Grupos (1, 25), (1, 35) e (2, 25), na ordem original dentro de cada um
+
+const auto&     groups (data_1.Groups());
+
+    ASSERT_EQ(groups.size(), 3);
+
+    EXPECT_EQ(groups[0].series, 1.0);
+    EXPECT_DOUBLE_EQ(groups[0].temperature, 298.15);
+    EXPECT_EQ(groups[0].end - groups[0].begin, 2);
+    EXPECT_DOUBLE_EQ(groups[1].temperature, 308.15);
+    EXPECT_EQ(groups[2].series, 2.0);
+
+    EXPECT_EQ(data_1.Ce(groups[0])[0], 1.0e-3);
+    EXPECT_EQ(data_1.Ce(groups[0])[1], 2.0e-3);
+    EXPECT_EQ(data_1.Qe(groups[0])[1], 9.0);
+    EXPECT_EQ(data_1.Qe(groups[1])[0], 4.0);
+    EXPECT_EQ(data_1.Qe(groups[1])[1], 2.0);
+    EXPECT_EQ(data_1.Weight(groups[1])[0], 2.0);
+    EXPECT_EQ(data_1.Weight(groups[2])[1], 0.5);
+
+    EXPECT_EQ(data_1.Ce().size(), data_1.Temperature().size());
+    EXPECT_EQ(data_1.Series().back(), 2.0);
+
+}
+
+TEST_F(TestSuit, Espacos) {
+
+//  Colunas separadas por espacos, sem temperatura, peso e serie
+
+TestDataset::Layout     simple;
+
+    simple.delimiter            = ' ';
+    simple.temperature.offset   = 300.0;
+
+const TestDataset       data (TestDataset::Parse("  1.0   2.0\n\t3.0 \t4.0  \n", simple));
+
+    ASSERT_EQ(data.NumberPoints(), 2);
+    EXPECT_EQ(data.Qe()[1], 4.0);
+    EXPECT_EQ(data.Weight()[0], 1.0);
+    EXPECT_EQ(data.Temperature()[0], 300.0);
+    EXPECT_EQ(data.Groups().size(), 1);
+
+}
+
+TEST_F(TestSuit, Arquivo) {
+
+//  Arquivo grande o bastante para ser lido em varios blocos
+
+const size_t    NPTS (180000);
+
+    {
+    std::ofstream   out (file);
+
+        out << "serie,ce,temp,qe,peso\n";
+        for (size_t k = 0; k < NPTS; ++k)
+            out << k % 3 << ',' << 1.0e-3 * k << ',' << 25 + 10 * (k % 2) << ',' << 0.5 * k << ",1\n";
+    }
+
+const TestDataset   data_2 (TestDataset::Load(file.string(), layout, 4));
+const TestDataset   data_3 (TestDataset::Load(file.string(), layout, 1));
+
+    ASSERT_EQ(data_2.NumberPoints(), NPTS);
+    ASSERT_EQ(data_2.Groups().size(), 6);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+        ASSERT_EQ(data_2.Ce()[k], data_3.Ce()[k]);
+        ASSERT_EQ(data_2.Qe()[k], data_3.Qe()[k]);
+    }
+
+    for (const auto& group : data_2.Groups()) {
+        EXPECT_EQ(group.end - group.begin, NPTS / 6);
+        for (size_t k = group.begin; k < group.end; ++k) {
+            EXPECT_EQ(data_2.Series()[k], group.series);
+            EXPECT_EQ(data_2.Temperature()[k], group.temperature);
+        }
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+TestDataset::Layout     nocolumn;
+
+    nocolumn.qe.index = -1;
+
+    EXPECT_DEATH(auto data = TestDataset::Load("/dir/inexistente/dados.csv", layout);, "");
+    EXPECT_DEATH(auto data = TestDataset::Parse("1.0,abc\n", TestDataset::Layout());, "");
+    EXPECT_DEATH(auto data = TestDataset::Parse("1.0\n", TestDataset::Layout());, "");
+    EXPECT_DEATH(auto data = TestDataset::Parse("1.0,2.0\n", nocolumn);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+//==============================================================================
+// Name        : TesteModelRegistry.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe ModelRegistry
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Langmuir.h>                // ist::Langmuir
+#include <Isotherm/TwoParameters/Temkin.h>                  // ist::Temkin
+#include <Isotherm/ThreeParameters/Toth.h>                  // ist::Toth
+#include <IO/ModelRegistry.h>                               // ist::ModelRegistry
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 2.76;
+const Real              K1          = 0.39;
+const Real              K2          = 0.57;
+
+public:
+
+    ist::Toth               toth        = ist::Toth(QMAX, K1, K2);
+    ist::ModelRegistry&     registry    = ist::ModelRegistry::Default();
+
+};
+
+TEST_F(TestSuit, Biblioteca) {
+
+const auto      entries (registry.Entries());
+
+    EXPECT_EQ(entries.size(), 37);
+    EXPECT_EQ(entries.front().name, "Henry");
+
+    for (const auto& entry : entries) {
+
+    const auto      iso (entry.create());
+
+        EXPECT_EQ(iso->classID(), entry.id);
+        EXPECT_EQ(iso->className(), entry.name);
+        EXPECT_EQ(registry.Find(entry.name), entry.create);
+        EXPECT_EQ(registry.Find(entry.id), entry.create);
+    }
+
+    EXPECT_EQ(registry.Find("Inexistente"), nullptr);
+    EXPECT_EQ(registry.Find(ist::ID::Breakthrough), nullptr);
+
+}
+
+TEST_F(TestSuit, Criacao) {
+
+const Real      par[] {QMAX, K1, K2};
+const auto      iso_1 (registry.Create("Toth", par));
+const auto      iso_2 (registry.Create(ist::ID::Toth, toth.Coefficients()));
+
+    EXPECT_EQ(iso_1->className(), "Toth");
+    EXPECT_EQ(iso_2->NumberConst(), 3);
+
+    for (const Real ce : {0.1, 1.0, 10.0}) {
+        EXPECT_EQ(iso_1->Qe(ce), toth.Qe(ce));
+        EXPECT_EQ(iso_2->Qe(ce), toth.Qe(ce));
+    }
+
+const Real      lang[] {QMAX, K1};
+
+    EXPECT_EQ(registry.Create("Langmuir", lang)->Qe(1.0), ist::Langmuir(QMAX, K1).Qe(1.0));
+
+//  Constante dos gases depois dos coeficientes
+
+const Real      temk[] {QMAX, K1, 62.3636};
+const auto      iso_3 (registry.Create("Temkin", temk));
+
+    EXPECT_EQ(iso_3->NumberConst(), 2);
+    EXPECT_EQ(iso_3->Rgas(), 62.3636);
+    EXPECT_EQ(iso_3->Qe(2.0, 300.0), ist::Temkin(QMAX, K1, 62.3636).Qe(2.0, 300.0));
+    EXPECT_EQ(registry.Create("Temkin", lang)->Rgas(), ist::Isotherm::RGASCONST);
+
+}
+
+TEST_F(TestSuit, Registro) {
+
+ist::ModelRegistry      local;
+
+    EXPECT_EQ(local.Size(), 0);
+
+    local.Register<ist::Toth>();
+
+    ASSERT_EQ(local.Size(), 1);
+    EXPECT_NE(local.Find("Toth"), nullptr);
+
+//  Mesmo ID com outro nome: o registro anterior e substituido
+
+    local.Register(ist::ID::Toth, "TothModificado", local.Find("Toth"));
+
+    EXPECT_EQ(local.Size(), 1);
+    EXPECT_EQ(local.Find("Toth"), nullptr);
+    EXPECT_NE(local.Find("TothModificado"), nullptr);
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+const Real      par[] {QMAX, K1, K2};
+const Real      neg[] {-QMAX, K1, K2};
+const Real      small[] {QMAX, K1};
+
+    EXPECT_DEATH(auto iso = registry.Create("Inexistente", par);, "");
+    EXPECT_DEATH(auto iso = registry.Create(ist::ID::Breakthrough, par);, "");
+    EXPECT_DEATH(auto iso = registry.Create("Toth", neg);, "");
+    EXPECT_DEATH(auto iso = registry.Create("Toth", small);, "");
+    EXPECT_DEATH(auto iso = registry.Create("Langmuir", par);, "");
+    EXPECT_DEATH(registry.Register(1234, "Nulo", nullptr);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
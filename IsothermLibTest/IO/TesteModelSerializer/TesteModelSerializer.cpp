@@ -0,0 +1,205 @@
+//==============================================================================
+// Name        : TesteModelSerializer.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe ModelSerializer
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <filesystem>
+#include <string>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Langmuir.h>                // ist::Langmuir
+#include <Isotherm/TwoParameters/Temkin.h>                  // ist::Temkin
+#include <Isotherm/ThreeParameters/Sips.h>                  // ist::Sips
+#include <Isotherm/ThreeParameters/Toth.h>                  // ist::Toth
+#include <IO/ModelSerializer.h>                             // ist::ModelSerializer
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::ModelSerializer TestSerializer;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 2.76;
+const Real              K1          = 0.39;
+const Real              K2          = 0.57;
+
+public:
+
+    std::vector < ist::PtrIsotherm >    models;
+
+    std::filesystem::path   file        = std::filesystem::temp_directory_path() / "TesteModelSerializer.dat";
+
+    void SetUp() override {
+
+        models.push_back(std::make_shared<ist::Toth>(QMAX, K1, K2));
+        models.push_back(std::make_shared<ist::Langmuir>(QMAX, 1.0 / 3.0));
+        models.push_back(std::make_shared<ist::Sips>(QMAX, K1, 0.1 + 1.0e-15));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+
+    void Compare (const TestSerializer::VecModel& _copy) {
+
+        ASSERT_EQ(_copy.size(), models.size());
+
+        for (size_t k = 0; k < models.size(); ++k) {
+            EXPECT_EQ(_copy[k]->classID(), models[k]->classID());
+            EXPECT_EQ(_copy[k]->Coefficients(), models[k]->Coefficients());
+            EXPECT_EQ(_copy[k]->Qe(1.5), models[k]->Qe(1.5));
+        }
+    }
+
+};
+
+TEST_F(TestSuit, Binario) {
+
+const std::string   data (TestSerializer::Write(models, TestSerializer::Binary));
+
+    EXPECT_EQ(data.substr(0, 8), "ISTMOD01");
+    EXPECT_EQ(data.size(), 16 + 3 * 8 + 8 * 8);
+
+    Compare(TestSerializer::Parse(data));
+
+}
+
+TEST_F(TestSuit, Json) {
+
+const ist::Toth     toth (QMAX, K1, K2);
+
+    EXPECT_EQ   (   TestSerializer::Write(toth, TestSerializer::Json)
+                ,   "[\n{\"model\":\"Toth\",\"id\":309,\"coefficients\":[2.76,0.39,0.57]}\n]\n"
+                );
+
+    EXPECT_EQ(TestSerializer::Write(std::vector < ist::PtrIsotherm > (), TestSerializer::Json), "[\n]\n");
+    EXPECT_TRUE(TestSerializer::Parse(" [ ] ").empty());
+
+    Compare(TestSerializer::Parse(TestSerializer::Write(models, TestSerializer::Json)));
+
+//  Objeto isolado, chaves fora de ordem, somente o nome e chaves
+//  desconhecidas
+
+const auto          copy    (   TestSerializer::Parse
+                                (   " {\"coefficients\": [ 2.76, 0.39 ,0.57 ],\n"
+                                    "  \"fit\": {\"r2\": 0.99, \"obs\": [\"a\\\"b\", null, true]},\n"
+                                    "  \"model\": \"Toth\"} "
+                                )
+                            );
+
+    ASSERT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy[0]->Qe(1.5), toth.Qe(1.5));
+
+}
+
+TEST_F(TestSuit, ConstanteGases) {
+
+//  Constante dos gases gravada somente quando difere da padrao
+
+const Real          RGAS    (62.3636);
+const ist::Temkin   temkin  (0.876338, 0.730948, RGAS);
+
+    EXPECT_EQ   (   TestSerializer::Write(ist::Temkin(0.5, 0.25), TestSerializer::Json)
+                ,   "[\n{\"model\":\"Temkin\",\"id\":207,\"coefficients\":[0.5,0.25]}\n]\n"
+                );
+
+    EXPECT_EQ   (   TestSerializer::Write(ist::Temkin(0.5, 0.25, 62.5), TestSerializer::Json)
+                ,   "[\n{\"model\":\"Temkin\",\"id\":207,\"coefficients\":[0.5,0.25],\"rgas\":62.5}\n]\n"
+                );
+
+    for (const auto format : {TestSerializer::Binary, TestSerializer::Json}) {
+
+    const auto      copy (TestSerializer::Parse(TestSerializer::Write(temkin, format)));
+
+        ASSERT_EQ(copy.size(), 1);
+        EXPECT_EQ(copy[0]->Coefficients(), temkin.Coefficients());
+        EXPECT_EQ(copy[0]->Rgas(), RGAS);
+        EXPECT_EQ(copy[0]->Qe(2.0, 300.0), temkin.Qe(2.0, 300.0));
+    }
+
+}
+
+TEST_F(TestSuit, Arquivo) {
+
+//  Muitos modelos, como na carga de um servico
+
+const size_t    NMODEL (5000);
+
+std::vector < std::unique_ptr<ist::Isotherm> >  many;
+
+    for (size_t k = 0; k < NMODEL; ++k) {
+        if (k % 2 == 0) many.push_back(std::make_unique<ist::Toth>(QMAX + k, K1, K2));
+        else            many.push_back(std::make_unique<ist::Langmuir>(QMAX, K1 + k));
+    }
+
+    for (const auto format : {TestSerializer::Binary, TestSerializer::Json}) {
+
+        TestSerializer::Save(file.string(), many, format);
+
+    const auto      copy (TestSerializer::Load(file.string()));
+
+        ASSERT_EQ(copy.size(), NMODEL);
+
+        for (size_t k = 0; k < NMODEL; ++k) {
+            ASSERT_EQ(copy[k]->className(), many[k]->className());
+            ASSERT_EQ(copy[k]->Coefficients(), many[k]->Coefficients());
+        }
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+const std::string   data (TestSerializer::Write(models, TestSerializer::Binary));
+
+    EXPECT_DEATH(auto copy = TestSerializer::Load("/dir/inexistente/modelos.json");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse(data.substr(0, data.size() - 4));, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Toth\",\"coefficients\":[1,2]}]");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Toth\",\"coefficients\":[-1,2,3]}]");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Inexistente\",\"coefficients\":[1]}]");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"id\":309.5,\"coefficients\":[1,2,3]}]");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Toth\",\"coefficients\":[1,2,3]}");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("{\"model\":\"Toth\",\"coefficients\":[1,2,3]} x");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("{\"coefficients\":[1,2]}");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Langmuir\",\"coefficients\":[1,2],\"rgas\":62.5}]");, "");
+    EXPECT_DEATH(auto copy = TestSerializer::Parse("[{\"model\":\"Temkin\",\"coefficients\":[1,2],\"rgas\":-1}]");, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
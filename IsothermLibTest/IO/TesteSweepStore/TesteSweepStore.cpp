@@ -0,0 +1,267 @@
+//==============================================================================
+// Name        : TesteSweepStore.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste das classes SweepWriter e SweepReader
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/ThreeParameters/Toth.h>                  // ist::Toth
+#include <IO/SweepStore.h>                                  // ist::SweepWriter
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 2.76;
+const Real              K1          = 0.39;
+const Real              K2          = 0.57;
+const size_t            NCE         = 1000;
+
+public:
+
+    ist::Toth               toth        = ist::Toth(QMAX, K1, K2);
+    ist::VecReal            ce;
+    ist::VecReal            temp        {300.0, 320.0, 340.0};
+
+    std::filesystem::path   file        = std::filesystem::temp_directory_path() / "TesteSweepStore.swp";
+
+    void SetUp() override {
+        for (size_t k = 0; k < NCE; ++k) ce.push_back(1.0e-2 * (k + 1));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+
+//  Um bloco por temperatura, com as colunas Ce, T e Qe
+    void Write () {
+
+    ist::SweepWriter    writer  (   file.string()
+                                ,   toth
+                                ,   {{"Ce", ce}, {"T", temp}}
+                                ,   {"Ce", "T", "Qe"}
+                                );
+
+        for (const Real t : temp) Append(writer, t);
+    }
+
+    void Append (ist::SweepWriter& _writer, const Real& _t) {
+
+    ist::VecReal            t (NCE, _t);
+    ist::VecReal            qe (NCE);
+
+        toth.Qe(ce, qe, _t);
+        _writer.Append({ce, t, qe});
+    }
+
+};
+
+TEST_F(TestSuit, Cabecalho) {
+
+    Write();
+
+const ist::SweepReader  reader (file.string());
+
+    EXPECT_EQ(reader.ModelID(), toth.classID());
+    EXPECT_EQ(reader.ModelName(), "Toth");
+
+    ASSERT_EQ(reader.Coefficients().size(), 3);
+    EXPECT_EQ(reader.Coefficients()[2], K2);
+
+    ASSERT_EQ(reader.Axes().size(), 2);
+    EXPECT_EQ(reader.Axes()[0].name, "Ce");
+    EXPECT_EQ(reader.Axes()[0].values, ce);
+    EXPECT_EQ(reader.Axes()[1].values, temp);
+
+    ASSERT_EQ(reader.Columns().size(), 3);
+    EXPECT_EQ(reader.Columns()[2], "Qe");
+
+}
+
+TEST_F(TestSuit, Blocos) {
+
+    Write();
+
+//  Blocos acrescentados a um arquivo existente
+
+    {
+    ist::SweepWriter    writer (file.string());
+
+        EXPECT_EQ(writer.NumberColumns(), 3);
+        Append(writer, 360.0);
+    }
+
+const ist::SweepReader  reader (file.string());
+const ist::SweepReader  copy (reader);
+
+    ASSERT_EQ(reader.NumberChunks(), 4);
+    EXPECT_EQ(copy.NumberRows(), 4 * NCE);
+
+const auto&     chunk (reader.GetChunk(3));
+
+    EXPECT_EQ(chunk.min[1], 360.0);
+    EXPECT_EQ(chunk.min[0], ce.front());
+    EXPECT_EQ(chunk.max[0], ce.back());
+
+    for (size_t k = 0; k < NCE; ++k) EXPECT_EQ(chunk.Column(2)[k], toth.Qe(ce[k], 360.0));
+
+//  Selecao pelos minimos e maximos
+
+const auto      index (reader.Select(1, 315.0, 345.0));
+
+    ASSERT_EQ(index.size(), 2);
+    EXPECT_EQ(index[0], 1);
+    EXPECT_EQ(index[1], 2);
+
+size_t          nvisit (0);
+
+    reader.ForEach  (   [](const ist::SweepReader::Chunk& _chunk) {return _chunk.max[1] < 310.0;}
+                    ,   [&](const ist::SweepReader::Chunk& _chunk) {nvisit += _chunk.nrows;}
+                    );
+
+    EXPECT_EQ(nvisit, NCE);
+
+}
+
+TEST_F(TestSuit, Interrompido) {
+
+    Write();
+
+//  Bloco incompleto no final: ignorado pelo leitor e removido ao reabrir
+
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 100);
+
+    EXPECT_EQ(ist::SweepReader(file.string()).NumberChunks(), 2);
+
+    {
+    ist::SweepWriter    writer (file.string());
+
+        Append(writer, 380.0);
+    }
+
+const ist::SweepReader  reader (file.string());
+
+    ASSERT_EQ(reader.NumberChunks(), 3);
+    EXPECT_EQ(reader.GetChunk(2).max[1], 380.0);
+
+}
+
+TEST_F(TestSuit, NaN) {
+
+//  NaN das linhas rejeitadas fora dos minimos e maximos; coluna somente com
+//  NaN em [-inf, +inf], para que o bloco nunca seja descartado
+
+const Real              nan (std::nan(""));
+ist::VecReal            t (NCE, 300.0);
+ist::VecReal            qe (NCE, nan);
+ist::VecReal            qeNaN (NCE, nan);
+
+    qe[NCE / 2] = 1.5;
+    qe[NCE - 1] = 2.5;
+
+    {
+    ist::SweepWriter    writer (file.string(), toth, {}, {"Ce", "T", "Qe"});
+
+        writer.Append({ce, t, qe});
+        writer.Append({ce, t, qeNaN});
+    }
+
+const ist::SweepReader  reader (file.string());
+
+    ASSERT_EQ(reader.NumberChunks(), 2);
+    EXPECT_EQ(reader.GetChunk(0).min[2], 1.5);
+    EXPECT_EQ(reader.GetChunk(0).max[2], 2.5);
+    EXPECT_TRUE(std::isinf(reader.GetChunk(1).min[2]) && reader.GetChunk(1).min[2] < 0.0);
+    EXPECT_TRUE(std::isinf(reader.GetChunk(1).max[2]) && reader.GetChunk(1).max[2] > 0.0);
+
+const auto      index (reader.Select(2, 2.0, 3.0));
+
+    ASSERT_EQ(index.size(), 2);
+    EXPECT_EQ(index[0], 0);
+    EXPECT_EQ(index[1], 1);
+
+    EXPECT_TRUE(reader.Select(2, 3.0, 4.0) == std::vector<size_t>{1});
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(ist::SweepReader reader("/dir/inexistente/dados.swp");, "");
+    EXPECT_DEATH(ist::SweepWriter writer(file.string(), toth, {}, {});, "");
+
+    Write();
+
+    EXPECT_DEATH(auto index = ist::SweepReader(file.string()).Select(3, 0.0, 1.0);, "");
+
+ist::SweepWriter    writer (file.string());
+ist::VecReal        small (NCE - 1);
+
+    EXPECT_DEATH(writer.Append({ce, ce});, "");
+    EXPECT_DEATH(writer.Append({ce, ce, small});, "");
+
+    {
+    std::ofstream   out (file, std::ios::binary | std::ios::trunc);
+
+        out << "texto qualquer, sem cabecalho valido";
+    }
+
+    EXPECT_DEATH(ist::SweepReader reader(file.string());, "");
+
+//  Cabecalho com mais colunas do que os nomes gravados
+
+    {
+    ist::SweepWriter    writer (file.string(), toth, {{"Ce", ce}, {"T", temp}}, {"Ce", "T", "Qe"});
+    }
+
+    {
+    std::fstream        out (file, std::ios::binary | std::ios::in | std::ios::out);
+    const std::uint32_t ncol (4);
+
+        out.seekp(20);
+        out.write(reinterpret_cast<const char*>(&ncol), sizeof(ncol));
+    }
+
+    EXPECT_DEATH(ist::SweepReader reader(file.string());, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
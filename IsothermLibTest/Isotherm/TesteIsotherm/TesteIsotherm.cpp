@@ -0,0 +1,237 @@
+//==============================================================================
+// Name        : TesteIsotherm.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste das funcoes da classe base Isotherm
+//               aplicadas a todos os modelos
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/OneParameter/Henry.h>                        // ist::Henry
+#include <Isotherm/TwoParameters/DubininRadushkevich.h>         // ist::DubininRadushkevich
+#include <Isotherm/TwoParameters/Elovich.h>                     // ist::Elovich
+#include <Isotherm/TwoParameters/Freundlich.h>                  // ist::Freundlich
+#include <Isotherm/TwoParameters/Halsey.h>                      // ist::Halsey
+#include <Isotherm/TwoParameters/HarkinJura.h>                  // ist::HarkinJura
+#include <Isotherm/TwoParameters/Jovanovic.h>                   // ist::Jovanovic
+#include <Isotherm/TwoParameters/Langmuir.h>                    // ist::Langmuir
+#include <Isotherm/TwoParameters/Temkin.h>                      // ist::Temkin
+#include <Isotherm/ThreeParameters/BrouersSotolongo.h>          // ist::BrouersSotolongo
+#include <Isotherm/ThreeParameters/BrunauerEmmettTeller.h>      // ist::BrunauerEmmettTeller
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>          // ist::FowlerGuggenheim
+#include <Isotherm/ThreeParameters/FritzSchlunder.h>            // ist::FritzSchlunder
+#include <Isotherm/ThreeParameters/Hill.h>                      // ist::Hill
+#include <Isotherm/ThreeParameters/HillDeBoer.h>                // ist::HillDeboer
+#include <Isotherm/ThreeParameters/HollKrich.h>                 // ist::HollKrich
+#include <Isotherm/ThreeParameters/Jossens.h>                   // ist::Jossens
+#include <Isotherm/ThreeParameters/Khan.h>                      // ist::Khan
+#include <Isotherm/ThreeParameters/Kiselev.h>                   // ist::Kiselev
+#include <Isotherm/ThreeParameters/KobleCorrigan.h>             // ist::KobleCorrigan
+#include <Isotherm/ThreeParameters/LangmuirFreundlich.h>        // ist::LangmuirFreundlich
+#include <Isotherm/ThreeParameters/MacMillanTeller.h>           // ist::MacMillanTeller
+#include <Isotherm/ThreeParameters/RadkePrausnitsI.h>           // ist::RadkePrausnitsI
+#include <Isotherm/ThreeParameters/RadkePrausnitsII.h>          // ist::RadkePrausnitsII
+#include <Isotherm/ThreeParameters/RadkePrausnitsIII.h>         // ist::RadkePrausnitsIII
+#include <Isotherm/ThreeParameters/RedlichPeterson.h>           // ist::RedlichPeterson
+#include <Isotherm/ThreeParameters/Sips.h>                      // ist::Sips
+#include <Isotherm/ThreeParameters/Toth.h>                      // ist::Toth
+#include <Isotherm/ThreeParameters/Unilan.h>                    // ist::Unilan
+#include <Isotherm/ThreeParameters/ValenzuelaMyers.h>           // ist::ValenzuelaMyers
+#include <Isotherm/ThreeParameters/ViethSladek.h>               // ist::ViethSladek
+#include <Isotherm/FourParameters/Baudu.h>                      // ist::Baudu
+#include <Isotherm/FourParameters/FritzSchlunderIV.h>           // ist::FritzSchlunderIV
+#include <Isotherm/FourParameters/MarczewskiJaroniec.h>         // ist::MarczewskiJaroniec
+#include <Isotherm/FourParameters/WeberVanVliet.h>              // ist::WeberVanVliet
+#include <Isotherm/FiveParameters/FrenkelHalseyHill.h>          // ist::FrenkelHalseyHill
+#include <Isotherm/FiveParameters/FritzSchlunderV.h>            // ist::FritzSchlunderV
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+//  Modelo com os coeficientes usados no teste da propria classe, as
+//  concentracoes avaliadas e a temperatura
+struct Caso {
+std::string                                         nome;
+std::function<std::unique_ptr<ist::Isotherm>()>     modelo;
+std::function<std::unique_ptr<ist::Isotherm>()>     vazio;      //! Construtora default
+std::vector<Real>                                   ce;
+Real                                                temp = 0;
+bool                                                inversa = false;    //! Ce(qe) testada
+Real                                                h = 1.0e-5;         //! Passo relativo da diferenca central
+Real                                                tole = 1.0e-7;      //! Tolerancia relativa de DQDC
+};
+
+template < typename T, typename... Coef >
+Caso Modelo (   const std::string&          _nome
+            ,   const std::vector<Real>&    _ce
+            ,   const Real&                 _temp
+            ,   const Coef&...              _coef
+            )
+{
+    return  {   _nome
+            ,   [=]() -> std::unique_ptr<ist::Isotherm> {return std::make_unique<T>(_coef...);}
+            ,   []() -> std::unique_ptr<ist::Isotherm> {return std::make_unique<T>();}
+            ,   _ce
+            ,   _temp
+            };
+}
+
+//  Concentracoes em torno de _ce
+std::vector<Real> Malha (const Real& _ce) {return {0.5 * _ce, _ce, 2.0 * _ce};}
+
+//  Modelos com isoterma inversa em forma fechada, por ExplicitCe ou, em Toth,
+//  pelo metodo generico
+Caso Inversa (Caso _caso) {_caso.inversa = true; return _caso;}
+
+//  Modelos implicitos: Qe resolvida por Newton-Raphson, DQDC pela funcao
+//  implicita, comparada com passo e tolerancia maiores
+Caso Implicito (Caso _caso) {_caso.h = 1.0e-4; _caso.tole = 1.0e-4; return _caso;}
+
+const std::vector<Caso>     MODELOS {
+    Inversa(Modelo < ist::Henry >                   ("Henry", Malha(2.0), 0.0, 15.0))
+,   Inversa(Modelo < ist::DubininRadushkevich >     ("DubininRadushkevich", Malha(0.799587), 62.9774, 0.364491, 0.00001850248241, 4.157231309))
+,   Implicito(Modelo < ist::Elovich >               ("Elovich", Malha(0.158198), 0.0, 3.62076, 0.0001984906254))
+,   Inversa(Modelo < ist::Freundlich >              ("Freundlich", Malha(0.362076), 0.0, 0.229774, 0.304665))
+,   Inversa(Modelo < ist::Halsey >                  ("Halsey", Malha(10.39620186), 0.0, 1.58198, 0.629774))
+,   Inversa(Modelo < ist::HarkinJura >              ("HarkinJura", Malha(4.103260), 0.0, 0.737732, 3.99010))
+,   Inversa(Modelo < ist::Jovanovic >               ("Jovanovic", Malha(0.524708), 0.0, 73.1322, 8.28677))
+,   Inversa(Modelo < ist::Langmuir >                ("Langmuir", Malha(0.138159), 0.0, 63.1638, 7.69755))
+,   Inversa(Modelo < ist::Temkin >                  ("Temkin", Malha(4.188692034), 88.0658, 0.876338, 0.730948, 4.157231309))
+,   Modelo < ist::BrouersSotolongo >                ("BrouersSotolongo", Malha(1.20177), 0.0, 1.87902, 0.698076, 8.60195)
+,   Inversa(Modelo < ist::BrunauerEmmettTeller >    ("BrunauerEmmettTeller", Malha(0.0653701), 0.0, 7.87989, 46.4727, 8.78584))
+,   Implicito(Modelo < ist::FowlerGuggenheim >      ("FowlerGuggenheim", Malha(0.0553181), 386.833, 68.1867, 5.42910, 3.27480))
+,   Modelo < ist::FritzSchlunder >                  ("FritzSchlunder", Malha(0.0607528), 0.0, 29.2378, 8.89086, 1.48761)
+,   Modelo < ist::Hill >                            ("Hill", Malha(0.362719), 0.0, 73.3332, 9.17652, 7.09033)
+,   Implicito(Modelo < ist::HillDeboer >            ("HillDeBoer", Malha(0.601932), 331.148, 69.2710, 9.30063, 5.67794))
+,   Modelo < ist::HollKrich >                       ("HollKrich", Malha(1.15488), 0.0, 7.86721, 7.73234, 3.35271)
+,   Modelo < ist::Jossens >                         ("Jossens", Malha(0.606125), 0.0, 5.59427, 3.02992, 2.00797)
+,   Modelo < ist::Khan >                            ("Khan", Malha(0.704439), 0.0, 21.3007, 4.61728, 5.64049)
+,   Implicito(Inversa(Modelo < ist::Kiselev >       ("Kiselev", Malha(0.249857), 0.0, 33.5812, 1.26172, 0.640606)))
+,   Modelo < ist::KobleCorrigan >                   ("KobleCorrigan", Malha(0.314521), 0.0, 5.92353, 2.56458, 0.506544)
+,   Modelo < ist::LangmuirFreundlich >              ("LangmuirFreundlich", Malha(0.692379), 0.0, 15.8130, 5.53199, 5.45859)
+//  MacMillanTeller abaixo de 2 CE, que esta junto da singularidade em Ce = K2
+,   Modelo < ist::MacMillanTeller >                 ("MacMillanTeller", {0.25 * 1.45062, 0.5 * 1.45062, 1.45062}, 0.0, 51.2889, 2.96726, 2.90583)
+,   Modelo < ist::RadkePrausnitsI >                 ("RadkePrausnitsI", Malha(1.97558), 0.0, 61.4681, 8.55061, 0.306220e-1)
+,   Modelo < ist::RadkePrausnitsII >                ("RadkePrausnitsII", Malha(1.10981), 0.0, 18.6634, 1.91479, 2.73215)
+,   Modelo < ist::RadkePrausnitsIII >               ("RadkePrausnitsIII", Malha(1.50068), 0.0, 9.54362, 8.23620, 2.40169)
+,   Inversa(Modelo < ist::RedlichPeterson >         ("RedlichPeterson", Malha(1.35757), 0.0, 3.88568, 2.76281, 0.00454748))
+//  Sips abaixo de CE: com 1/K2 = 42, Qe(CE) difere de qmax em 1e-9, a inversa
+//  perde precisao e a diferenca central nao resolve a derivada
+,   Inversa(Modelo < ist::Sips >                    ("Sips", {0.25 * 1.79986, 0.5 * 1.79986, 0.75 * 1.79986}, 0.0, 3.26828, 0.910566, 0.0237895))
+,   Inversa(Modelo < ist::Toth >                    ("Toth", Malha(1.12596), 0.0, 47.0956, 0.307156, 0.155428))
+,   Modelo < ist::Unilan >                          ("Unilan", Malha(1.29208), 0.0, 96.4634, 3.32592, 0.301917)
+,   Modelo < ist::ValenzuelaMyers >                 ("ValenzuelaMyers", Malha(1.00714), 0.0, 54.8240, 0.492822e-1, 0.926737e-1)
+,   Modelo < ist::ViethSladek >                     ("ViethSladek", Malha(1.47549), 0.0, 7.51932, 0.0309101, 0.0235572)
+,   Modelo < ist::Baudu >                           ("Baudu", Malha(1.84657), 0.0, 1.95325, 0.513664, 0.0435246, 0.605498e-2)
+,   Modelo < ist::FritzSchlunderIV >                ("FritzSchlunderIV", Malha(1.36520), 0.0, 71.3166, 0.357335, 0.779255, 0.669959)
+,   Modelo < ist::MarczewskiJaroniec >              ("MarczewskiJaroniec", Malha(1.68377), 0.0, 4.99159, 0.240965, 0.0686414, 0.0818727)
+,   Implicito(Modelo < ist::WeberVanVliet >         ("WeberVanVliet", Malha(1.56792), 0.0, 0.0870930, 3.19814, 0.0647897, 0.769393))
+,   Modelo < ist::FrenkelHalseyHill >               ("FrenkelHalseyHill", Malha(1.0), 0.0, 10.0, 1.0, 1.0, 0.7, 0.3)
+,   Modelo < ist::FritzSchlunderV >                 ("FritzSchlunderV", Malha(1.32730), 0.0, 6.05758, 0.217337, 0.885359e-1, 0.0169304, 0.746286e-1)
+};
+
+//  Modelos com a inversa testada
+std::vector<Caso> ComInversa ()
+{
+std::vector<Caso>   casos;
+
+    for (const auto& caso : MODELOS) if (caso.inversa) casos.push_back(caso);
+
+    return casos;
+}
+
+class TestSuitInversa : public ::testing::TestWithParam < Caso > {};
+class TestSuitDerivada : public ::testing::TestWithParam < Caso > {};
+
+TEST_P(TestSuitInversa, Inversa) {
+
+//  Ce(Qe(c)) = c, por ponto e em bloco
+const Caso&                 caso (GetParam());
+const auto                  iso (caso.modelo());
+const std::vector<Real>&    ce (caso.ce);
+std::vector<Real>           qe(ce.size()), cinv(ce.size());
+
+    iso->Qe(ce, qe, caso.temp);
+    iso->Ce(qe, cinv, caso.temp);
+
+    for (size_t k = 0; k < ce.size(); ++k) {
+        EXPECT_NEAR(cinv[k], ce[k], 1.0e-10 * ce[k]);
+        EXPECT_EQ(cinv[k], iso->Ce(qe[k], caso.temp));
+    }
+
+    EXPECT_DEATH(auto value = iso->Ce(- 1.0, caso.temp);, "");
+    EXPECT_DEATH(auto value = caso.vazio()->Ce(qe[0], caso.temp);, "");
+
+}
+
+TEST_P(TestSuitDerivada, Derivada) {
+
+//  DQDC contra diferenca central de Qe, por ponto e em bloco
+const Caso&                 caso (GetParam());
+const auto                  iso (caso.modelo());
+const std::vector<Real>&    ce (caso.ce);
+const Real                  h (caso.h);
+std::vector<Real>           dqdc(ce.size());
+
+    iso->DQDC(ce, dqdc, caso.temp);
+
+    for (size_t k = 0; k < ce.size(); ++k) {
+
+    const Real  fd ((iso->Qe(ce[k] * (1 + h), caso.temp) - iso->Qe(ce[k] * (1 - h), caso.temp)) / (2 * h * ce[k]));
+
+        EXPECT_NEAR(dqdc[k], fd, caso.tole * std::fabs(fd));
+        EXPECT_EQ(dqdc[k], iso->DQDC(ce[k], caso.temp));
+    }
+
+    EXPECT_DEATH(auto value = iso->DQDC(- ce[1], caso.temp);, "");
+
+}
+
+INSTANTIATE_TEST_SUITE_P    (   Modelos
+                            ,   TestSuitInversa
+                            ,   ::testing::ValuesIn(ComInversa())
+                            ,   [](const auto& _info) {return _info.param.nome;}
+                            );
+
+INSTANTIATE_TEST_SUITE_P    (   Modelos
+                            ,   TestSuitDerivada
+                            ,   ::testing::ValuesIn(MODELOS)
+                            ,   [](const auto& _info) {return _info.param.nome;}
+                            );
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+//==============================================================================
+// Name        : TesteAvrami.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Avrami
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <memory>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/Avrami.h>                        // ist::Avrami
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::Avrami TestModel;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QE          = 2.0;
+const Real              KAV         = 0.03;
+const Real              NAV         = 1.5;
+const size_t            NPTS        = 40;
+
+public:
+
+    ist::VecReal        time;
+
+    TestModel           model_1;
+    TestModel           model_2     = TestModel(QE, KAV, NAV);
+    TestModel           model_3     = TestModel(model_2);
+
+    void SetUp() override {
+        for (size_t k = 0; k < NPTS; ++k) time.push_back(2.0 * k);
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(model_2.className(), "Avrami");
+    EXPECT_EQ(model_3.NumberConst(), 3);
+    EXPECT_DOUBLE_EQ(model_3.Qe(), QE);
+    EXPECT_DOUBLE_EQ(model_3.Kav(), KAV);
+    EXPECT_DOUBLE_EQ(model_3.Nav(), NAV);
+    EXPECT_EQ(model_3.CodeString(0), "Qe");
+
+    model_1 = model_3;
+    EXPECT_EQ(model_1.Coefficients(), model_2.Coefficients());
+
+}
+
+TEST_F(TestSuit, Valores) {
+
+ist::VecReal     q(NPTS);
+
+    model_2.Qt(time, q);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+
+    const Real  t (time[k]);
+
+        EXPECT_NEAR(q[k], QE * (1.0 - std::exp(- std::pow(KAV * t, NAV))), 1.0e-12 * (1.0 + std::fabs(q[k])));
+        EXPECT_EQ(q[k], model_2.Qt(t));
+    }
+
+}
+
+TEST_F(TestSuit, Jacobiana) {
+
+ist::VecReal     jac(NPTS * 3);
+
+    model_2.Jacobian(time, jac);
+
+    {
+    const Real  h (1.0e-6 * QE);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(QE + h, KAV, NAV).Qt(time, qp);
+        TestModel(QE - h, KAV, NAV).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 3 + 0], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 3 + 0])));
+    }
+
+    {
+    const Real  h (1.0e-6 * KAV);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(QE, KAV + h, NAV).Qt(time, qp);
+        TestModel(QE, KAV - h, NAV).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 3 + 1], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 3 + 1])));
+    }
+
+    {
+    const Real  h (1.0e-6 * NAV);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(QE, KAV, NAV + h).Qt(time, qp);
+        TestModel(QE, KAV, NAV - h).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 3 + 2], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 3 + 2])));
+    }
+
+}
+
+TEST_F(TestSuit, Ajuste) {
+
+ist::VecReal     data(NPTS);
+
+    model_2.Qt(time, data);
+
+TestModel   model (1.3 * QE, 0.7 * KAV, 1.3 * NAV);
+const Real  sse (model.Fit(time, data));
+
+    EXPECT_LT(sse, 1.0e-16);
+    EXPECT_NEAR(model.Qe(), QE, 1.0e-6 * QE);
+    EXPECT_NEAR(model.Kav(), KAV, 1.0e-6 * KAV);
+    EXPECT_NEAR(model.Nav(), NAV, 1.0e-6 * NAV);
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::VecReal     q(NPTS - 1);
+
+    EXPECT_DEATH(TestModel(- QE, KAV, NAV);, "");
+    EXPECT_DEATH(TestModel(QE, - KAV, NAV);, "");
+    EXPECT_DEATH(TestModel(QE, KAV, - NAV);, "");
+    EXPECT_DEATH(auto value = model_1.Qt(1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qt(- 1.0);, "");
+    EXPECT_DEATH(model_2.Qt(time, q);, "");
+    EXPECT_DEATH(model_2.Fit(time, q);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,160 @@
+//==============================================================================
+// Name        : TesteElovichKinetic.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe ElovichKinetic
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <memory>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/ElovichKinetic.h>                        // ist::ElovichKinetic
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::ElovichKinetic TestModel;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              ALPHA       = 0.5;
+const Real              BETA        = 2.0;
+const size_t            NPTS        = 40;
+
+public:
+
+    ist::VecReal        time;
+
+    TestModel           model_1;
+    TestModel           model_2     = TestModel(ALPHA, BETA);
+    TestModel           model_3     = TestModel(model_2);
+
+    void SetUp() override {
+        for (size_t k = 0; k < NPTS; ++k) time.push_back(2.0 * k);
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(model_2.className(), "ElovichKinetic");
+    EXPECT_EQ(model_3.NumberConst(), 2);
+    EXPECT_DOUBLE_EQ(model_3.Alpha(), ALPHA);
+    EXPECT_DOUBLE_EQ(model_3.Beta(), BETA);
+    EXPECT_EQ(model_3.CodeString(0), "Alpha");
+
+    model_1 = model_3;
+    EXPECT_EQ(model_1.Coefficients(), model_2.Coefficients());
+
+}
+
+TEST_F(TestSuit, Valores) {
+
+ist::VecReal     q(NPTS);
+
+    model_2.Qt(time, q);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+
+    const Real  t (time[k]);
+
+        EXPECT_NEAR(q[k], std::log(1.0 + ALPHA * BETA * t) / BETA, 1.0e-12 * (1.0 + std::fabs(q[k])));
+        EXPECT_EQ(q[k], model_2.Qt(t));
+    }
+
+}
+
+TEST_F(TestSuit, Jacobiana) {
+
+ist::VecReal     jac(NPTS * 2);
+
+    model_2.Jacobian(time, jac);
+
+    {
+    const Real  h (1.0e-6 * ALPHA);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(ALPHA + h, BETA).Qt(time, qp);
+        TestModel(ALPHA - h, BETA).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 2 + 0], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 2 + 0])));
+    }
+
+    {
+    const Real  h (1.0e-6 * BETA);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(ALPHA, BETA + h).Qt(time, qp);
+        TestModel(ALPHA, BETA - h).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 2 + 1], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 2 + 1])));
+    }
+
+}
+
+TEST_F(TestSuit, Ajuste) {
+
+ist::VecReal     data(NPTS);
+
+    model_2.Qt(time, data);
+
+TestModel   model (1.3 * ALPHA, 0.7 * BETA);
+const Real  sse (model.Fit(time, data));
+
+    EXPECT_LT(sse, 1.0e-16);
+    EXPECT_NEAR(model.Alpha(), ALPHA, 1.0e-6 * ALPHA);
+    EXPECT_NEAR(model.Beta(), BETA, 1.0e-6 * BETA);
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::VecReal     q(NPTS - 1);
+
+    EXPECT_DEATH(TestModel(- ALPHA, BETA);, "");
+    EXPECT_DEATH(TestModel(ALPHA, - BETA);, "");
+    EXPECT_DEATH(auto value = model_1.Qt(1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qt(- 1.0);, "");
+    EXPECT_DEATH(model_2.Qt(time, q);, "");
+    EXPECT_DEATH(model_2.Fit(time, q);, "");
+    EXPECT_DEATH(model_2.Equilibrium(ist::Langmuir(1.0, 1.0), 1.0);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
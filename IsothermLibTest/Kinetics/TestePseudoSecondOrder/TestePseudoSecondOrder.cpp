@@ -0,0 +1,210 @@
+//==============================================================================
+// Name        : TestePseudoSecondOrder.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe PseudoSecondOrder
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <memory>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Kinetics/PseudoSecondOrder.h>                        // ist::PseudoSecondOrder
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::PseudoSecondOrder TestModel;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QE          = 2.0;
+const Real              K2          = 0.02;
+const size_t            NPTS        = 40;
+
+public:
+
+    ist::VecReal        time;
+
+    TestModel           model_1;
+    TestModel           model_2     = TestModel(QE, K2);
+    TestModel           model_3     = TestModel(model_2);
+
+    void SetUp() override {
+        for (size_t k = 0; k < NPTS; ++k) time.push_back(2.0 * k);
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(model_2.className(), "PseudoSecondOrder");
+    EXPECT_EQ(model_3.NumberConst(), 2);
+    EXPECT_DOUBLE_EQ(model_3.Qe(), QE);
+    EXPECT_DOUBLE_EQ(model_3.K2(), K2);
+    EXPECT_EQ(model_3.CodeString(0), "Qe");
+
+    model_1 = model_3;
+    EXPECT_EQ(model_1.Coefficients(), model_2.Coefficients());
+
+}
+
+TEST_F(TestSuit, Valores) {
+
+ist::VecReal     q(NPTS);
+
+    model_2.Qt(time, q);
+
+    for (size_t k = 0; k < NPTS; ++k) {
+
+    const Real  t (time[k]);
+
+        EXPECT_NEAR(q[k], QE * QE * K2 * t / (1.0 + QE * K2 * t), 1.0e-12 * (1.0 + std::fabs(q[k])));
+        EXPECT_EQ(q[k], model_2.Qt(t));
+    }
+
+}
+
+TEST_F(TestSuit, Jacobiana) {
+
+ist::VecReal     jac(NPTS * 2);
+
+    model_2.Jacobian(time, jac);
+
+    {
+    const Real  h (1.0e-6 * QE);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(QE + h, K2).Qt(time, qp);
+        TestModel(QE - h, K2).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 2 + 0], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 2 + 0])));
+    }
+
+    {
+    const Real  h (1.0e-6 * K2);
+    ist::VecReal     qp(NPTS), qm(NPTS);
+
+        TestModel(QE, K2 + h).Qt(time, qp);
+        TestModel(QE, K2 - h).Qt(time, qm);
+
+        for (size_t k = 0; k < NPTS; ++k)
+            EXPECT_NEAR(jac[k * 2 + 1], 0.5 * (qp[k] - qm[k]) / h, 1.0e-6 * (1.0 + std::fabs(jac[k * 2 + 1])));
+    }
+
+}
+
+TEST_F(TestSuit, Ajuste) {
+
+ist::VecReal     data(NPTS);
+
+    model_2.Qt(time, data);
+
+TestModel   model (1.3 * QE, 0.7 * K2);
+const Real  sse (model.Fit(time, data));
+
+    EXPECT_LT(sse, 1.0e-16);
+    EXPECT_NEAR(model.Qe(), QE, 1.0e-6 * QE);
+    EXPECT_NEAR(model.K2(), K2, 1.0e-6 * K2);
+
+}
+
+TEST_F(TestSuit, Equilibrio) {
+
+//  qe fornecido pela isoterma de Langmuir e mantido fixo; so k2 e ajustado
+ist::Langmuir   langmuir (4.0, 1.0);
+const Real      ce (1.0);
+TestModel       model (1.0, 0.7 * K2);
+
+    model.Equilibrium(langmuir, ce);
+
+    EXPECT_TRUE(model.Fixed(0));
+    EXPECT_FALSE(model.Fixed(1));
+    EXPECT_DOUBLE_EQ(model.Qe(), langmuir.Qe(ce, 0));
+
+ist::VecReal         data(NPTS);
+
+    TestModel(langmuir.Qe(ce, 0), K2).Qt(time, data);
+    model.Fit(time, data);
+
+    EXPECT_DOUBLE_EQ(model.Qe(), langmuir.Qe(ce, 0));
+    EXPECT_NEAR(model.K2(), K2, 1.0e-6 * K2);
+
+}
+
+TEST_F(TestSuit, AjusteParalelo) {
+
+//  Varias corridas com qe diferentes, ajustadas em paralelo e em serie
+const size_t                                        NRUNS (200);
+std::vector < std::unique_ptr < ist::Kinetics > >   parallel, serial;
+std::vector < ist::VecReal >                        times(NRUNS, time), data(NRUNS, ist::VecReal(NPTS));
+ist::VecReal                                        ssePar, sseSer;
+
+    for (size_t r = 0; r < NRUNS; ++r) {
+        TestModel(QE * (1.0 + 0.01 * r), K2).Qt(time, data[r]);
+        parallel.push_back(std::make_unique<TestModel>(QE, 0.5 * K2));
+        serial.push_back(std::make_unique<TestModel>(QE, 0.5 * K2));
+    }
+
+    ist::Kinetics::Fit(parallel, times, data, ssePar, 4);
+    ist::Kinetics::Fit(serial, times, data, sseSer, 1);
+
+    for (size_t r = 0; r < NRUNS; ++r) {
+        EXPECT_NEAR(parallel[r]->Coefficients()[0], QE * (1.0 + 0.01 * r), 1.0e-6 * QE);
+        EXPECT_EQ(parallel[r]->Coefficients(), serial[r]->Coefficients());
+        EXPECT_EQ(ssePar[r], sseSer[r]);
+    }
+
+    data.pop_back();
+    EXPECT_DEATH(ist::Kinetics::Fit(parallel, times, data, ssePar);, "");
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::VecReal     q(NPTS - 1);
+
+    EXPECT_DEATH(TestModel(- QE, K2);, "");
+    EXPECT_DEATH(TestModel(QE, - K2);, "");
+    EXPECT_DEATH(auto value = model_1.Qt(1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qt(- 1.0);, "");
+    EXPECT_DEATH(model_2.Qt(time, q);, "");
+    EXPECT_DEATH(model_2.Fit(time, q);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+//==============================================================================
+// Name        : TesteSolverStats.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe SolverStats
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Isotherm/ThreeParameters/Toth.h>                  // ist::Toth
+#include <Misc/SolverStats.h>                               // ist::SolverStats
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 68.1867;
+const Real              K1          = 5.42910;
+const Real              K2          = 3.27480;
+const Real              TEMP        = 298.15;
+const size_t            NCE         = 100;
+
+public:
+
+    void SetUp() override {
+        ist::SolverStats::Timing(false);
+        ist::SolverStats::Reset();
+    }
+
+//  NCE chamadas de Qe, que resolve theta por Newton-Raphson
+    void Solve () {
+
+    const ist::FowlerGuggenheim     iso (QMAX, K1, K2);
+
+        for (size_t k = 0; k < NCE; ++k) EXPECT_GT(iso.Qe(1.0e-3 * (k + 1), TEMP), 0.0);
+    }
+
+};
+
+TEST_F(TestSuit, NewtonRaphson) {
+
+    Solve();
+
+const auto  value (ist::SolverStats::Get(ist::ID::FowlerGuggenheim));
+
+    if (!ist::SolverStats::Enabled()) {
+        EXPECT_TRUE(ist::SolverStats::Snapshot().empty());
+        EXPECT_EQ(value.calls, 0);
+        return;
+    }
+
+    EXPECT_EQ(value.calls, NCE);
+    EXPECT_EQ(value.failures, 0);
+    EXPECT_GE(value.iterations, 3 * NCE);
+    EXPECT_GE(value.maxIterations, 3);
+    EXPECT_LE(value.maxIterations, 101);
+    EXPECT_EQ(value.evaluations, 2 * value.iterations);
+    EXPECT_EQ(value.cycles, 0);
+    EXPECT_GE(value.MeanIterations(), 3.0);
+
+//  Reset zera os contadores
+
+    ist::SolverStats::Reset();
+
+    EXPECT_TRUE(ist::SolverStats::Snapshot().empty());
+
+}
+
+TEST_F(TestSuit, BracketedNewton) {
+
+//  Toth nao tem Ce explicito: Ce usa o metodo generico
+
+const ist::Toth     toth (2.76, 0.39, 0.57);
+
+    for (size_t k = 0; k < NCE; ++k) EXPECT_NEAR(toth.Qe(toth.Ce(0.01 * (k + 1))), 0.01 * (k + 1), 1.0e-6);
+
+const auto  value (ist::SolverStats::Get(ist::ID::Toth));
+
+    if (!ist::SolverStats::Enabled()) {
+        EXPECT_EQ(value.calls, 0);
+        return;
+    }
+
+    EXPECT_EQ(value.calls, NCE);
+    EXPECT_EQ(value.failures, 0);
+    EXPECT_EQ(value.evaluations, value.iterations);
+    EXPECT_GE(value.iterations, NCE);
+
+}
+
+TEST_F(TestSuit, Threads) {
+
+//  Threads ja encerradas continuam somadas
+
+const size_t                NTHREADS (4);
+std::vector<std::thread>    pool;
+
+    ist::SolverStats::Timing(true);
+
+    for (size_t t = 0; t < NTHREADS; ++t) pool.emplace_back([this](){ Solve(); });
+    for (auto& thr : pool) thr.join();
+
+const auto  value (ist::SolverStats::Get(ist::ID::FowlerGuggenheim));
+
+    EXPECT_TRUE(ist::SolverStats::Timing());
+
+    if (!ist::SolverStats::Enabled()) {
+        EXPECT_EQ(value.calls, 0);
+        return;
+    }
+
+    EXPECT_EQ(value.calls, NTHREADS * NCE);
+    EXPECT_GT(value.cycles, 0);
+
+}
+
+TEST_F(TestSuit, Relatorios) {
+
+    Solve();
+
+const std::string   json (ist::SolverStats::Json());
+const std::string   text (ist::SolverStats::Text());
+
+    EXPECT_EQ(text.find("Modelo"), 0);
+    EXPECT_EQ(ist::SolverStats::Name(ist::ID::Toth), "Toth");
+
+    if (!ist::SolverStats::Enabled()) {
+        EXPECT_EQ(json, "{\"enabled\":false,\"timing\":false,\"models\":[]}\n");
+        return;
+    }
+
+    EXPECT_EQ(json.find("{\"enabled\":true,\"timing\":false,\"models\":[\n{\"id\":305,\"model\":\"Fowler - Guggenheim\",\"calls\":100,"), 0);
+    EXPECT_NE(text.find("Fowler - Guggenheim"), std::string::npos);
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,203 @@
+//==============================================================================
+// Name        : TesteSweep.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Sweep
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Isotherm/ThreeParameters/Toth.h>                  // ist::Toth
+#include <Misc/Sweep.h>                                     // ist::Sweep
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 2.76;
+const Real              K1          = 0.39;
+const Real              K2          = 0.57;
+const size_t            NCE         = 3001;
+
+public:
+
+    ist::Toth               toth        = ist::Toth(QMAX, K1, K2);
+    ist::VecReal            ce;
+    ist::VecReal            temp        {300.0, 320.0};
+    std::vector<ist::VecReal>   coef    {{2.0, 2.76, 3.5}, {}, {0.4, 0.57}};
+
+    ist::ThreadPool         pool        = ist::ThreadPool(4);
+
+    std::filesystem::path   file        = std::filesystem::temp_directory_path() / "TesteSweep.bin";
+
+    void SetUp() override {
+        for (size_t k = 0; k < NCE; ++k) ce.push_back(1.0e-3 * (k + 1));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+
+//  Compara com Qe escalar num modelo construido com os coeficientes do conjunto
+    void Check (const ist::Sweep& _sweep, const ist::VecReal& _qe) {
+
+        for (size_t s = 0; s < _sweep.NumberSets(); ++s) {
+
+        const ist::VecReal  par (_sweep.Parameters(s));
+        const ist::Toth     iso (par[0], par[1], par[2]);
+
+            for (size_t t = 0; t < _sweep.NumberTemperatures(); ++t)
+                for (size_t c = 0; c < _sweep.NumberCe(); c += 37)
+                    EXPECT_DOUBLE_EQ(_qe[_sweep.Index(s, t, c)], iso.Qe(ce[c], temp[t]));
+        }
+    }
+
+};
+
+TEST_F(TestSuit, Grade) {
+
+const ist::Sweep    sweep (toth, coef, ce, temp);
+
+    EXPECT_EQ(sweep.NumberSets(), 6);
+    EXPECT_EQ(sweep.NumberTemperatures(), 2);
+    EXPECT_EQ(sweep.NumberPoints(), 6 * 2 * NCE);
+    EXPECT_EQ(sweep.Index(1, 1, 5), (1 * 2 + 1) * NCE + 5);
+
+//  Ultimo coeficiente varia mais rapido; grade vazia mantem o valor do modelo
+
+    EXPECT_EQ(sweep.Parameters(0), ist::VecReal({2.0, K1, 0.4}));
+    EXPECT_EQ(sweep.Parameters(1), ist::VecReal({2.0, K1, 0.57}));
+    EXPECT_EQ(sweep.Parameters(5), ist::VecReal({3.5, K1, 0.57}));
+
+//  Sem grade de T: T = 0
+
+const ist::Sweep    single (toth, {{}, {}, {}}, ce);
+
+    EXPECT_EQ(single.NumberSets(), 1);
+    EXPECT_EQ(single.NumberPoints(), NCE);
+
+}
+
+TEST_F(TestSuit, Memoria) {
+
+const ist::Sweep    sweep (toth, coef, ce, temp);
+ist::VecReal        qe (sweep.NumberPoints());
+
+    sweep.Run(qe, pool);
+
+    Check(sweep, qe);
+
+//  Mesmo resultado em serie
+
+ist::ThreadPool     serial (1);
+ist::VecReal        qeSerial (sweep.NumberPoints());
+
+    sweep.Run(qeSerial, serial);
+
+    EXPECT_EQ(qe, qeSerial);
+
+}
+
+TEST_F(TestSuit, Arquivo) {
+
+const ist::Sweep    sweep (toth, coef, ce, temp);
+
+    sweep.Run(file.string(), pool);
+
+    ASSERT_EQ(std::filesystem::file_size(file), sweep.NumberPoints() * sizeof(Real));
+
+ist::VecReal        qe (sweep.NumberPoints());
+std::ifstream       in (file, std::ios::binary);
+
+    in.read(reinterpret_cast<char*>(qe.data()), qe.size() * sizeof(Real));
+
+    Check(sweep, qe);
+
+}
+
+TEST_F(TestSuit, Invalido) {
+
+//  qmax <= 0 e rejeitado pelo modelo: NaN no conjunto inteiro
+
+const ist::Sweep    sweep (toth, {{-1.0, QMAX}, {}, {}}, ce, temp);
+ist::VecReal        qe (sweep.NumberPoints());
+
+    sweep.Run(qe, pool);
+
+    for (size_t k = 0; k < 2 * NCE; ++k) EXPECT_TRUE(std::isnan(qe[k]));
+    for (size_t k = 2 * NCE; k < qe.size(); ++k) EXPECT_FALSE(std::isnan(qe[k]));
+
+}
+
+TEST_F(TestSuit, Implicito) {
+
+//  Modelo resolvido por Newton-Raphson, com um clone por trabalhador
+
+const Real                      TEMP (298.15);
+const ist::FowlerGuggenheim     fg (68.1867, 5.42910, 3.27480);
+const ist::Sweep                sweep (fg, {{60.0, 68.1867}, {5.0, 5.4291}, {}}, ist::VecReal(ce.begin(), ce.begin() + 500), {TEMP});
+ist::VecReal                    qe (sweep.NumberPoints());
+
+    sweep.Run(qe, pool);
+
+    for (size_t s = 0; s < sweep.NumberSets(); ++s) {
+
+    const ist::VecReal              par (sweep.Parameters(s));
+    const ist::FowlerGuggenheim     iso (par[0], par[1], par[2]);
+
+        for (size_t c = 0; c < sweep.NumberCe(); c += 17)
+            EXPECT_DOUBLE_EQ(qe[sweep.Index(s, 0, c)], iso.Qe(ce[c], TEMP));
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::VecReal        small (10);
+
+    EXPECT_DEATH(ist::Sweep sweep(toth, {{}, {}}, ce);, "");
+    EXPECT_DEATH(ist::Sweep sweep(toth, coef, {});, "");
+    EXPECT_DEATH(ist::Sweep(toth, coef, ce).Run(small, pool);, "");
+    EXPECT_DEATH(ist::Sweep(toth, coef, ce).Run("/dir/inexistente/sweep.bin", pool);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,235 @@
+//==============================================================================
+// Name        : TesteThreadPool.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe ThreadPool
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Elovich.h>                 // ist::Elovich
+#include <Isotherm/TwoParameters/Langmuir.h>                // ist::Langmuir
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Isotherm/ThreeParameters/HillDeboer.h>            // ist::HillDeboer
+#include <Isotherm/ThreeParameters/Kiselev.h>               // ist::Kiselev
+#include <Isotherm/FourParameters/WeberVanVliet.h>          // ist::WeberVanVliet
+#include <Misc/ThreadPool.h>                                // ist::ThreadPool
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const UInt              NTHREADS    = 4;
+const size_t            NTASKS      = 1000;
+
+public:
+
+    ist::ThreadPool     pool        = ist::ThreadPool(NTHREADS);
+
+};
+
+TEST_F(TestSuit, Tarefas) {
+
+//  Cada tarefa executada uma unica vez, em varios lotes
+
+std::vector<std::atomic<int>>   count (NTASKS);
+
+    EXPECT_EQ(pool.NumberWorkers(), NTHREADS);
+
+    for (size_t lote = 0; lote < 10; ++lote) {
+        pool.Run(NTASKS, [&](const size_t& _k, const UInt& _w) {
+            EXPECT_LT(_w, NTHREADS);
+            count[_k].fetch_add(1);
+        });
+    }
+
+    for (const auto& c : count) EXPECT_EQ(c.load(), 10);
+
+    pool.Run(0, [](const size_t&, const UInt&) { FAIL(); });
+
+}
+
+TEST_F(TestSuit, Roubo) {
+
+//  As primeiras tarefas, da fila do trabalhador 0, sao lentas: as demais
+//  filas terminam antes e roubam o restante
+
+std::vector<UInt>       worker (NTASKS);
+const size_t            nslow (NTASKS / NTHREADS);
+
+    pool.Run(NTASKS, [&](const size_t& _k, const UInt& _w) {
+        if (_k < nslow) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        worker[_k] = _w;
+    });
+
+size_t      nstolen (0);
+
+    for (size_t k = 0; k < nslow; ++k) if (worker[k] != 0) ++nstolen;
+
+    EXPECT_GT(nstolen, 0);
+
+}
+
+TEST_F(TestSuit, Aninhado) {
+
+//  Lote dentro de uma tarefa: executado em serie pela propria thread
+
+std::atomic<size_t>     total (0);
+
+    pool.Run(NTHREADS, [&](const size_t&, const UInt&) {
+        pool.Run(10, [&](const size_t&, const UInt& _w) {
+            EXPECT_EQ(_w, 0);
+            total.fetch_add(1);
+        });
+    });
+
+    EXPECT_EQ(total.load(), 10 * NTHREADS);
+
+}
+
+TEST_F(TestSuit, Excecao) {
+
+std::atomic<size_t>     ndone (0);
+
+    EXPECT_THROW(pool.Run(NTASKS, [&](const size_t& _k, const UInt&) {
+                    if (_k == 7) throw std::runtime_error("tarefa 7");
+                    ndone.fetch_add(1);
+                 }), std::runtime_error);
+
+    EXPECT_EQ(ndone.load(), NTASKS - 1);
+
+//  O conjunto continua utilizavel
+
+    ndone = 0;
+    pool.Run(NTASKS, [&](const size_t&, const UInt&) { ndone.fetch_add(1); });
+
+    EXPECT_EQ(ndone.load(), NTASKS);
+
+}
+
+TEST_F(TestSuit, Default) {
+
+    EXPECT_EQ(&ist::ThreadPool::Default(), &ist::ThreadPool::Default());
+    EXPECT_GE(ist::ThreadPool::Default().NumberWorkers(), 1);
+
+ist::ThreadPool         serial (1);
+std::vector<size_t>     order;
+
+    serial.Run(5, [&](const size_t& _k, const UInt&) { order.push_back(_k); });
+
+    EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3, 4}));
+
+}
+
+TEST_F(TestSuit, Isoterma) {
+
+//  Qe e DQDC em bloco divididas entre as threads de pool, que devem
+//  reproduzir a avaliacao em serie
+
+const ist::Langmuir     iso (63.1638, 7.69755);
+const size_t            NPTO (5000);
+std::vector<Real>       ce (NPTO), qe (NPTO), qePool (NPTO), dqdc (NPTO), dqdcPool (NPTO);
+
+    for (size_t k = 0; k < NPTO; ++k) ce[k] = 1.0e-3 * (k + 1);
+
+    iso.Qe(ce, qe);
+    iso.DQDC(ce, dqdc);
+    iso.ParallelQe(ce, qePool, 0.0, &pool);
+    iso.ParallelDQDC(ce, dqdcPool, 0.0, &pool);
+
+    EXPECT_EQ(qePool, qe);
+    EXPECT_EQ(dqdcPool, dqdc);
+
+}
+
+TEST(Implicitos, Concorrencia) {
+
+//  Os cinco modelos implicitos avaliados ao mesmo tempo por 8 threads: cada
+//  tarefa resolve um bloco de um modelo, de modo que o mesmo modelo e
+//  modelos diferentes correm em paralelo e devem reproduzir Qe e DQDC por ponto
+
+const ist::Elovich          elovich (3.62076, 0.0001984906254);
+const ist::Kiselev          kiselev (33.5812, 1.26172, 0.640606);
+const ist::FowlerGuggenheim fg (68.1867, 5.42910, 3.27480);
+const ist::HillDeboer       hdb (69.2710, 9.30063, 5.67794);
+const ist::WeberVanVliet    wvv (0.0870930, 3.19814, 0.0647897, 0.769393);
+
+struct Modelo {const ist::Isotherm* iso; Real ce; Real temp;};
+const Modelo                MODELOS[] { {&elovich, 0.158198, 0.0}, {&kiselev, 0.249857, 0.0},
+                                        {&fg, 0.0553181, 386.833}, {&hdb, 0.601932, 331.148},
+                                        {&wvv, 1.56792, 0.0} };
+const size_t                NMOD (std::size(MODELOS));
+const size_t                NPTO (2000);
+const size_t                NBLOCO (16);
+const size_t                CHUNK (NPTO / NBLOCO);
+
+ist::ThreadPool             pool (8);
+std::vector<std::vector<Real>>  ce (NMOD, std::vector<Real>(NPTO));
+std::vector<std::vector<Real>>  qe (ce), dqdc (ce), qePool (ce), qeUnseq (ce);
+
+    for (size_t i = 0; i < NMOD; ++i) {
+        for (size_t k = 0; k < NPTO; ++k) ce[i][k] = MODELOS[i].ce * (0.5 + static_cast<Real>(k) / NPTO);
+    }
+
+    pool.Run(NMOD * NBLOCO, [&](const size_t& _k, const UInt&) {
+        const size_t    i (_k / NBLOCO);
+        const size_t    ini ((_k % NBLOCO) * CHUNK);
+        const auto      bloco (std::span<const Real>{ce[i]}.subspan(ini, CHUNK));
+        MODELOS[i].iso->Qe(bloco, std::span<Real>(qe[i]).subspan(ini, CHUNK), MODELOS[i].temp);
+        MODELOS[i].iso->DQDC(bloco, std::span<Real>(dqdc[i]).subspan(ini, CHUNK), MODELOS[i].temp);
+    });
+
+    for (size_t i = 0; i < NMOD; ++i) {
+        MODELOS[i].iso->ParallelQe(ce[i], qePool[i], MODELOS[i].temp, &pool);
+        MODELOS[i].iso->Qe(std::execution::par_unseq, ce[i], qeUnseq[i], MODELOS[i].temp);
+
+        for (size_t k = 0; k < NPTO; ++k) {
+            EXPECT_DOUBLE_EQ(qe[i][k], MODELOS[i].iso->Qe(ce[i][k], MODELOS[i].temp));
+            EXPECT_DOUBLE_EQ(dqdc[i][k], MODELOS[i].iso->DQDC(ce[i][k], MODELOS[i].temp));
+            EXPECT_DOUBLE_EQ(qePool[i][k], qe[i][k]);
+            EXPECT_DOUBLE_EQ(qeUnseq[i][k], qe[i][k]);
+        }
+    }
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+//==============================================================================
+// Name        : TesteTrace.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Trace
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Misc/Trace.h>                                     // ist::Trace
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 68.1867;
+const Real              K1          = 5.42910;
+const Real              K2          = 3.27480;
+const Real              TEMP        = 298.15;
+const size_t            NCE         = 64;
+
+public:
+
+    void SetUp() override {
+        ist::Trace::Stop();
+        ist::Trace::Clear();
+    }
+
+    void TearDown() override {
+        ist::Trace::Stop();
+        ist::Trace::Clear();
+    }
+
+//  Qe em bloco, que resolve theta por Newton-Raphson em cada ponto
+    void Solve () {
+
+    const ist::FowlerGuggenheim     iso (QMAX, K1, K2);
+    std::vector<Real>               ce (NCE), qe (NCE);
+
+        for (size_t k = 0; k < NCE; ++k) ce[k] = 1.0e-3 * (k + 1);
+
+        iso.Qe(ce, qe, TEMP);
+
+        for (size_t k = 0; k < NCE; ++k) EXPECT_GT(qe[k], 0.0);
+    }
+
+};
+
+TEST_F(TestSuit, Desligado) {
+
+    Solve();
+
+    EXPECT_FALSE(ist::Trace::Enabled());
+    EXPECT_EQ(ist::Trace::NumberEvents(), 0);
+    EXPECT_EQ(ist::Trace::Json(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[]}\n");
+
+}
+
+TEST_F(TestSuit, Zonas) {
+
+    ist::Trace::Start();
+
+    EXPECT_TRUE(ist::Trace::Enabled());
+
+    Solve();
+
+    ist::Trace::Stop();
+
+//  Uma zona do bloco e uma de cada Newton-Raphson
+
+    EXPECT_EQ(ist::Trace::NumberEvents(), NCE + 1);
+    EXPECT_EQ(ist::Trace::Dropped(), 0);
+
+const std::string   json (ist::Trace::Json());
+
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0);
+    EXPECT_NE(json.find("{\"name\":\"Qe\",\"cat\":\"isotherm\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"NewtonRaphson\",\"cat\":\"solver\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"M\""), std::string::npos);
+
+//  Desligado, nada mais e gravado
+
+    Solve();
+
+    EXPECT_EQ(ist::Trace::NumberEvents(), NCE + 1);
+
+}
+
+TEST_F(TestSuit, Threads) {
+
+const size_t                NTHREADS (4);
+std::vector<std::thread>    pool;
+
+    ist::Trace::Start();
+
+    for (size_t t = 0; t < NTHREADS; ++t) pool.emplace_back([this](){ Solve(); });
+    for (auto& thr : pool) thr.join();
+
+    ist::Trace::Stop();
+
+    EXPECT_EQ(ist::Trace::NumberEvents(), NTHREADS * (NCE + 1));
+
+//  Uma linha por area usada
+
+const std::string   json (ist::Trace::Json());
+size_t              nthreads (0);
+
+    for (size_t pos = json.find("\"thread_name\""); pos != std::string::npos; pos = json.find("\"thread_name\"", pos + 1)) ++nthreads;
+
+    EXPECT_GE(nthreads, 1);
+    EXPECT_LE(nthreads, NTHREADS);
+
+}
+
+TEST_F(TestSuit, Descarte) {
+
+//  A area circular guarda os CAPACITY eventos mais recentes
+
+const size_t    nextra (10);
+
+    ist::Trace::Start();
+
+    for (size_t k = 0; k < ist::Trace::CAPACITY + nextra; ++k) {
+        IST_TRACE("Zona", "teste");
+    }
+
+    ist::Trace::Stop();
+
+    EXPECT_EQ(ist::Trace::NumberEvents(), ist::Trace::CAPACITY);
+    EXPECT_EQ(ist::Trace::Dropped(), nextra);
+
+}
+
+TEST_F(TestSuit, Arquivo) {
+
+const std::string   file ("TesteTrace.json");
+
+    ist::Trace::Start();
+
+    Solve();
+
+    ist::Trace::Stop();
+    ist::Trace::Save(file);
+
+std::ifstream       in (file);
+std::stringstream   text;
+
+    text << in.rdbuf();
+
+    EXPECT_EQ(text.str(), ist::Trace::Json());
+
+    std::remove(file.c_str());
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+const std::string   file ("/dir/inexistente/trace.json");
+
+    EXPECT_DEATH(ist::Trace::Save(file);, "");
+
+//  Erro na gravacao ao final do programa: informado, sem alterar o codigo
+//  de saida
+
+    EXPECT_EXIT({ist::Trace::Start(file); std::exit(0);}, ::testing::ExitedWithCode(0), "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
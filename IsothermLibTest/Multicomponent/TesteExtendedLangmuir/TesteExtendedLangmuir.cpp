@@ -0,0 +1,141 @@
+//==============================================================================
+// Name        : TesteExtendedLangmuir.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe ExtendedLangmuir
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/ExtendedLangmuir.h>            // ist::ExtendedLangmuir
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::ExtendedLangmuir TestIsotherm;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              CE1         = 1.79986;
+const Real              CE2         = 0.53211;
+const Real              QMAX1       = 3.26828;
+const Real              K11         = 0.910566;
+const Real              QMAX2       = 1.52001;
+const Real              K12         = 2.38941;
+
+public:
+
+    TestIsotherm     isotherm_1;
+    TestIsotherm     isotherm_2 = TestIsotherm({ist::Langmuir(QMAX1, K11), ist::Langmuir(QMAX2, K12)});
+    TestIsotherm     isotherm_3 = TestIsotherm(isotherm_2);
+
+};
+
+TEST_F(TestSuit, ConstrutorDefault) {
+
+    EXPECT_EQ(isotherm_1.NumberComponents(), 0);
+
+}
+
+TEST_F(TestSuit, ConstrutorPadrao) {
+
+  EXPECT_EQ(isotherm_2.NumberComponents(), 2);
+  EXPECT_EQ(isotherm_2.Component(0).Qmax(), QMAX1);
+  EXPECT_EQ(isotherm_2.Component(0).K1(), K11);
+  EXPECT_EQ(isotherm_2.Component(1).Qmax(), QMAX2);
+  EXPECT_EQ(isotherm_2.Component(1).K1(), K12);
+
+}
+
+TEST_F(TestSuit, ConstrutoraDeCopia) {
+
+  EXPECT_EQ(isotherm_3.NumberComponents(), 2);
+  EXPECT_EQ(isotherm_3.Component(1).Qmax(), QMAX2);
+  EXPECT_EQ(isotherm_3.Component(1).K1(), K12);
+
+}
+
+TEST_F(TestSuit, CalculoQe) {
+
+const Real                              DEN (1.0 + K11 * CE1 + K12 * CE2);
+const Real                              QEANALIT1(QMAX1 * K11 * CE1 / DEN);
+const Real                              QEANALIT2(QMAX2 * K12 * CE2 / DEN);
+std::unique_ptr<ist::Multicomponent>    iso2c = isotherm_2.Clone();
+
+    EXPECT_FLOAT_EQ ( isotherm_2.Qe(0, {CE1, CE2}), QEANALIT1);
+    EXPECT_FLOAT_EQ ( isotherm_2.Qe(1, {CE1, CE2}), QEANALIT2);
+    EXPECT_FLOAT_EQ ( iso2c->Qe({CE1, CE2})[1], QEANALIT2);
+
+//  Componente unico recupera a isoterma de Langmuir
+    EXPECT_FLOAT_EQ ( isotherm_2.Qe(0, {CE1, 0.0}), ist::Langmuir(QMAX1, K11).Qe(CE1));
+
+    EXPECT_DEATH(auto value = isotherm_2.Qe({- CE1, CE2});, "");
+    EXPECT_DEATH(auto value = isotherm_2.Qe({CE1});, "");
+
+}
+
+TEST_F(TestSuit, CalculoQeSoA) {
+
+const UInt          NPTO(37);
+ist::VecVecReal     ce(2, ist::VecReal(NPTO));
+ist::VecVecReal     qe;
+
+    for (UInt k = 0; k < NPTO; ++k) {
+        ce[0][k] = 0.1 * k;
+        ce[1][k] = 0.05 * (NPTO - k);
+    }
+
+    isotherm_2.Qe(ce, qe);
+
+    ASSERT_EQ(qe.size(), 2);
+    ASSERT_EQ(qe[0].size(), NPTO);
+
+    for (UInt k = 0; k < NPTO; ++k) {
+
+    const auto  value = isotherm_2.Qe({ce[0][k], ce[1][k]});
+
+        EXPECT_DOUBLE_EQ(qe[0][k], value[0]);
+        EXPECT_DOUBLE_EQ(qe[1][k], value[1]);
+    }
+
+    ce[1].pop_back();
+    EXPECT_DEATH(isotherm_2.Qe(ce, qe);, "");
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestIsotherm(std::vector<ist::Langmuir>());, "");
+    EXPECT_DEATH(TestIsotherm({ist::Langmuir(QMAX1, K11), ist::Langmuir()});, "");
+    EXPECT_DEATH(auto value = isotherm_1.Qe({CE1});, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,211 @@
+//==============================================================================
+// Name        : TesteIAST.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe IAST
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/IAST.h>                        // ist::IAST
+#include <Multicomponent/ExtendedLangmuir.h>            // ist::ExtendedLangmuir
+#include <Isotherm/OneParameter/Henry.h>
+#include <Isotherm/TwoParameters/Freundlich.h>
+#include <Isotherm/ThreeParameters/Sips.h>
+#include <Isotherm/ThreeParameters/Toth.h>
+#include <Isotherm/ThreeParameters/LangmuirFreundlich.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::IAST TestIsotherm;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              CE1         = 1.79986;
+const Real              CE2         = 0.53211;
+const Real              QMAX        = 3.26828;
+const Real              K11         = 0.910566;
+const Real              K12         = 2.38941;
+const Real              K2          = 0.61254;
+const Real              TOLE        = 1.0e-9;
+
+public:
+
+    ist::Langmuir           langmuir_1  = ist::Langmuir(QMAX, K11);
+    ist::Langmuir           langmuir_2  = ist::Langmuir(QMAX, K12);
+    ist::Toth               toth        = ist::Toth(QMAX, K12, K2);
+    ist::LangmuirFreundlich lf          = ist::LangmuirFreundlich(QMAX, K11, K2);
+
+    TestIsotherm     isotherm_1;
+    TestIsotherm     isotherm_2 = TestIsotherm({&langmuir_1, &langmuir_2});
+    TestIsotherm     isotherm_3 = TestIsotherm({&toth, &lf});
+    TestIsotherm     isotherm_4 = TestIsotherm(isotherm_3);
+
+};
+
+TEST_F(TestSuit, ConstrutorDefault) {
+
+    EXPECT_EQ(isotherm_1.NumberComponents(), 0);
+
+}
+
+TEST_F(TestSuit, ConstrutorPadrao) {
+
+ist::Henry          henry(K11);
+ist::Freundlich     freundlich(K11, 1.0 / K2);
+ist::Sips           sips(QMAX, K11, K2);
+TestIsotherm        iast({&henry, &langmuir_1, &freundlich, &sips, &toth, &lf});
+
+    EXPECT_EQ(iast.NumberComponents(), 6);
+    EXPECT_EQ(iast.Kind(0), TestIsotherm::HenryForm);
+    EXPECT_EQ(iast.Kind(1), TestIsotherm::LangmuirForm);
+    EXPECT_EQ(iast.Kind(2), TestIsotherm::FreundlichForm);
+    EXPECT_EQ(iast.Kind(3), TestIsotherm::SipsForm);
+    EXPECT_EQ(iast.Kind(4), TestIsotherm::TothForm);
+    EXPECT_EQ(iast.Kind(5), TestIsotherm::QuadratureForm);
+    EXPECT_EQ(iast.Component(1).className(), "Langmuir");
+
+}
+
+TEST_F(TestSuit, ConstrutoraDeCopia) {
+
+    EXPECT_EQ(isotherm_4.NumberComponents(), 2);
+    EXPECT_EQ(isotherm_4.Kind(0), TestIsotherm::TothForm);
+    EXPECT_DOUBLE_EQ(isotherm_4.Component(1).Qe(CE2), lf.Qe(CE2));
+
+}
+
+TEST_F(TestSuit, PressaoEspalhamento) {
+
+//  Formas fechadas
+    EXPECT_NEAR (   isotherm_2.SpreadingPressure(0, CE1)
+                ,   QMAX * std::log(1.0 + K11 * CE1)
+                ,   TOLE);
+
+//  Quadratura: LangmuirFreundlich, psi = (qmax / K2) ln(1 + K1 C^K2)
+    for (const Real c : {1.0e-3, 0.1, CE1, 50.0, 1.0e4}) {
+        EXPECT_NEAR (   isotherm_3.SpreadingPressure(1, c)
+                    ,   QMAX / K2 * std::log(1.0 + K11 * std::pow(c, K2))
+                    ,   1.0e-7 * QMAX);
+    }
+
+//  Toth: d psi / d ln(C) = q(C), nos dois ramos da serie
+const Real  H (1.0e-4);
+
+    for (const Real c : {1.0e-4, 0.05, 0.2, 1.0, 20.0, 1.0e5}) {
+
+    const Real  dpsi    ( ( isotherm_3.SpreadingPressure(0, c * std::exp(H))
+                          - isotherm_3.SpreadingPressure(0, c * std::exp(- H))) / (2.0 * H));
+
+        EXPECT_NEAR(dpsi, toth.Qe(c), 1.0e-6 * QMAX);
+    }
+
+    EXPECT_DEATH(auto value = isotherm_3.SpreadingPressure(2, CE1);, "");
+    EXPECT_DEATH(auto value = isotherm_3.SpreadingPressure(0, - CE1);, "");
+
+}
+
+TEST_F(TestSuit, CalculoQe) {
+
+//  Langmuir com mesmo qmax: IAST coincide com Langmuir estendida
+ist::ExtendedLangmuir   extended({langmuir_1, langmuir_2});
+const auto              qe = isotherm_2.Qe({CE1, CE2});
+const auto              qext = extended.Qe({CE1, CE2});
+
+    EXPECT_NEAR (   qe[0], qext[0], TOLE);
+    EXPECT_NEAR (   qe[1], qext[1], TOLE);
+
+//  Componente unico recupera a isoterma do componente puro
+    EXPECT_NEAR (   isotherm_3.Qe({CE1, 0.0})[0], toth.Qe(CE1), TOLE);
+    EXPECT_NEAR (   isotherm_3.Qe({0.0, CE2})[1], lf.Qe(CE2), TOLE);
+    EXPECT_EQ   (   isotherm_3.Qe({0.0, CE2})[0], 0.0);
+
+//  Mistura Toth + LangmuirFreundlich: mesma pressao de espalhamento
+const auto              qmix = isotherm_4.Qe({CE1, CE2});
+const Real              qtot (qmix[0] + qmix[1]);
+const Real              psi0 (isotherm_4.SpreadingPressure(0, CE1 * qtot / qmix[0]));
+const Real              psi1 (isotherm_4.SpreadingPressure(1, CE2 * qtot / qmix[1]));
+
+    EXPECT_NEAR(psi0, psi1, 1.0e-8 * psi0);
+
+    EXPECT_DEATH(auto value = isotherm_2.Qe({- CE1, CE2});, "");
+    EXPECT_DEATH(auto value = isotherm_2.Qe({CE1});, "");
+
+}
+
+TEST_F(TestSuit, CalculoQeSoA) {
+
+const UInt          NPTO(41);
+ist::VecVecReal     ce(2, ist::VecReal(NPTO));
+ist::VecVecReal     qe;
+
+    for (UInt k = 0; k < NPTO; ++k) {
+        ce[0][k] = 0.1 * k;
+        ce[1][k] = 0.05 * (NPTO - k);
+    }
+
+    isotherm_3.Threads(4);
+    isotherm_3.Qe(ce, qe);
+
+    ASSERT_EQ(qe.size(), 2);
+    ASSERT_EQ(qe[0].size(), NPTO);
+
+    for (UInt k = 0; k < NPTO; ++k) {
+
+    const auto  value = isotherm_4.Qe({ce[0][k], ce[1][k]});
+
+        EXPECT_DOUBLE_EQ(qe[0][k], value[0]);
+        EXPECT_DOUBLE_EQ(qe[1][k], value[1]);
+    }
+
+    ce[1].pop_back();
+    EXPECT_DEATH(isotherm_3.Qe(ce, qe);, "");
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::Langmuir   undefined;
+
+    EXPECT_DEATH(TestIsotherm(std::vector<const ist::Isotherm*>());, "");
+    EXPECT_DEATH(TestIsotherm({&langmuir_1, nullptr});, "");
+    EXPECT_DEATH(TestIsotherm({&langmuir_1, &undefined});, "");
+    EXPECT_DEATH(auto value = isotherm_1.Qe({CE1});, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
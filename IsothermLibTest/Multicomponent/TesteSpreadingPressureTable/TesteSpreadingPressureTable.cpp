@@ -0,0 +1,181 @@
+//==============================================================================
+// Name        : TesteSpreadingPressureTable.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe SpreadingPressureTable
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <filesystem>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Multicomponent/SpreadingPressureTable.h>      // ist::SpreadingPressureTable
+#include <Multicomponent/IAST.h>                        // ist::IAST
+#include <Isotherm/TwoParameters/Langmuir.h>
+#include <Isotherm/ThreeParameters/LangmuirFreundlich.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::SpreadingPressureTable TestIsotherm;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 3.26828;
+const Real              K1          = 0.910566;
+const Real              K2          = 0.61254;
+const Real              CMIN        = 1.0e-4;
+const Real              CMAX        = 1.0e3;
+const Real              TOLE        = 1.0e-8;
+
+public:
+
+    ist::LangmuirFreundlich lf          = ist::LangmuirFreundlich(QMAX, K1, K2);
+
+    TestIsotherm     isotherm_1;
+    TestIsotherm     isotherm_2 = TestIsotherm(lf, CMIN, CMAX, TOLE);
+    TestIsotherm     isotherm_3 = TestIsotherm(isotherm_2);
+
+    Real Analit (const Real& _c) const {return QMAX / K2 * std::log(1.0 + K1 * std::pow(_c, K2));};
+
+};
+
+TEST_F(TestSuit, ConstrutorDefault) {
+
+    EXPECT_EQ(isotherm_1.NumberNodes(), 0);
+
+}
+
+TEST_F(TestSuit, ConstrutorPadrao) {
+
+    EXPECT_GT(isotherm_2.NumberNodes(), 16);
+    EXPECT_EQ(isotherm_2.Cmin(), CMIN);
+    EXPECT_EQ(isotherm_2.Cmax(), CMAX);
+    EXPECT_EQ(isotherm_2.Tolerance(), TOLE);
+    EXPECT_EQ(isotherm_2.Temperature(), 0.0);
+
+}
+
+TEST_F(TestSuit, ConstrutoraDeCopia) {
+
+    EXPECT_EQ(isotherm_3.NumberNodes(), isotherm_2.NumberNodes());
+    EXPECT_DOUBLE_EQ(isotherm_3.Psi(1.0), isotherm_2.Psi(1.0));
+
+}
+
+TEST_F(TestSuit, CalculoPsi) {
+
+const UInt  NPTO (997);
+Real        psiOld (0.0);
+Real        cOld (0.0);
+
+    for (UInt k = 0; k < NPTO; ++k) {
+
+    const Real  c (CMIN * std::pow(CMAX / CMIN, (k + 0.5) / NPTO));
+    const Real  psi (isotherm_2.Psi(c));
+    const Real  c0 (isotherm_2.Ce(psi));
+
+        EXPECT_NEAR(psi, Analit(c), 1.0e-7 * Analit(c));
+        EXPECT_NEAR(c0, c, 1.0e-7 * c);
+        EXPECT_NEAR(isotherm_2.Qe(c), lf.Qe(c), 1.0e-5 * lf.Qe(c));
+
+//  Monotonicidade das duas splines
+        EXPECT_GT(psi, psiOld);
+        EXPECT_GT(c0, cOld);
+
+        psiOld = psi;
+        cOld   = c0;
+    }
+
+//  Fora do intervalo tabelado
+    EXPECT_NEAR(isotherm_2.Psi(0.1 * CMIN), Analit(0.1 * CMIN), 1.0e-2 * Analit(0.1 * CMIN));
+    EXPECT_NEAR(isotherm_2.Ce(isotherm_2.Psi(0.1 * CMIN)), 0.1 * CMIN, 1.0e-12);
+    EXPECT_NEAR(isotherm_2.Ce(isotherm_2.Psi(10.0 * CMAX)), 10.0 * CMAX, 1.0e-9 * CMAX);
+
+}
+
+TEST_F(TestSuit, Arquivo) {
+
+const auto      file (std::filesystem::temp_directory_path() / "TesteSpreadingPressureTable.bin");
+
+    isotherm_2.Save(file.string());
+
+TestIsotherm    table (TestIsotherm::Load(file.string()));
+
+    ASSERT_EQ(table.NumberNodes(), isotherm_2.NumberNodes());
+    EXPECT_EQ(table.Cmax(), CMAX);
+
+    for (const Real c : {1.0e-5, 3.0e-3, 0.7, 81.0, 2.0e4}) {
+        EXPECT_DOUBLE_EQ(table.Psi(c), isotherm_2.Psi(c));
+        EXPECT_DOUBLE_EQ(table.Ce(table.Psi(c)), isotherm_2.Ce(isotherm_2.Psi(c)));
+    }
+
+    std::filesystem::remove(file);
+
+    EXPECT_DEATH(auto value = TestIsotherm::Load(file.string());, "");
+
+}
+
+TEST_F(TestSuit, IAST) {
+
+ist::Langmuir       langmuir(1.5 * QMAX, 2.0 * K1);
+ist::IAST           iast({&lf, &langmuir});
+ist::IAST           iastTable(iast);
+
+    iastTable.Tabulate(CMIN, CMAX, TOLE);
+
+    EXPECT_NE(iastTable.Table(0), nullptr);
+    EXPECT_EQ(iastTable.Table(1), nullptr);
+
+    for (const Real c : {1.0e-3, 0.05, 1.0, 30.0}) {
+
+    const auto  qe (iast.Qe({c, 0.5 * c}));
+    const auto  qt (iastTable.Qe({c, 0.5 * c}));
+
+        EXPECT_NEAR(qt[0], qe[0], 1.0e-6 * qe[0]);
+        EXPECT_NEAR(qt[1], qe[1], 1.0e-6 * qe[1]);
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestIsotherm(lf, 0.0, CMAX);, "");
+    EXPECT_DEATH(TestIsotherm(lf, CMAX, CMIN);, "");
+    EXPECT_DEATH(TestIsotherm(lf, CMIN, CMAX, 0.0);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+//==============================================================================
+// Name        : TesteBatchEquilibrium.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe BatchEquilibrium
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Process/BatchEquilibrium.h>                   // ist::BatchEquilibrium
+#include <Isotherm/TwoParameters/Langmuir.h>
+#include <Isotherm/TwoParameters/Elovich.h>
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>
+#include <Isotherm/FourParameters/WeberVanVliet.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::BatchEquilibrium TestProcess;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              C0          = 2.5;
+const Real              VOLUME      = 0.1;
+const Real              MASS        = 0.05;
+const Real              QMAX        = 3.26828;
+const Real              K1          = 0.910566;
+const Real              TEMP        = 386.833;
+const Real              TOLE        = 1.0e-10;
+
+public:
+
+    ist::Langmuir           langmuir    = ist::Langmuir(QMAX, K1);
+    ist::FowlerGuggenheim   fowler      = ist::FowlerGuggenheim(68.1867, 5.42910, 3.27480);
+
+    TestProcess         process_1;
+    TestProcess         process_2   = TestProcess(langmuir);
+    TestProcess         process_3   = TestProcess(fowler, TEMP);
+    TestProcess         process_4   = TestProcess(process_3);
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(process_2.className(), "BatchEquilibrium");
+    EXPECT_EQ(process_2.Model().className(), "Langmuir");
+    EXPECT_EQ(process_4.Model().classID(), fowler.classID());
+    EXPECT_DOUBLE_EQ(process_4.Temperature(), TEMP);
+
+    process_1 = process_2;
+    EXPECT_DOUBLE_EQ(process_1.Ce(C0, VOLUME, MASS), process_2.Ce(C0, VOLUME, MASS));
+
+}
+
+TEST_F(TestSuit, InversaExplicita) {
+
+Real    ce, dcdq;
+
+    EXPECT_FALSE(langmuir.ExplicitCe(1.0, 0.0, ce, dcdq));
+
+//  Ce(Qe(c)) = c e derivada da inversa igual a 1 / (dQe/dCe)
+ist::Elovich        elovich(QMAX, K1);
+ist::WeberVanVliet  weber(0.0870930, 3.19814, 0.0647897, 0.769393);
+
+    for (const Real c : {0.001, 0.0553181, 0.3}) {
+        ASSERT_TRUE(fowler.ExplicitCe(fowler.Qe(c, TEMP), TEMP, ce, dcdq));
+        EXPECT_NEAR(ce, c, 1.0e-6 * c);
+        EXPECT_NEAR(dcdq * fowler.DQDC(c, TEMP), 1.0, 1.0e-4);
+    }
+
+    for (const Real c : {0.01, 0.3, 1.56792, 10.0}) {
+
+        ASSERT_TRUE(elovich.ExplicitCe(elovich.Qe(c), 0.0, ce, dcdq));
+        EXPECT_NEAR(ce, c, 1.0e-6 * c);
+        EXPECT_NEAR(dcdq * elovich.DQDC(c), 1.0, 1.0e-4);
+
+        ASSERT_TRUE(weber.ExplicitCe(weber.Qe(c), 0.0, ce, dcdq));
+        EXPECT_NEAR(ce, c, 1.0e-6 * c);
+        EXPECT_NEAR(dcdq * weber.DQDC(c), 1.0, 1.0e-4);
+    }
+
+//  Acima da saturacao a inversa e infinita
+    ASSERT_TRUE(fowler.ExplicitCe(2.0 * fowler.Qmax(), TEMP, ce, dcdq));
+    EXPECT_TRUE(std::isinf(ce));
+
+}
+
+TEST_F(TestSuit, CalculoCe) {
+
+//  Langmuir: raiz da equacao do segundo grau
+const Real      ratio (VOLUME / MASS);
+const Real      b (ratio + QMAX * K1 - ratio * K1 * C0);
+const Real      analit ((- b + std::sqrt(b * b + 4.0 * ratio * K1 * ratio * C0)) / (2.0 * ratio * K1));
+
+    EXPECT_NEAR(process_2.Ce(C0, VOLUME, MASS), analit, TOLE);
+    EXPECT_EQ(process_2.Ce(0.0, VOLUME, MASS), 0.0);
+
+//  Modelo implicito: balanco de massa e isoterma inversa satisfeitos,
+//  inclusive onde o Newton interno de Qe nao converge
+const Real      ce (process_3.Ce(C0, VOLUME, MASS));
+Real            cinv, dcdq;
+
+    ASSERT_TRUE(fowler.ExplicitCe((C0 - ce) * ratio, TEMP, cinv, dcdq));
+    EXPECT_NEAR(cinv, ce, 1.0e-9);
+
+}
+
+TEST_F(TestSuit, CalculoEmBloco) {
+
+const UInt      NPTO (2000);
+ist::VecReal    c0(NPTO), volume(NPTO), mass(NPTO), ce(NPTO), qe(NPTO);
+
+    for (UInt k = 0; k < NPTO; ++k) {
+        c0[k]     = 0.01 + 0.005 * k;
+        volume[k] = VOLUME;
+        mass[k]   = MASS * (1.0 + 0.001 * k);
+    }
+
+    for (const auto* process : {&process_2, &process_3}) {
+
+        process->Solve(c0, volume, mass, ce, qe, 4);
+
+        for (UInt k = 0; k < NPTO; k += 97) {
+            EXPECT_NEAR(ce[k], process->Ce(c0[k], volume[k], mass[k]), 1.0e-12 * c0[k]);
+            EXPECT_NEAR(qe[k], (c0[k] - ce[k]) * volume[k] / mass[k], 1.0e-12);
+        }
+    }
+
+    mass.pop_back();
+    EXPECT_DEATH(process_2.Solve(c0, volume, mass, ce, qe);, "");
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(auto value = process_1.Ce(C0, VOLUME, MASS);, "");
+    EXPECT_DEATH(auto value = process_2.Ce(- C0, VOLUME, MASS);, "");
+    EXPECT_DEATH(auto value = process_2.Ce(C0, 0.0, MASS);, "");
+    EXPECT_DEATH(auto value = process_2.Ce(C0, VOLUME, 0.0);, "");
+    EXPECT_DEATH(auto value = TestProcess(fowler).Ce(C0, VOLUME, MASS);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
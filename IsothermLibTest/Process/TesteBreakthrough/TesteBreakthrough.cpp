@@ -0,0 +1,190 @@
+//==============================================================================
+// Name        : TesteBreakthrough.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Breakthrough
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <numeric>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Process/Breakthrough.h>                       // ist::Breakthrough
+#include <Isotherm/OneParameter/Henry.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::Breakthrough TestProcess;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              LENGTH      = 0.5;
+const Real              VELOCITY    = 1.0e-2;
+const Real              DISPERSION  = 1.0e-5;
+const Real              PHASERATIO  = 1.5;
+const Real              KLDF        = 0.5;
+const UInt              NCELLS      = 200;
+const Real              CFEED       = 1.0;
+const Real              QMAX        = 3.26828;
+const Real              K1          = 0.910566;
+
+public:
+
+    ist::Henry          henry       = ist::Henry(K1);
+    ist::Langmuir       langmuir    = ist::Langmuir(QMAX, K1);
+
+    TestProcess         process_1;
+    TestProcess         process_2   = TestProcess   (   langmuir
+                                                    ,   LENGTH
+                                                    ,   VELOCITY
+                                                    ,   DISPERSION
+                                                    ,   PHASERATIO
+                                                    ,   KLDF
+                                                    ,   NCELLS
+                                                    );
+    TestProcess         process_3   = TestProcess(process_2);
+
+};
+
+TEST_F(TestSuit, ConstrutorDefault) {
+
+    EXPECT_EQ(process_1.NumberCells(), 0);
+    EXPECT_TRUE(process_1.Outlet().empty());
+
+}
+
+TEST_F(TestSuit, ConstrutorPadrao) {
+
+    EXPECT_EQ(process_2.className(), "Breakthrough");
+    EXPECT_EQ(process_2.NumberCells(), NCELLS);
+    EXPECT_DOUBLE_EQ(process_2.Length(), LENGTH);
+    EXPECT_DOUBLE_EQ(process_2.Velocity(), VELOCITY);
+    EXPECT_DOUBLE_EQ(process_2.Dispersion(), DISPERSION);
+    EXPECT_DOUBLE_EQ(process_2.PhaseRatio(), PHASERATIO);
+    EXPECT_DOUBLE_EQ(process_2.KLDF(), KLDF);
+
+}
+
+TEST_F(TestSuit, ConstrutoraDeCopia) {
+
+    process_1 = process_3;
+
+    EXPECT_EQ(process_1.NumberCells(), NCELLS);
+    EXPECT_DOUBLE_EQ(process_1.KLDF(), KLDF);
+
+}
+
+TEST_F(TestSuit, TempoDeRuptura) {
+
+//  Isoterma linear: o centro da frente chega em t = L / v (1 + F K)
+TestProcess     process (henry, LENGTH, VELOCITY, DISPERSION, PHASERATIO, KLDF, 400);
+const Real      t50 (LENGTH / VELOCITY * (1.0 + PHASERATIO * K1));
+const Real      dt (0.5);
+const UInt      nsteps (UInt(2.0 * t50 / dt));
+
+    process.Run(CFEED, dt, nsteps);
+
+const auto&     outlet = process.Outlet();
+UInt            k (0);
+
+    while (outlet[k] < 0.5 * CFEED) ++k;
+
+    EXPECT_NEAR(process.Time()[k], t50, 0.03 * t50);
+    EXPECT_NEAR(outlet.back(), CFEED, 1.0e-3);
+
+}
+
+TEST_F(TestSuit, BalancoDeMassa) {
+
+const Real      dt (1.0);
+const UInt      nsteps (100);
+
+    process_2.Run(CFEED, dt, nsteps);
+
+const auto&     c = process_2.Concentration();
+const auto&     q = process_2.Loading();
+const Real      dz (LENGTH / NCELLS);
+const Real      fed (VELOCITY * CFEED * nsteps * dt);
+const Real      left (VELOCITY * dt * std::accumulate(process_2.Outlet().begin(), process_2.Outlet().end(), 0.0));
+Real            held (0.0);
+
+    for (UInt i = 0; i < NCELLS; ++i) held += dz * (c[i] + PHASERATIO * q[i]);
+
+    EXPECT_NEAR(fed - left, held, 1.0e-6 * fed);
+
+    for (UInt i = 0; i < NCELLS; ++i) {
+        EXPECT_LE(q[i], langmuir.Qe(CFEED) * (1.0 + 1.0e-9));
+        EXPECT_GE(c[i], - 1.0e-9);
+    }
+
+}
+
+TEST_F(TestSuit, Varredura) {
+
+std::vector<TestProcess>    cases;
+
+    for (const Real k : {0.05, 0.1, 0.5, 1.0, 5.0})
+        cases.push_back(TestProcess(langmuir, LENGTH, VELOCITY, DISPERSION, PHASERATIO, k, NCELLS));
+
+std::vector<TestProcess>    serial(cases);
+
+    TestProcess::Sweep(cases, CFEED, 2.0, 200, 3);
+
+    for (auto& process : serial) process.Run(CFEED, 2.0, 200);
+
+    for (size_t k = 0; k < cases.size(); ++k) {
+        ASSERT_EQ(cases[k].Outlet().size(), 200);
+        for (size_t n = 0; n < 200; ++n)
+            EXPECT_DOUBLE_EQ(cases[k].Outlet()[n], serial[k].Outlet()[n]);
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestProcess(langmuir, - LENGTH, VELOCITY, DISPERSION, PHASERATIO, KLDF);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, 0.0, DISPERSION, PHASERATIO, KLDF);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, VELOCITY, - DISPERSION, PHASERATIO, KLDF);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, VELOCITY, DISPERSION, PHASERATIO, 0.0);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, VELOCITY, DISPERSION, PHASERATIO, KLDF, 1);, "");
+    EXPECT_DEATH(process_2.Run(- CFEED, 1.0, 10);, "");
+    EXPECT_DEATH(process_2.Run(CFEED, 0.0, 10);, "");
+    EXPECT_DEATH(process_1.Run(CFEED, 1.0, 10);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
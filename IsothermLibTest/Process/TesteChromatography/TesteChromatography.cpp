@@ -0,0 +1,198 @@
+//==============================================================================
+// Name        : TesteChromatography.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe Chromatography
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Process/Chromatography.h>                     // ist::Chromatography
+#include <Isotherm/OneParameter/Henry.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::Chromatography TestProcess;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              LENGTH      = 1.0;
+const Real              VELOCITY    = 1.0;
+const Real              DISPERSION  = 1.0e-4;
+const Real              PHASERATIO  = 0.5;
+const UInt              NCELLS      = 200;
+const Real              CINJ        = 2.0;
+const Real              WIDTH       = 0.1;
+const Real              TEND        = 4.0;
+const Real              QMAX        = 2.0;
+const Real              K1          = 2.0;
+const Real              K1L         = 1.0;
+const Real              TOLE        = 5.0e-3;
+
+public:
+
+    ist::Henry          henry       = ist::Henry(K1);
+    ist::Langmuir       langmuir    = ist::Langmuir(QMAX, K1L);
+
+    TestProcess::Schedule   schedule    = {{0.0, WIDTH, CINJ}};
+
+    TestProcess         process_1;
+    TestProcess         process_2   = TestProcess   (   langmuir
+                                                    ,   LENGTH
+                                                    ,   VELOCITY
+                                                    ,   DISPERSION
+                                                    ,   PHASERATIO
+                                                    ,   NCELLS
+                                                    );
+    TestProcess         process_3   = TestProcess(process_2);
+
+//  Integral de c_out dt e primeiro momento do pico
+    static std::pair<Real, Real> Moments (const TestProcess& _process) {
+
+    const auto& t = _process.Time();
+    const auto& c = _process.Outlet();
+    const Real  dt (t[1] - t[0]);
+    Real        m0 (0.0), m1 (0.0);
+
+        for (size_t k = 0; k < t.size(); ++k) {
+            m0 += c[k] * dt;
+            m1 += t[k] * c[k] * dt;
+        }
+
+        return {m0, m1 / m0};
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(process_1.NumberCells(), 0);
+    EXPECT_EQ(process_2.className(), "Chromatography");
+    EXPECT_EQ(process_3.NumberCells(), NCELLS);
+    EXPECT_DOUBLE_EQ(process_3.Length(), LENGTH);
+    EXPECT_DOUBLE_EQ(process_3.Velocity(), VELOCITY);
+    EXPECT_DOUBLE_EQ(process_3.Dispersion(), DISPERSION);
+    EXPECT_DOUBLE_EQ(process_3.PhaseRatio(), PHASERATIO);
+
+    process_1 = process_3;
+    EXPECT_EQ(process_1.NumberCells(), NCELLS);
+
+}
+
+TEST_F(TestSuit, Alimentacao) {
+
+TestProcess::Schedule   twice = {{0.0, WIDTH, CINJ}, {1.0, WIDTH, 0.5 * CINJ}};
+
+    EXPECT_DOUBLE_EQ(TestProcess::Feed(twice, 0.5 * WIDTH), CINJ);
+    EXPECT_DOUBLE_EQ(TestProcess::Feed(twice, 0.5), 0.0);
+    EXPECT_DOUBLE_EQ(TestProcess::Feed(twice, 1.0), 0.5 * CINJ);
+
+}
+
+TEST_F(TestSuit, TempoDeRetencao) {
+
+//  Isoterma linear: primeiro momento em L / u (1 + F K) + largura / 2
+TestProcess     process (henry, LENGTH, VELOCITY, DISPERSION, PHASERATIO, NCELLS);
+
+    process.Run(schedule, TEND);
+
+const auto      [m0, m1] = Moments(process);
+const Real      tr (LENGTH / VELOCITY * (1.0 + PHASERATIO * K1));
+
+    EXPECT_NEAR(m0, CINJ * WIDTH, TOLE * CINJ * WIDTH);
+    EXPECT_NEAR(m1, tr + 0.5 * WIDTH, TOLE * tr);
+
+}
+
+TEST_F(TestSuit, Langmuir) {
+
+    process_2.Run(schedule, TEND);
+
+const auto      [m0, m1] = Moments(process_2);
+const auto&     outlet = process_2.Outlet();
+
+//  Massa conservada (a menos da discretizacao das bordas da injecao), pico
+//  antecipado em relacao a isoterma linear e sem oscilacoes na frente de choque
+    EXPECT_NEAR(m0, CINJ * WIDTH, TOLE * CINJ * WIDTH);
+    EXPECT_LT(m1, LENGTH / VELOCITY * (1.0 + PHASERATIO * QMAX * K1L));
+    EXPECT_LE(*std::max_element(outlet.begin(), outlet.end()), CINJ);
+    EXPECT_GE(*std::min_element(outlet.begin(), outlet.end()), - 1.0e-12);
+
+//  Resultado reprodutivel
+    process_3.Run(schedule, TEND);
+
+    for (size_t k = 0; k < outlet.size(); ++k) ASSERT_EQ(outlet[k], process_3.Outlet()[k]);
+
+}
+
+TEST_F(TestSuit, Varredura) {
+
+std::vector<TestProcess>            cases(4, process_2);
+std::vector<TestProcess::Schedule>  schedules;
+
+    for (UInt k = 0; k < cases.size(); ++k) schedules.push_back({{0.0, WIDTH * (k + 1), CINJ}});
+
+std::vector<TestProcess>            serial(cases);
+
+    TestProcess::Sweep(cases, schedules, 1.0, 0.4, 2);
+
+    for (size_t k = 0; k < cases.size(); ++k) {
+        serial[k].Run(schedules[k], 1.0);
+        ASSERT_EQ(cases[k].Outlet().size(), serial[k].Outlet().size());
+        EXPECT_EQ(cases[k].Outlet().back(), serial[k].Outlet().back());
+    }
+
+    schedules.pop_back();
+    EXPECT_DEATH(TestProcess::Sweep(cases, schedules, 1.0);, "");
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestProcess(langmuir, 0.0, VELOCITY, DISPERSION, PHASERATIO);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, - VELOCITY, DISPERSION, PHASERATIO);, "");
+    EXPECT_DEATH(TestProcess(langmuir, LENGTH, VELOCITY, DISPERSION, - PHASERATIO);, "");
+    EXPECT_DEATH(process_1.Run(schedule, TEND);, "");
+    EXPECT_DEATH(process_2.Run({}, TEND);, "");
+    EXPECT_DEATH(process_2.Run({{0.0, 0.0, CINJ}}, TEND);, "");
+    EXPECT_DEATH(process_2.Run(schedule, TEND, 1.5);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
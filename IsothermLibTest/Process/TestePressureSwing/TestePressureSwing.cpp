@@ -0,0 +1,164 @@
+//==============================================================================
+// Name        : TestePressureSwing.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe PressureSwing
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Process/PressureSwing.h>                      // ist::PressureSwing
+#include <Multicomponent/ExtendedLangmuir.h>
+#include <Isotherm/TwoParameters/Langmuir.h>
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::PressureSwing TestProcess;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 3.0;
+const Real              K1          = 1.0e-5;           // N2 [1/Pa]
+const Real              K2          = 3.0e-6;           // O2 [1/Pa]
+const UInt              NCELLS      = 20;
+const Real              TOLE        = 1.0e-6;
+
+public:
+
+    ist::Langmuir           nitrogen    = ist::Langmuir(QMAX, K1);
+    ist::Langmuir           oxygen      = ist::Langmuir(QMAX, K2);
+    ist::ExtendedLangmuir   air         = ist::ExtendedLangmuir({nitrogen, oxygen});
+
+    TestProcess::Bed        bed         = {1.0, 0.4, 700.0, 300.0, {0.2, 0.2}};
+    TestProcess::Cycle      cycle       = {3.0e5, 1.0e5, {0.79, 0.21}, 0.3, 0.1, 10.0, 20.0, 10.0, 20.0};
+
+    TestProcess             process_1;
+    TestProcess             process_2   = TestProcess(air, bed, cycle, NCELLS);
+    TestProcess             process_3   = TestProcess(process_2);
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(process_1.NumberCells(), 0);
+    EXPECT_EQ(process_2.className(), "PressureSwing");
+    EXPECT_EQ(process_3.NumberCells(), NCELLS);
+    EXPECT_EQ(process_3.NumberComponents(), 2);
+
+    process_1 = process_3;
+    EXPECT_EQ(process_1.NumberCells(), NCELLS);
+
+}
+
+TEST_F(TestSuit, EstadoCiclico) {
+
+const UInt      anderson (process_2.Solve(500, TOLE));
+const UInt      picard (process_3.Solve(500, TOLE, 0));
+
+//  Mesmo estado estacionario ciclico com muito menos ciclos
+    EXPECT_LT(2 * anderson, picard);
+    EXPECT_EQ(process_2.Residuals().size(), anderson);
+    EXPECT_LE(process_2.Residuals().back(), TOLE);
+
+    for (size_t i = 0; i < 2; ++i)
+        for (size_t j = 0; j < NCELLS; ++j) {
+            EXPECT_NEAR(process_2.MoleFraction()[i][j], process_3.MoleFraction()[i][j], 1.0e-4);
+            EXPECT_NEAR(process_2.Loading()[i][j], process_3.Loading()[i][j], 1.0e-4 * QMAX);
+        }
+
+}
+
+TEST_F(TestSuit, Desempenho) {
+
+    process_2.Solve(500, TOLE);
+
+//  Balanco de massa no ciclo: o leito volta ao estado inicial
+    for (UInt i = 0; i < 2; ++i) {
+
+    const Real  in (process_2.FeedIn(i) + process_2.PurgeIn(i));
+    const Real  out (process_2.ProductOut(i) + process_2.WasteOut(i));
+
+        EXPECT_NEAR(in, out, 1.0e-3 * in);
+    }
+
+//  O produto leve e enriquecido em O2
+    EXPECT_GT(process_2.Purity(1), cycle.yFeed[1]);
+    EXPECT_NEAR(process_2.Purity(0) + process_2.Purity(1), 1.0, 1.0e-12);
+    EXPECT_GT(process_2.Recovery(1), 0.0);
+    EXPECT_LT(process_2.Recovery(1), 1.0);
+
+}
+
+TEST_F(TestSuit, IAST) {
+
+//  Langmuir com mesmo qmax: IAST coincide com Langmuir estendida
+TestProcess     process ({&nitrogen, &oxygen}, bed, cycle, NCELLS);
+
+    process.Solve(500, TOLE);
+    process_2.Solve(500, TOLE);
+
+    EXPECT_NEAR(process.Purity(1), process_2.Purity(1), 1.0e-4);
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+TestProcess::Bed        badBed (bed);
+TestProcess::Cycle      badCycle (cycle);
+
+    badBed.voidage = 1.0;
+    EXPECT_DEATH(TestProcess(air, badBed, cycle);, "");
+
+    badBed = bed;
+    badBed.kldf = {0.2};
+    EXPECT_DEATH(TestProcess(air, badBed, cycle);, "");
+
+    badCycle.pLow = cycle.pHigh;
+    EXPECT_DEATH(TestProcess(air, bed, badCycle);, "");
+
+    badCycle = cycle;
+    badCycle.yFeed = {0.5, 0.6};
+    EXPECT_DEATH(TestProcess(air, bed, badCycle);, "");
+
+    EXPECT_DEATH(TestProcess(air, bed, cycle, 1);, "");
+    EXPECT_DEATH(process_1.Solve();, "");
+    EXPECT_DEATH(process_2.Solve(3, TOLE);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
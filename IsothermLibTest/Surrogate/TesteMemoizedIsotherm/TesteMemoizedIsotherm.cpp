@@ -0,0 +1,171 @@
+//==============================================================================
+// Name        : TesteMemoizedIsotherm.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe MemoizedIsotherm
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <memory>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Misc/Parallel.h>                                  // ist::ParallelFor
+#include <Surrogate/MemoizedIsotherm.h>                     // ist::MemoizedIsotherm
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::MemoizedIsotherm TestModel;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 68.1867;
+const Real              K1          = 5.42910;
+const Real              K2          = 3274.80;
+const Real              TEMP        = 350.0;
+const size_t            BUDGET      = 1 << 20;
+const size_t            NPTS        = 200;
+
+public:
+
+    ist::VecReal            ce;
+
+    ist::FowlerGuggenheim   fowler      = ist::FowlerGuggenheim(QMAX, K1, K2);
+
+    TestModel               model_1;
+    TestModel               model_2     = TestModel(fowler, BUDGET);
+    TestModel               model_3     = TestModel(model_2);
+
+    void SetUp() override {
+        for (size_t k = 0; k < NPTS; ++k) ce.push_back(1.0e-3 * (k + 1));
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(model_2.className(), "MemoizedIsotherm");
+    EXPECT_EQ(model_2.NumberConst(), 2);
+    EXPECT_EQ(model_2.Budget(), BUDGET);
+    EXPECT_EQ(model_2.NumberShards(), 16);
+    EXPECT_GT(model_2.Capacity(), 0);
+    EXPECT_EQ(model_2.Model().className(), fowler.className());
+
+    EXPECT_EQ(model_2.Qe(ce[0], TEMP), fowler.Qe(ce[0], TEMP));
+    EXPECT_EQ(model_2.Size(), 1);
+
+//  A copia e o clone comecam com a memoria vazia
+
+    model_1 = model_2;
+    EXPECT_EQ(model_1.Size(), 0);
+    EXPECT_EQ(model_1.Capacity(), model_2.Capacity());
+    EXPECT_EQ(model_3.Size(), 0);
+
+std::unique_ptr<ist::Isotherm>  clone (model_2.Clone());
+
+    EXPECT_EQ(clone->Qe(ce[1], TEMP), fowler.Qe(ce[1], TEMP));
+
+}
+
+TEST_F(TestSuit, Valores) {
+
+    for (UInt pass = 0; pass < 3; ++pass)
+        for (const auto& c : ce) EXPECT_EQ(model_2.Qe(c, TEMP), fowler.Qe(c, TEMP));
+
+    EXPECT_EQ(model_2.Misses(), NPTS);
+    EXPECT_EQ(model_2.Hits(), 2 * NPTS);
+    EXPECT_EQ(model_2.Size(), NPTS);
+
+//  A temperatura faz parte da chave
+
+    EXPECT_EQ(model_2.Qe(ce[0], TEMP + 10.0), fowler.Qe(ce[0], TEMP + 10.0));
+    EXPECT_EQ(model_2.Misses(), NPTS + 1);
+
+    EXPECT_EQ(model_2.DQDC(ce[0], TEMP), fowler.DQDC(ce[0], TEMP));
+    EXPECT_EQ(model_2.Ce(fowler.Qe(ce[0], TEMP), TEMP), fowler.Ce(fowler.Qe(ce[0], TEMP), TEMP));
+
+    model_2.Clear();
+    EXPECT_EQ(model_2.Size(), 0);
+    EXPECT_EQ(model_2.Hits(), 0);
+    EXPECT_EQ(model_2.Misses(), 0);
+
+}
+
+TEST_F(TestSuit, Descarte) {
+
+//  Um valor por particao: a segunda consulta de cada particao descarta a
+//  primeira
+
+TestModel   model (fowler, 2 * 160, 2);
+
+    EXPECT_EQ(model.Capacity(), 1);
+
+    for (const auto& c : ce) EXPECT_EQ(model.Qe(c, TEMP), fowler.Qe(c, TEMP));
+
+    EXPECT_LE(model.Size(), 2);
+    EXPECT_EQ(model.Misses(), NPTS);
+
+}
+
+TEST_F(TestSuit, Paralelo) {
+
+ist::VecReal     q(NPTS * 8);
+
+    ist::ParallelFor    (   q.size()
+                        ,   [&](const size_t& _ini, const size_t& _fim) {
+                                for (size_t k = _ini; k < _fim; ++k) q[k] = model_2.Qe(ce[k % NPTS], TEMP);
+                            }
+                        ,   4
+                        );
+
+    for (size_t k = 0; k < q.size(); ++k) EXPECT_EQ(q[k], fowler.Qe(ce[k % NPTS], TEMP));
+
+    EXPECT_EQ(model_2.Misses(), NPTS);
+    EXPECT_EQ(model_2.Hits() + model_2.Misses(), q.size());
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+    EXPECT_DEATH(TestModel(fowler, BUDGET, 0);, "");
+    EXPECT_DEATH(TestModel(fowler, 8, 1);, "");
+    EXPECT_DEATH(auto value = model_1.Qe(1.0);, "");
+    EXPECT_DEATH(auto value = model_1.DQDC(1.0);, "");
+    EXPECT_DEATH(auto value = model_1.Ce(1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qe(- 1.0, TEMP);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
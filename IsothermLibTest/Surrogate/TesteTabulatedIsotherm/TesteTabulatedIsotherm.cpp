@@ -0,0 +1,177 @@
+//==============================================================================
+// Name        : TesteTabulatedIsotherm.cpp
+// Authors     : Joao Flavio Vieira de Vasconcellos
+// Version     : 1.0
+// Description : Programa de teste da classe TabulatedIsotherm
+//
+// Copyright   : Copyright (C) <2022>  Joao Flavio Vasconcellos
+//                                      (jflavio at iprj.uerj.br)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//==============================================================================
+
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <cmath>
+#include <memory>
+
+//==============================================================================
+// include da isotherm++
+//==============================================================================
+
+#include <Isotherm/TwoParameters/Langmuir.h>                // ist::Langmuir
+#include <Isotherm/ThreeParameters/FowlerGuggenheim.h>      // ist::FowlerGuggenheim
+#include <Surrogate/TabulatedIsotherm.h>                    // ist::TabulatedIsotherm
+
+
+//==============================================================================
+// include da googletest
+//==============================================================================
+#include <gtest/gtest.h>
+
+typedef     ist::TabulatedIsotherm TestModel;
+
+class TestSuit : public ::testing::Test {
+
+protected:
+
+const Real              QMAX        = 68.1867;
+const Real              K1          = 5.42910;
+const Real              K2          = 3274.80;
+const Real              CMIN        = 1.0e-4;
+const Real              CMAX        = 1.0e+2;
+const Real              CMAXT       = 1.0;
+const Real              TMIN        = 300.0;
+const Real              TMAX        = 400.0;
+const Real              TEMP        = 350.0;
+const Real              TOLE        = 1.0e-8;
+const size_t            NPTS        = 500;
+
+public:
+
+    ist::VecReal            ce;
+
+    ist::Langmuir           langmuir    = ist::Langmuir(QMAX, K1);
+    ist::FowlerGuggenheim   fowler      = ist::FowlerGuggenheim(QMAX, K1, K2);
+
+    TestModel               model_1;
+    TestModel               model_2     = TestModel(langmuir, CMIN, CMAX, TOLE);
+    TestModel               model_3     = TestModel(fowler, CMIN, CMAXT, TMIN, TMAX, TOLE);
+
+    void SetUp() override {
+        for (size_t k = 0; k < NPTS; ++k)
+            ce.push_back(CMIN * std::pow(CMAX / CMIN, (k + 0.37) / NPTS));
+    }
+
+};
+
+TEST_F(TestSuit, Construtoras) {
+
+    EXPECT_EQ(model_2.className(), "TabulatedIsotherm");
+    EXPECT_EQ(model_2.NumberConst(), 5);
+    EXPECT_DOUBLE_EQ(model_2.Cmin(), CMIN);
+    EXPECT_DOUBLE_EQ(model_2.Cmax(), CMAX);
+    EXPECT_DOUBLE_EQ(model_2.Tolerance(), TOLE);
+    EXPECT_EQ(model_2.NumberTemperatures(), 1);
+    EXPECT_LE(model_2.ErrorBound(), TOLE);
+
+    EXPECT_DOUBLE_EQ(model_3.Tmin(), TMIN);
+    EXPECT_DOUBLE_EQ(model_3.Tmax(), TMAX);
+    EXPECT_GT(model_3.NumberTemperatures(), 1);
+    EXPECT_LE(model_3.ErrorBound(), TOLE);
+
+    model_1 = model_2;
+    EXPECT_EQ(model_1.NumberNodes(), model_2.NumberNodes());
+    EXPECT_EQ(model_1.Qe(1.0), model_2.Qe(1.0));
+
+std::unique_ptr<ist::Isotherm>  clone (model_3.Clone());
+
+    EXPECT_EQ(clone->Qe(1.0, TEMP), model_3.Qe(1.0, TEMP));
+
+}
+
+TEST_F(TestSuit, Valores) {
+
+    for (const auto& c : ce) {
+
+    const Real  q (langmuir.Qe(c));
+
+        EXPECT_NEAR(model_2.Qe(c), q, 2.0 * TOLE * q);
+        EXPECT_NEAR(model_2.DQDC(c), langmuir.DQDC(c), 1.0e-4 * langmuir.DQDC(c));
+    }
+
+    EXPECT_DOUBLE_EQ(model_2.Qe(0.0), 0.0);
+
+//  Fora da faixa tabelada Qe segue a lei de potencia do extremo
+
+    EXPECT_NEAR(model_2.Qe(0.5 * CMIN), langmuir.Qe(0.5 * CMIN), 1.0e-3 * langmuir.Qe(0.5 * CMIN));
+
+}
+
+TEST_F(TestSuit, Temperatura) {
+
+    for (const auto& temp : {TMIN, 317.0, TEMP, 371.3, TMAX})
+        for (size_t k = 0; k < NPTS; k += 7) {
+
+        const Real  c (CMIN * std::pow(CMAXT / CMIN, (k + 0.37) / NPTS));
+        const Real  q (fowler.Qe(c, temp));
+
+            EXPECT_NEAR(model_3.Qe(c, temp), q, 2.0 * TOLE * q);
+        }
+
+}
+
+TEST_F(TestSuit, Bloco) {
+
+ist::VecReal     q(NPTS), dq(NPTS);
+
+    ce[0] = 0.0;
+
+    model_3.Qe(ce, q, TEMP);
+    model_3.DQDC(ce, dq, TEMP);
+
+    EXPECT_EQ(q[0], 0.0);
+    EXPECT_EQ(dq[0], model_3.DQDC(0.0, TEMP));
+
+    for (size_t k = 1; k < NPTS; ++k) {
+        EXPECT_NEAR(q[k], model_3.Qe(ce[k], TEMP), 1.0e-14 * q[k]);
+        EXPECT_NEAR(dq[k], model_3.DQDC(ce[k], TEMP), 1.0e-12 * dq[k]);
+    }
+
+}
+
+TEST_F(TestSuit, DeathTest) {
+
+ist::VecReal     q(NPTS - 1);
+
+    EXPECT_DEATH(TestModel(langmuir, - CMIN, CMAX);, "");
+    EXPECT_DEATH(TestModel(langmuir, CMAX, CMIN);, "");
+    EXPECT_DEATH(TestModel(langmuir, CMIN, CMAX, - TOLE);, "");
+    EXPECT_DEATH(TestModel(fowler, CMIN, CMAXT, TMAX, TMIN, TOLE);, "");
+    EXPECT_DEATH(auto value = model_1.Qe(1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qe(- 1.0);, "");
+    EXPECT_DEATH(auto value = model_3.Qe(1.0, TMAX + 1.0);, "");
+    EXPECT_DEATH(auto value = model_2.Qe(1.0, TEMP);, "");
+    EXPECT_DEATH(auto value = model_2.DQDC(1.0, TEMP);, "");
+    EXPECT_DEATH(model_2.Qe(ce, q);, "");
+
+}
+
+int main(int argc, char **argv)
+{
+   testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS();
+}
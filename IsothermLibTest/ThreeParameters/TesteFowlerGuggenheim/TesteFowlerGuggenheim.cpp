@@ -30,6 +30,12 @@
 
 #include <Isotherm/ThreeParameters/FowlerGuggenheim.h>                 // ist::FowlerGuggenheim
 
+//==============================================================================
+// include da lib c++
+//==============================================================================
+
+#include <vector>                       // std::vector
+
 //==============================================================================
 // include da googletest
 //==============================================================================
@@ -136,6 +142,47 @@ std::unique_ptr<ist::Isotherm>  iso1c = iso1.Clone();
     EXPECT_DEATH(auto value = iso1c->Qe(  CE, -TEMP);, "");
 }
 
+TEST_F(TestSuit, Bloco) {
+
+//  Qe e DQDC em bloco chamadas no proprio modelo, pelo laco de IsothermTemplate
+
+const size_t            NPTO (100);
+std::vector<Real>       ce (NPTO), qe (NPTO), dqdc (NPTO);
+
+    for (size_t k = 0; k < NPTO; ++k) ce[k] = CE * (0.5 + static_cast<Real>(k) / NPTO);
+
+    isotherm_2.Qe(ce, qe, TEMP);
+    isotherm_2.DQDC(ce, dqdc, TEMP);
+
+    for (size_t k = 0; k < NPTO; ++k) {
+        EXPECT_DOUBLE_EQ(qe[k], isotherm_2.Qe(ce[k], TEMP));
+        EXPECT_DOUBLE_EQ(dqdc[k], isotherm_2.DQDC(ce[k], TEMP));
+    }
+
+    EXPECT_DEATH(isotherm_2.Qe(ce, std::span<Real>(qe).first(NPTO - 1), TEMP);, "");
+
+}
+
+TEST_F(TestSuit, Parametros) {
+
+//  A constante dos gases nao faz parte dos coeficientes e e mantida
+const Real              rgas (2.0 * isotherm_2.Rgas());
+const TestIsotherm      iso (QMAX, K1Novo, K2, rgas);
+const Real              par[] {QMAX, K1Novo, K2};
+
+    isotherm_2.Rgas(rgas);
+    isotherm_2.SetParameters(par);
+
+    EXPECT_EQ(isotherm_2.Rgas(), rgas);
+    EXPECT_EQ(isotherm_2.Qe(CE, TEMP), iso.Qe(CE, TEMP));
+
+    isotherm_3.Rgas(rgas);
+    isotherm_3.K1(K1Novo);
+
+    EXPECT_EQ(isotherm_3.Qe(CE, TEMP), iso.Qe(CE, TEMP));
+
+}
+
 TEST_F(TestSuit, DeathTest) {
     
     EXPECT_DEATH(TestIsotherm(- QMAX ,    K1,   K2);, ""); 
@@ -117,12 +117,61 @@ std::unique_ptr<ist::Isotherm>  iso1c = iso1.Clone();
 
 }    
 
+TEST_F(TestSuit, Preparo) {
+
+//  As constantes derivadas dos coeficientes sao refeitas quando um
+//  coeficiente muda
+const TestIsotherm      iso (QMAX, K1, K2Novo);
+
+    isotherm_2.K2(K2Novo);
+
+    EXPECT_EQ(isotherm_2.Qe(CE), iso.Qe(CE));
+    EXPECT_EQ(isotherm_2.DQDC(CE), iso.DQDC(CE));
+    EXPECT_EQ(isotherm_2.Ce(iso.Qe(CE)), iso.Ce(iso.Qe(CE)));
+
+    isotherm_3 = iso;
+
+    EXPECT_EQ(isotherm_3.Qe(CE), iso.Qe(CE));
+
+}
+
+TEST_F(TestSuit, Parametros) {
+
+//  Alteracao de todos os coeficientes sem reconstruir o modelo
+const TestIsotherm      iso (QMAXNovo, K1Novo, K2Novo);
+const Real              par[] {QMAXNovo, K1Novo, K2Novo};
+
+    isotherm_2.SetParameters(par);
+
+    EXPECT_EQ(isotherm_2.Qmax(), QMAXNovo);
+    EXPECT_EQ(isotherm_2.K1(), K1Novo);
+    EXPECT_EQ(isotherm_2.K2(), K2Novo);
+    EXPECT_EQ(isotherm_2.Qe(CE), iso.Qe(CE));
+    EXPECT_EQ(isotherm_2.DQDC(CE), iso.DQDC(CE));
+
+//  Coeficientes invalidos nao alteram o modelo
+const Real              bad[] {QMAX, - K1, K2};
+const Real              small[] {QMAX, K1};
+ist::IsoExceptionIndex  error;
+
+    EXPECT_FALSE(isotherm_3.TrySetParameters(bad, error));
+    EXPECT_EQ(error, ist::BadK1LEZero);
+    EXPECT_FALSE(isotherm_3.TrySetParameters(small, error));
+    EXPECT_EQ(error, ist::BadCompositionSize);
+    EXPECT_EQ(isotherm_3.K1(), K1);
+
+    EXPECT_TRUE(isotherm_1.TrySetParameters(par));
+    EXPECT_EQ(isotherm_1.Qe(CE), iso.Qe(CE));
+
+}
+
 TEST_F(TestSuit, DeathTest) {
     
     EXPECT_DEATH(TestIsotherm(- QMAX ,  K1, K2);, ""); 
     EXPECT_DEATH(TestIsotherm(   0.0 ,  K1, K2);, "");
     EXPECT_DEATH(isotherm_2.Qmax(- QMAX);, "");
     EXPECT_DEATH(isotherm_2.Qmax(   0.0);, "");
+    EXPECT_DEATH(isotherm_2.SetParameters(ist::VecReal {QMAX, K1});, "");
     
     
     EXPECT_DEATH(TestIsotherm(  QMAX ,  - K1, K2);, "");
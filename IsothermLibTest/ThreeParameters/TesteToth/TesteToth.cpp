@@ -117,6 +117,24 @@ std::unique_ptr<ist::Isotherm>  iso1c = iso1.Clone();
 
 }    
 
+TEST_F(TestSuit, Preparo) {
+
+//  As constantes derivadas dos coeficientes sao refeitas quando um
+//  coeficiente muda
+const TestIsotherm      iso (QMAX, K1, K2Novo);
+
+    isotherm_2.K2(K2Novo);
+
+    EXPECT_EQ(isotherm_2.Qe(CE), iso.Qe(CE));
+    EXPECT_EQ(isotherm_2.DQDC(CE), iso.DQDC(CE));
+    EXPECT_EQ(isotherm_2.Ce(iso.Qe(CE)), iso.Ce(iso.Qe(CE)));
+
+    isotherm_3 = iso;
+
+    EXPECT_EQ(isotherm_3.Qe(CE), iso.Qe(CE));
+
+}
+
 TEST_F(TestSuit, DeathTest) {
     
     EXPECT_DEATH(TestIsotherm(- QMAX ,  K1, K2);, ""); 